@@ -0,0 +1,278 @@
+/// skvk-astro
+///
+/// The on-device astrology engine as a command-line tool, for backend jobs
+/// and for regression runs outside Flutter:
+///
+///   skvk-astro chart --date 1990-05-15 --time 05:00:00 --lat 13 --lon 80
+///   skvk-astro predict --birth 1990-05-15T05:00:00Z --lat 13 --lon 80
+///   skvk-astro calendar --lat 13 --lon 80 --from 2025-01-01
+///       --to 2124-12-31 --format ics --out calendar.ics
+///   skvk-astro serve --port 8080 --isolates 8
+///   skvk-astro bench --seconds 5 --isolates 8
+///
+/// `serve` answers the `AstrologyApiService` GET paths, plus POST batches
+/// at `/api/v1/batch`, from one isolate per core sharing the port; the
+/// `dart:io` event loop of each is epoll-based on Linux. Times are UTC.
+///
+/// Build with `dart compile exe bin/skvk_astro.dart -o skvk-astro`.
+library;
+
+import 'dart:convert';
+import 'dart:io';
+import 'dart:isolate';
+import 'package:skvk_application/core/features/astrology/engine/lunar_calendar.dart';
+import 'package:skvk_application/core/features/astrology/engine/panchang.dart';
+import 'package:skvk_application/core/features/astrology/headless/astro_request_handler.dart';
+import 'package:skvk_application/core/features/calendar/calendar_exporter.dart';
+
+const String _usage = '''
+Usage: skvk-astro <command> [--option value ...]
+
+  chart     --date YYYY-MM-DD --time HH:MM:SS --lat --lon [--ayanamsha]
+  predict   --birth ISO-8601 --lat --lon [--date YYYY-MM-DD] [--ayanamsha]
+  calendar  --lat --lon --from YYYY-MM-DD --to YYYY-MM-DD
+            [--format ndjson|ics] [--region] [--out FILE] [--ayanamsha]
+  serve     [--address 127.0.0.1] [--port 8080] [--isolates N]
+  bench     [--seconds 5] [--isolates N]
+
+All times are UTC.''';
+
+Future<void> main(List<String> arguments) async {
+  if (arguments.isEmpty || arguments.first.startsWith('-')) {
+    stderr.writeln(_usage);
+    exitCode = 64;
+    return;
+  }
+  final Map<String, String> options;
+  try {
+    options = _options(arguments.skip(1));
+  } on FormatException catch (e) {
+    stderr.writeln('${e.message}\n\n$_usage');
+    exitCode = 64;
+    return;
+  }
+
+  switch (arguments.first) {
+    case 'chart':
+      _print(AstroRequestHandler().handle(AstroRequestHandler.birthChartPath, {
+        'dateOfBirth': options['date'] ?? '',
+        'timeOfBirth': options['time'] ?? '',
+        'latitude': options['lat'] ?? '',
+        'longitude': options['lon'] ?? '',
+        if (options['ayanamsha'] != null) 'ayanamsha': options['ayanamsha']!,
+      }));
+    case 'predict':
+      _print(AstroRequestHandler().handle(AstroRequestHandler.predictionsPath, {
+        'predictionType': 'daily',
+        'birthDateTime': options['birth'] ?? '',
+        'birthLatitude': options['lat'] ?? '',
+        'birthLongitude': options['lon'] ?? '',
+        'currentLatitude': options['lat'] ?? '',
+        'currentLongitude': options['lon'] ?? '',
+        if (options['date'] != null) 'targetDate': options['date']!,
+        if (options['ayanamsha'] != null) 'ayanamsha': options['ayanamsha']!,
+      }));
+    case 'calendar':
+      _calendar(options);
+    case 'serve':
+      await _serveAll(
+        options['address'] ?? '127.0.0.1',
+        int.parse(options['port'] ?? '8080'),
+        int.parse(options['isolates'] ?? '${Platform.numberOfProcessors}'),
+      );
+    case 'bench':
+      await _bench(
+        int.parse(options['seconds'] ?? '5'),
+        int.parse(options['isolates'] ?? '${Platform.numberOfProcessors}'),
+      );
+    default:
+      stderr.writeln('Unknown command ${arguments.first}\n\n$_usage');
+      exitCode = 64;
+  }
+}
+
+/// `--name value` and `--name=value` pairs
+Map<String, String> _options(Iterable<String> arguments) {
+  final options = <String, String>{};
+  final list = arguments.toList();
+  for (var i = 0; i < list.length; i++) {
+    final argument = list[i];
+    if (!argument.startsWith('--')) {
+      throw FormatException('Unexpected argument $argument');
+    }
+    final equals = argument.indexOf('=');
+    if (equals > 0) {
+      options[argument.substring(2, equals)] = argument.substring(equals + 1);
+    } else if (i + 1 < list.length) {
+      options[argument.substring(2)] = list[++i];
+    } else {
+      throw FormatException('Missing value for $argument');
+    }
+  }
+  return options;
+}
+
+void _print(AstroResponse response) {
+  stdout.writeln(const JsonEncoder.withIndent('  ').convert(response.body));
+  if (!response.ok) exitCode = 1;
+}
+
+void _calendar(Map<String, String> options) {
+  String option(String name) {
+    final value = options[name];
+    if (value != null) return value;
+    stderr.writeln('Missing --$name\n\n$_usage');
+    exit(64);
+  }
+
+  final exporter = CalendarExporter(
+    location: PanchangLocation(
+        double.parse(option('lat')), double.parse(option('lon'))),
+    ayanamsha: options['ayanamsha'] ?? 'lahiri',
+    convention: MonthConvention.forRegion(options['region'] ?? ''),
+  );
+  final format =
+      options['format'] == 'ics' ? ExportFormat.ics : ExportFormat.ndjson;
+  final from = DateTime.parse(option('from'));
+  final to = DateTime.parse(option('to'));
+  final out = options['out'];
+  final stopwatch = Stopwatch()..start();
+  final days = out == null
+      ? exporter.export(stdout, from: from, to: to, format: format)
+      : exporter.exportToFile(out, from: from, to: to, format: format);
+  stderr.writeln('$days days in ${stopwatch.elapsedMilliseconds} ms');
+}
+
+/// Serve from [isolates] isolates sharing one listening port
+Future<void> _serveAll(String address, int port, int isolates) async {
+  for (var i = 1; i < isolates; i++) {
+    await Isolate.spawn(_serveIsolate, (address, port));
+  }
+  stderr.writeln('skvk-astro listening on http://$address:$port '
+      'with $isolates isolates');
+  await _serve(address, port);
+}
+
+void _serveIsolate((String, int) endpoint) =>
+    _serve(endpoint.$1, endpoint.$2);
+
+Future<void> _serve(String address, int port) async {
+  final handler = AstroRequestHandler();
+  final server = await HttpServer.bind(address, port, shared: true);
+  await for (final request in server) {
+    _respond(request, handler);
+  }
+}
+
+Future<void> _respond(HttpRequest request, AstroRequestHandler handler) async {
+  final path = request.uri.path;
+  int status;
+  Object body;
+  try {
+    if (request.method == 'GET') {
+      final response = handler.handle(path, request.uri.queryParameters);
+      status = response.status;
+      body = response.body;
+    } else if (request.method == 'POST' &&
+        path == AstroRequestHandler.batchPath) {
+      final requests = jsonDecode(await utf8.decoder.bind(request).join());
+      if (requests is! List) {
+        throw const FormatException('Batch body must be a JSON list');
+      }
+      status = 200;
+      body = {
+        'responses': [
+          for (final response in handler.handleBatch(requests))
+            {'status': response.status, 'body': response.body},
+        ],
+      };
+    } else {
+      final error = AstroResponse.error(
+          405, 'METHOD_NOT_ALLOWED', '${request.method} $path');
+      status = error.status;
+      body = error.body;
+    }
+  } on FormatException catch (e) {
+    final error = AstroResponse.error(400, 'BAD_REQUEST', e.message);
+    status = error.status;
+    body = error.body;
+  }
+
+  request.response
+    ..statusCode = status
+    ..headers.contentType = ContentType.json
+    ..write(jsonEncode(body));
+  await request.response.close();
+}
+
+/// Requests of the benchmark mix: charts and predictions with a distinct
+/// birth minute each, and calendar months cycling through one year
+(String, Map<String, String>) _benchRequest(int i) {
+  final minute = i % 1440;
+  final birth = DateTime.utc(1990, 5, 15).add(Duration(minutes: minute));
+  final time = birth.toIso8601String().substring(11, 19);
+  return switch (i % 3) {
+    0 => (
+        AstroRequestHandler.birthChartPath,
+        {
+          'dateOfBirth': '1990-05-15',
+          'timeOfBirth': time,
+          'latitude': '13.08',
+          'longitude': '80.27',
+        },
+      ),
+    1 => (
+        AstroRequestHandler.predictionsPath,
+        {
+          'predictionType': 'daily',
+          'birthDateTime': birth.toIso8601String(),
+          'birthLatitude': '13.08',
+          'birthLongitude': '80.27',
+          'currentLatitude': '13.08',
+          'currentLongitude': '80.27',
+          'targetDate': '2025-03-${(i % 28 + 1).toString().padLeft(2, '0')}',
+        },
+      ),
+    _ => (
+        AstroRequestHandler.calendarMonthPath,
+        {
+          'year': '2025',
+          'month': '${i % 12 + 1}',
+          'region': 'Tamil Nadu',
+          'latitude': '13.08',
+          'longitude': '80.27',
+        },
+      ),
+  };
+}
+
+/// Requests answered by one isolate in [seconds]
+int _benchIsolate(int seconds) {
+  final handler = AstroRequestHandler();
+  final stopwatch = Stopwatch()..start();
+  final limit = seconds * 1000000;
+  var count = 0;
+  while (stopwatch.elapsedMicroseconds < limit) {
+    final (path, query) = _benchRequest(count);
+    if (!handler.handle(path, query).ok) {
+      throw StateError('Benchmark request $path failed');
+    }
+    count++;
+  }
+  return count;
+}
+
+/// Throughput of the handler, excluding HTTP, on 1 and [isolates] isolates
+Future<void> _bench(int seconds, int isolates) async {
+  stdout.writeln('Mix: full birth chart, daily prediction, calendar month');
+  for (final n in {1, isolates}) {
+    final counts = await Future.wait([
+      for (var i = 0; i < n; i++) Isolate.run(() => _benchIsolate(seconds)),
+    ]);
+    final total = counts.fold(0, (a, b) => a + b);
+    final qps = total / seconds;
+    stdout.writeln('$n isolate${n == 1 ? '' : 's'}: '
+        '${qps.toStringAsFixed(0)} QPS, '
+        '${(qps / n).toStringAsFixed(0)} QPS per core');
+  }
+}
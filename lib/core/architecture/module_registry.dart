@@ -6,6 +6,7 @@ library;
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'startup_scheduler.dart';
 
 /// Base interface for all modules
 abstract class AppModule {
@@ -24,6 +25,9 @@ abstract class AppModule {
   /// Get module dependencies
   List<Type> get dependencies;
 
+  /// Whether the module must be ready before the first frame
+  StartupPriority get startupPriority;
+
   /// Check if module is ready
   bool get isReady;
 }
@@ -36,6 +40,7 @@ class ModuleRegistry {
 
   final Map<String, AppModule> _modules = {};
   final Map<String, bool> _initializationStatus = {};
+  final Map<String, Future<void>> _pendingInitializations = {};
 
   /// Register a module
   void registerModule(AppModule module) {
@@ -48,44 +53,66 @@ class ModuleRegistry {
   }
 
   /// Initialize a specific module
-  Future<void> initializeModule(String moduleName) async {
+  ///
+  /// Concurrent calls for the same module share one initialization.
+  Future<void> initializeModule(String moduleName) {
     final module = _modules[moduleName];
     if (module == null) {
       throw Exception('Module $moduleName not found');
     }
 
     if (_initializationStatus[moduleName] == true) {
-      return; // Already initialized
+      return Future.value(); // Already initialized
     }
 
-    // Initialize dependencies first
-    for (final dependency in module.dependencies) {
-      final dependencyModule = _modules.values.firstWhere(
-          (m) => m.runtimeType == dependency,
-          orElse: () => throw Exception('Dependency $dependency not found'));
+    return _pendingInitializations[moduleName] ??=
+        _initializeModule(module).whenComplete(() {
+      _pendingInitializations.remove(moduleName);
+    });
+  }
 
-      if (!_initializationStatus[dependencyModule.name]!) {
-        await initializeModule(dependencyModule.name);
-      }
-    }
+  Future<void> _initializeModule(AppModule module) async {
+    // Initialize dependencies first (independent ones concurrently)
+    await Future.wait(
+        _dependencyNames(module).map((name) => initializeModule(name)));
 
     // Initialize the module
     await module.initialize();
-    _initializationStatus[moduleName] = true;
+    _initializationStatus[module.name] = true;
 
     if (kDebugMode) {
-      print('Module initialized: $moduleName');
+      print('Module initialized: ${module.name}');
     }
   }
 
-  /// Initialize all modules
+  List<String> _dependencyNames(AppModule module) {
+    return module.dependencies.map((dependency) {
+      final dependencyModule = _modules.values.firstWhere(
+          (m) => m.runtimeType == dependency,
+          orElse: () => throw Exception('Dependency $dependency not found'));
+      return dependencyModule.name;
+    }).toList();
+  }
+
+  /// Initialize all modules, independent modules concurrently
   Future<void> initializeAll() async {
-    final moduleNames = _modules.keys.toList();
+    await Future.wait(_modules.keys.map(initializeModule));
+  }
+
+  /// Startup task name for a module
+  static String startupTaskName(String moduleName) => 'module:$moduleName';
 
-    for (final moduleName in moduleNames) {
-      if (!_initializationStatus[moduleName]!) {
-        await initializeModule(moduleName);
-      }
+  /// Register every module as a task on [scheduler]
+  ///
+  /// Critical modules initialize before the first frame, the rest after it.
+  void scheduleStartup(StartupScheduler scheduler) {
+    for (final module in _modules.values) {
+      scheduler.register(StartupTask(
+        name: startupTaskName(module.name),
+        priority: module.startupPriority,
+        dependsOn: _dependencyNames(module).map(startupTaskName).toList(),
+        run: () => initializeModule(module.name),
+      ));
     }
   }
 
@@ -111,6 +138,7 @@ class ModuleRegistry {
     }
     _modules.clear();
     _initializationStatus.clear();
+    _pendingInitializations.clear();
   }
 
   /// Get all registered modules
@@ -131,6 +159,9 @@ class CoreModule implements AppModule {
   @override
   String get name => 'core';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.critical;
+
   @override
   String get version => '1.0.0';
 
@@ -159,6 +190,9 @@ class UserModule implements AppModule {
   @override
   String get name => 'user';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.critical;
+
   @override
   String get version => '1.0.0';
 
@@ -187,6 +221,9 @@ class AstrologyModule implements AppModule {
   @override
   String get name => 'astrology';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.critical;
+
   @override
   String get version => '1.0.0';
 
@@ -215,6 +252,9 @@ class HoroscopeModule implements AppModule {
   @override
   String get name => 'horoscope';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.deferred;
+
   @override
   String get version => '1.0.0';
 
@@ -243,6 +283,9 @@ class MatchingModule implements AppModule {
   @override
   String get name => 'matching';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.deferred;
+
   @override
   String get version => '1.0.0';
 
@@ -271,6 +314,9 @@ class CalendarModule implements AppModule {
   @override
   String get name => 'calendar';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.deferred;
+
   @override
   String get version => '1.0.0';
 
@@ -299,6 +345,9 @@ class PredictionsModule implements AppModule {
   @override
   String get name => 'predictions';
 
+  @override
+  StartupPriority get startupPriority => StartupPriority.deferred;
+
   @override
   String get version => '1.0.0';
 
@@ -0,0 +1,252 @@
+/// Startup Scheduler
+///
+/// Runs app startup work as a dependency graph. Independent tasks run
+/// concurrently, deferred tasks wait until the first frame is rasterized,
+/// every task runs at most once however often it is requested, and each
+/// launch records a startup timeline.
+library;
+
+import 'dart:async';
+import 'dart:convert';
+import 'dart:developer' as developer;
+import 'package:flutter/widgets.dart';
+import 'package:shared_preferences/shared_preferences.dart';
+import '../config/production_config.dart';
+import '../logging/logging_helper.dart';
+
+/// When a startup task runs
+enum StartupPriority {
+  /// Starts immediately, before the first frame
+  critical,
+
+  /// Starts after the first frame (or earlier if something depends on it)
+  deferred,
+}
+
+/// A unit of startup work
+class StartupTask {
+  final String name;
+  final List<String> dependsOn;
+  final StartupPriority priority;
+  final Future<void> Function() run;
+
+  const StartupTask({
+    required this.name,
+    required this.run,
+    this.dependsOn = const [],
+    this.priority = StartupPriority.critical,
+  });
+}
+
+/// Timing of one task in the startup timeline (ms since scheduler creation)
+class StartupTimelineEntry {
+  final String name;
+  final StartupPriority priority;
+  final int startMs;
+  final int endMs;
+  final String? error;
+
+  const StartupTimelineEntry({
+    required this.name,
+    required this.priority,
+    required this.startMs,
+    required this.endMs,
+    this.error,
+  });
+
+  int get durationMs => endMs - startMs;
+
+  Map<String, dynamic> toJson() => {
+        'name': name,
+        'priority': priority.name,
+        'startMs': startMs,
+        'endMs': endMs,
+        if (error != null) 'error': error,
+      };
+}
+
+/// Startup Scheduler
+///
+/// Create (via [instance]) as early as possible in `main()`; the timeline is
+/// measured from that point.
+class StartupScheduler {
+  static StartupScheduler? _instance;
+
+  static StartupScheduler get instance {
+    _instance ??= StartupScheduler._();
+    return _instance!;
+  }
+
+  StartupScheduler._();
+
+  static const String _timelinesKey = 'startup_timelines';
+  static const int _maxStoredTimelines = 20;
+
+  final Stopwatch _clock = Stopwatch()..start();
+  final Map<String, StartupTask> _tasks = {};
+  final Map<String, Future<void>> _runs = {};
+  final List<StartupTimelineEntry> _timeline = [];
+  int? _firstFrameMs;
+  bool _started = false;
+
+  /// Time from scheduler creation to the first rasterized frame
+  int? get firstFrameMs => _firstFrameMs;
+
+  /// Tasks finished so far, in completion order
+  List<StartupTimelineEntry> get timeline => List.unmodifiable(_timeline);
+
+  /// Register a task; registering the same name twice keeps the first
+  void register(StartupTask task) {
+    _tasks.putIfAbsent(task.name, () => task);
+  }
+
+  bool isRegistered(String name) => _tasks.containsKey(name);
+
+  /// Run [name] (and its dependencies) once; later calls share the result
+  ///
+  /// Dependencies run concurrently with each other. A deferred task requested
+  /// here is pulled forward instead of waiting for the first frame.
+  Future<void> ensure(String name) {
+    final existing = _runs[name];
+    if (existing != null) return existing;
+
+    final task = _tasks[name];
+    if (task == null) {
+      return Future.error(StateError('Startup task $name not registered'));
+    }
+    return _runs[name] = _run(task);
+  }
+
+  Future<void> _run(StartupTask task) async {
+    if (task.dependsOn.isNotEmpty) {
+      await Future.wait(task.dependsOn.map(ensure));
+    }
+
+    final startMs = _clock.elapsedMilliseconds;
+    final timelineTask = developer.TimelineTask()
+      ..start('startup:${task.name}');
+    String? error;
+    try {
+      await task.run();
+    } catch (e) {
+      error = e.toString();
+      rethrow;
+    } finally {
+      timelineTask.finish();
+      _timeline.add(StartupTimelineEntry(
+        name: task.name,
+        priority: task.priority,
+        startMs: startMs,
+        endMs: _clock.elapsedMilliseconds,
+        error: error,
+      ));
+    }
+  }
+
+  /// Start all critical tasks now and all deferred tasks after first frame
+  ///
+  /// Task failures are logged, never thrown; the returned future completes
+  /// when every task has finished and the timeline has been recorded.
+  Future<void> start() async {
+    if (_started) return;
+    _started = true;
+    _checkForCycles();
+
+    final critical = _tasks.values
+        .where((task) => task.priority == StartupPriority.critical)
+        .map((task) => _guarded(task.name))
+        .toList();
+
+    await WidgetsBinding.instance.waitUntilFirstFrameRasterized;
+    _firstFrameMs = _clock.elapsedMilliseconds;
+    developer.Timeline.instantSync('startup:first_frame');
+
+    final deferred = _tasks.values
+        .where((task) => task.priority == StartupPriority.deferred)
+        .map((task) => _guarded(task.name))
+        .toList();
+
+    await Future.wait([...critical, ...deferred]);
+    await _recordTimeline();
+  }
+
+  Future<void> _guarded(String name) async {
+    try {
+      await ensure(name);
+    } catch (e) {
+      LoggingHelper.logError('Startup task $name failed',
+          source: 'StartupScheduler', error: e);
+    }
+  }
+
+  void _checkForCycles() {
+    const visiting = 1, done = 2;
+    final state = <String, int>{};
+
+    void visit(String name, List<String> path) {
+      if (state[name] == done) return;
+      if (state[name] == visiting) {
+        throw StateError(
+            'Startup dependency cycle: ${[...path, name].join(' -> ')}');
+      }
+      final task = _tasks[name];
+      if (task == null) {
+        throw StateError(
+            'Startup task ${path.isEmpty ? name : path.last} depends on '
+            'unregistered task $name');
+      }
+      state[name] = visiting;
+      for (final dependency in task.dependsOn) {
+        visit(dependency, [...path, name]);
+      }
+      state[name] = done;
+    }
+
+    for (final name in _tasks.keys) {
+      visit(name, const []);
+    }
+  }
+
+  Future<void> _recordTimeline() async {
+    final entries = [..._timeline]
+      ..sort((a, b) => a.startMs.compareTo(b.startMs));
+    final summary = entries
+        .map((e) => '${e.name} ${e.startMs}-${e.endMs}ms'
+            '${e.error != null ? ' (failed)' : ''}')
+        .join(', ');
+    const release =
+        '${ProductionConfig.appVersion}+${ProductionConfig.appBuildNumber}';
+    LoggingHelper.logInfo(
+      'Startup $release: first frame ${_firstFrameMs}ms; $summary',
+      source: 'StartupScheduler',
+    );
+
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      final stored = prefs.getStringList(_timelinesKey) ?? [];
+      stored.add(jsonEncode({
+        'version': ProductionConfig.appVersion,
+        'build': ProductionConfig.appBuildNumber,
+        'recordedAt': DateTime.now().toIso8601String(),
+        'firstFrameMs': _firstFrameMs,
+        'tasks': entries.map((e) => e.toJson()).toList(),
+      }));
+      while (stored.length > _maxStoredTimelines) {
+        stored.removeAt(0);
+      }
+      await prefs.setStringList(_timelinesKey, stored);
+    } catch (e) {
+      LoggingHelper.logError('Failed to store startup timeline',
+          source: 'StartupScheduler', error: e);
+    }
+  }
+
+  /// Timelines of recent launches, oldest first
+  static Future<List<Map<String, dynamic>>> recentTimelines() async {
+    final prefs = await SharedPreferences.getInstance();
+    final stored = prefs.getStringList(_timelinesKey) ?? [];
+    return stored
+        .map((entry) => jsonDecode(entry) as Map<String, dynamic>)
+        .toList();
+  }
+}
@@ -0,0 +1,143 @@
+/// Ashtakavarga
+///
+/// Bhinnashtakavarga and sarvashtakavarga from the natal chart (Brihat
+/// Parashara Hora Shastra, ch. 66). Each planet receives a bindu in a sign
+/// when the sign falls in one of the benefic houses counted from each of the
+/// eight contributors (seven planets and the lagna). The benefic houses are
+/// const 12-bit masks, so a chart is 7 × 8 × 12 shifts.
+library;
+
+import 'dart:typed_data';
+import 'natal_chart.dart';
+
+/// Ashtakavarga
+class Ashtakavarga {
+  Ashtakavarga._();
+
+  /// Planets with an ashtakavarga: Sun … Saturn ([Graha] indices 0 … 6)
+  static const int planets = 7;
+
+  /// Contributors: the seven planets, then the lagna
+  static const int contributors = 8;
+
+  /// Values per chart in [batch]: the bhinna tables, then the sarva row
+  static const int tableSize = planets * 12 + 12;
+
+  /// Benefic houses per planet and contributor; bit h-1 marks house h
+  static const List<int> _masks = [
+    // Sun (48)
+    0x7CB, // Sun: 1 2 4 7 8 9 10 11
+    0x624, // Moon: 3 6 10 11
+    0x7CB, // Mars: 1 2 4 7 8 9 10 11
+    0xF34, // Mercury: 3 5 6 9 10 11 12
+    0x530, // Jupiter: 5 6 9 11
+    0x860, // Venus: 6 7 12
+    0x7CB, // Saturn: 1 2 4 7 8 9 10 11
+    0xE2C, // Lagna: 3 4 6 10 11 12
+    // Moon (49)
+    0x6E4, // Sun: 3 6 7 8 10 11
+    0x665, // Moon: 1 3 6 7 10 11
+    0x736, // Mars: 2 3 5 6 9 10 11
+    0x6DD, // Mercury: 1 3 4 5 7 8 10 11
+    0xEC9, // Jupiter: 1 4 7 8 10 11 12
+    0x75C, // Venus: 3 4 5 7 9 10 11
+    0x434, // Saturn: 3 5 6 11
+    0x624, // Lagna: 3 6 10 11
+    // Mars (39)
+    0x634, // Sun: 3 5 6 10 11
+    0x424, // Moon: 3 6 11
+    0x6CB, // Mars: 1 2 4 7 8 10 11
+    0x434, // Mercury: 3 5 6 11
+    0xE20, // Jupiter: 6 10 11 12
+    0xCA0, // Venus: 6 8 11 12
+    0x7C9, // Saturn: 1 4 7 8 9 10 11
+    0x625, // Lagna: 1 3 6 10 11
+    // Mercury (54)
+    0xD30, // Sun: 5 6 9 11 12
+    0x6AA, // Moon: 2 4 6 8 10 11
+    0x7CB, // Mars: 1 2 4 7 8 9 10 11
+    0xF35, // Mercury: 1 3 5 6 9 10 11 12
+    0xCA0, // Jupiter: 6 8 11 12
+    0x59F, // Venus: 1 2 3 4 5 8 9 11
+    0x7CB, // Saturn: 1 2 4 7 8 9 10 11
+    0x6AB, // Lagna: 1 2 4 6 8 10 11
+    // Jupiter (56)
+    0x7CF, // Sun: 1 2 3 4 7 8 9 10 11
+    0x552, // Moon: 2 5 7 9 11
+    0x6CB, // Mars: 1 2 4 7 8 10 11
+    0x73B, // Mercury: 1 2 4 5 6 9 10 11
+    0x6CF, // Jupiter: 1 2 3 4 7 8 10 11
+    0x732, // Venus: 2 5 6 9 10 11
+    0x834, // Saturn: 3 5 6 12
+    0x77B, // Lagna: 1 2 4 5 6 7 9 10 11
+    // Venus (52)
+    0xC80, // Sun: 8 11 12
+    0xD9F, // Moon: 1 2 3 4 5 8 9 11 12
+    0xD34, // Mars: 3 5 6 9 11 12
+    0x534, // Mercury: 3 5 6 9 11
+    0x790, // Jupiter: 5 8 9 10 11
+    0x79F, // Venus: 1 2 3 4 5 8 9 10 11
+    0x79C, // Saturn: 3 4 5 8 9 10 11
+    0x59F, // Lagna: 1 2 3 4 5 8 9 11
+    // Saturn (39)
+    0x6CB, // Sun: 1 2 4 7 8 10 11
+    0x424, // Moon: 3 6 11
+    0xE34, // Mars: 3 5 6 10 11 12
+    0xFA0, // Mercury: 6 8 9 10 11 12
+    0xC30, // Jupiter: 5 6 11 12
+    0xC20, // Venus: 6 11 12
+    0x434, // Saturn: 3 5 6 11
+    0x62D, // Lagna: 1 3 4 6 10 11
+  ];
+
+  /// Chart point of contributor [c]
+  static int _point(int c) => c < planets ? c : NatalChart.lagna;
+
+  /// Bhinnashtakavarga of [chart]: `bindus[planet * 12 + sign]`, 0 … 8
+  static Int8List bhinna(NatalChart chart) {
+    final bindus = Int8List(planets * 12);
+    _bhinnaInto(chart, bindus, 0);
+    return bindus;
+  }
+
+  static void _bhinnaInto(NatalChart chart, Int8List out, int offset) {
+    for (var c = 0; c < contributors; c++) {
+      final from = chart.rashi(_point(c));
+      for (var p = 0; p < planets; p++) {
+        final mask = _masks[p * contributors + c];
+        final row = offset + p * 12;
+        for (var sign = 0; sign < 12; sign++) {
+          out[row + sign] += (mask >> ((sign - from) % 12)) & 1;
+        }
+      }
+    }
+  }
+
+  /// Sarvashtakavarga: bindus of all seven planets per sign (337 in total)
+  static Int8List sarva(Int8List bhinna) {
+    final totals = Int8List(12);
+    for (var p = 0; p < planets; p++) {
+      for (var sign = 0; sign < 12; sign++) {
+        totals[sign] += bhinna[p * 12 + sign];
+      }
+    }
+    return totals;
+  }
+
+  /// Bhinna and sarva tables of many charts, [tableSize] values per chart
+  /// (e.g. both partners in matching, or every saved profile at once)
+  static Int8List batch(List<NatalChart> charts) {
+    final out = Int8List(charts.length * tableSize);
+    for (var i = 0; i < charts.length; i++) {
+      final offset = i * tableSize;
+      _bhinnaInto(charts[i], out, offset);
+      final sarva = offset + planets * 12;
+      for (var p = 0; p < planets; p++) {
+        for (var sign = 0; sign < 12; sign++) {
+          out[sarva + sign] += out[offset + p * 12 + sign];
+        }
+      }
+    }
+    return out;
+  }
+}
@@ -0,0 +1,221 @@
+/// Astro Frame
+///
+/// Nutation, obliquity and precession of one instant, shared by the
+/// ephemeris, the lagna and the sidereal-time sweeps so that a chart
+/// evaluates them once. Nutation is the IAU 1980 series of
+/// `astro_tables.g.dart`, summed by angle addition from the sines and
+/// cosines of the five fundamental arguments. The precession rotation from
+/// the J2000 ecliptic turns about a node cached per year; its inclination
+/// and the general precession in longitude are evaluated per instant.
+library;
+
+import 'dart:typed_data';
+import 'astro_tables.g.dart';
+import 'astro_time.dart';
+import 'engine_math.dart' as math;
+import 'precision.dart';
+
+const double _deg = math.pi / 180;
+const double _arcsecond = _deg / 3600;
+
+/// Mean obliquity of the ecliptic in degrees (Meeus 22.2)
+double meanObliquity(double jdTt) {
+  final t = julianCenturies(jdTt);
+  final arcseconds = 46.8150 * t + 0.00059 * t * t - 0.001813 * t * t * t;
+  return 23.4392911 - arcseconds / 3600;
+}
+
+/// General precession in longitude p_A since J2000, in degrees (IAU 2006)
+double generalPrecession(double jdTt) {
+  final t = julianCenturies(jdTt);
+  return (5028.796195 * t + 1.1054348 * t * t) / 3600;
+}
+
+/// Terms of [nutationTerms] kept by [Precision.fast]: the 18.6-year and
+/// half-year terms, within 0.92″ of the full series
+const int _fastNutationTerms = 2;
+
+/// Integers per row of [nutationTerms]
+const int _termWidth = 9;
+
+/// Largest multiple of a fundamental argument in [nutationTerms]
+const int _maxMultiple = 3;
+
+/// Astro Frame
+class AstroFrame {
+  /// Julian day (TT)
+  final double jdTt;
+
+  final Precision precision;
+
+  /// Nutation in longitude Δψ, degrees
+  final double nutationLongitude;
+
+  /// Nutation in obliquity Δε, degrees
+  final double nutationObliquity;
+
+  /// Mean obliquity of the ecliptic, degrees; see [trueObliquity]
+  final double obliquity;
+
+  /// General precession in longitude since J2000, degrees
+  final double precession;
+
+  final _Node _node;
+
+  /// cos and sin of the inclination π of the ecliptic of date on the J2000
+  /// ecliptic
+  final double _cosInclination;
+  final double _sinInclination;
+
+  AstroFrame._(
+    this.jdTt,
+    this.precision,
+    this.nutationLongitude,
+    this.nutationObliquity,
+    this.obliquity,
+    this.precession,
+    this._node,
+    double inclination,
+  )   : _cosInclination = math.cos(inclination),
+        _sinInclination = math.sin(inclination);
+
+  static AstroFrame? _last;
+
+  /// Frame at [jdTt]; repeated calls for the same instant and tier return
+  /// the same frame
+  static AstroFrame of(
+    double jdTt, {
+    Precision precision = Precision.high,
+  }) {
+    final last = _last;
+    if (last != null && last.jdTt == jdTt && last.precision == precision) {
+      return last;
+    }
+    final t = julianCenturies(jdTt);
+    _nutation(t, precision == Precision.fast ? _fastNutationTerms : null);
+    return _last = AstroFrame._(
+      jdTt,
+      precision,
+      _nutationOut[0],
+      _nutationOut[1],
+      meanObliquity(jdTt),
+      generalPrecession(jdTt),
+      _Node.of(jdTt),
+      (46.998973 * t - 0.0334926 * t * t - 0.00012559 * t * t * t) *
+          _arcsecond,
+    );
+  }
+
+  /// True obliquity of the ecliptic, degrees
+  double get trueObliquity => obliquity + nutationObliquity;
+
+  /// Equation of the equinoxes in degrees of sidereal time: apparent minus
+  /// mean sidereal time
+  double get equationOfEquinoxes =>
+      nutationLongitude * math.cos(trueObliquity * _deg);
+
+  /// Longitude in degrees on the mean ecliptic and equinox of date of a
+  /// direction ([x], [y], [z]) in J2000 ecliptic coordinates; add
+  /// [nutationLongitude] for the true equinox
+  ///
+  /// The direction is rotated about the node Π onto the ecliptic of date
+  /// (Meeus 21.5 with IAU 2006 values), then carried along it by the
+  /// general precession.
+  double longitudeOfDate(double x, double y, double z) {
+    final node = _node;
+    final along = node.cosine * x + node.sine * y;
+    final across = _cosInclination * (node.cosine * y - node.sine * x) +
+        _sinInclination * z;
+    return node.longitude + math.atan2(across, along) / _deg + precession;
+  }
+}
+
+final Float64List _nutationOut = Float64List(2);
+
+/// cos and sin of k·argument for k in 0 … [_maxMultiple], per argument
+final Float64List _cosines = Float64List(5 * (_maxMultiple + 1));
+final Float64List _sines = Float64List(5 * (_maxMultiple + 1));
+
+/// Δψ and Δε in degrees into [_nutationOut], from the first [count] terms
+/// of [nutationTerms] (all when null)
+void _nutation(double t, int? count) {
+  final t2 = t * t, t3 = t2 * t;
+  // Meeus 22: D, M, M', F, Ω in degrees
+  final arguments = [
+    297.85036 + 445267.111480 * t - 0.0019142 * t2 + t3 / 189474,
+    357.52772 + 35999.050340 * t - 0.0001603 * t2 - t3 / 300000,
+    134.96298 + 477198.867398 * t + 0.0086972 * t2 + t3 / 56250,
+    93.27191 + 483202.017538 * t - 0.0036825 * t2 + t3 / 327270,
+    125.04452 - 1934.136261 * t + 0.0020708 * t2 + t3 / 450000,
+  ];
+  const stride = _maxMultiple + 1;
+  for (var a = 0; a < 5; a++) {
+    final angle = (arguments[a] % 360) * _deg;
+    final c = math.cos(angle), s = math.sin(angle);
+    final base = a * stride;
+    _cosines[base] = 1;
+    _sines[base] = 0;
+    for (var k = 1; k < stride; k++) {
+      final pc = _cosines[base + k - 1], ps = _sines[base + k - 1];
+      _cosines[base + k] = pc * c - ps * s;
+      _sines[base + k] = ps * c + pc * s;
+    }
+  }
+
+  final terms = count ?? nutationTerms.length ~/ _termWidth;
+  var psi = 0.0, epsilon = 0.0;
+  for (var i = 0; i < terms; i++) {
+    final row = i * _termWidth;
+    var c = 1.0, s = 0.0;
+    for (var a = 0; a < 5; a++) {
+      final multiple = nutationTerms[row + a];
+      if (multiple == 0) continue;
+      final index = a * stride + multiple.abs();
+      final mc = _cosines[index];
+      final ms = multiple < 0 ? -_sines[index] : _sines[index];
+      final nc = c * mc - s * ms;
+      s = s * mc + c * ms;
+      c = nc;
+    }
+    psi += (nutationTerms[row + 5] + nutationTerms[row + 6] * t) * s;
+    epsilon += (nutationTerms[row + 7] + nutationTerms[row + 8] * t) * c;
+  }
+  // Table units are 0.00001″
+  _nutationOut[0] = psi / 360000000;
+  _nutationOut[1] = epsilon / 360000000;
+}
+
+/// Node Π of the ecliptic of date on the J2000 ecliptic, held per year:
+/// Π moves 8.7″ a year, but with the ecliptics at most a few arcminutes
+/// apart this moves a longitude by under 0.001″. The inclination π, which
+/// does shift latitudes into longitude, is evaluated per instant.
+class _Node {
+  /// Days per bucket
+  static const double _bucketDays = 365.25;
+
+  /// Buckets kept; a century of yearly charts
+  static const int _capacity = 100;
+
+  static final Map<int, _Node> _buckets = {};
+
+  /// Degrees
+  final double longitude;
+  final double cosine;
+  final double sine;
+
+  _Node._(this.longitude)
+      : cosine = math.cos(longitude * _deg),
+        sine = math.sin(longitude * _deg);
+
+  /// Node for the bucket of [jdTt], evaluated at the bucket's middle
+  static _Node of(double jdTt) {
+    final key = ((jdTt - j2000) / _bucketDays).floor();
+    final cached = _buckets[key];
+    if (cached != null) return cached;
+
+    final t = (key + 0.5) * _bucketDays / daysPerCentury;
+    if (_buckets.length >= _capacity) _buckets.clear();
+    return _buckets[key] =
+        _Node._((629546.7936 - 867.95758 * t + 0.157992 * t * t) / 3600);
+  }
+}
@@ -0,0 +1,216 @@
+/// Astro Tables
+///
+/// Generated by `tool/generate_astro_tables.dart`; do not edit by hand.
+library;
+
+/// Year of the first of [deltaTKnots]
+const int deltaTFirstYear = 1700;
+
+/// Delta-T in seconds at the start of each year
+const List<double> deltaTKnots = [
+  8.8300, 8.9845, 9.1279, 9.2611, 9.3847, 9.4994, 9.6061, 9.7053, 9.7978,
+  9.8841, 9.9650, 10.0410, 10.1127, 10.1806, 10.2454, 10.3076, 10.3675,
+  10.4258, 10.4829, 10.5392, 10.5952, 10.6512, 10.7077, 10.7649, 10.8233,
+  10.8832, 10.9448, 11.0085, 11.0744, 11.1429, 11.2141, 11.2883, 11.3656,
+  11.4462, 11.5302, 11.6177, 11.7088, 11.8037, 11.9023, 12.0047, 12.1109,
+  12.2208, 12.3346, 12.4521, 12.5732, 12.6979, 12.8260, 12.9574, 13.0920,
+  13.2296, 13.3701, 13.5131, 13.6585, 13.8060, 13.9553, 14.1062, 14.2583,
+  14.4113, 14.5648, 14.7185, 14.8720, 15.0248, 15.1766, 15.3268, 15.4749,
+  15.6206, 15.7633, 15.9023, 16.0373, 16.1675, 16.2924, 16.4114, 16.5238,
+  16.6289, 16.7262, 16.8148, 16.8941, 16.9633, 17.0217, 17.0684, 17.1027,
+  17.1237, 17.1306, 17.1225, 17.0986, 17.0579, 16.9995, 16.9225, 16.8258,
+  16.7086, 16.5697, 16.4082, 16.2231, 16.0131, 15.7773, 15.5146, 15.2238,
+  14.9037, 14.5532, 14.1711, 13.7200, 13.3982, 13.1098, 12.8679, 12.6790,
+  12.5446, 12.4619, 12.4251, 12.4260, 12.4549, 12.5012, 12.5540, 12.6024,
+  12.6364, 12.6466, 12.6251, 12.5651, 12.4616, 12.3112, 12.1121, 11.8642,
+  11.5690, 11.2297, 10.8506, 10.4375, 9.9972, 9.5374, 9.0662, 8.5926, 8.1254,
+  7.6734, 7.2452, 6.8489, 6.4917, 6.1801, 5.9190, 5.7125, 5.5629, 5.4711,
+  5.4362, 5.4557, 5.5256, 5.6402, 5.7923, 5.9733, 6.1739, 6.3836, 6.5920,
+  6.7884, 6.9629, 7.1069, 7.2137, 7.2792, 7.3033, 7.2903, 7.2503, 7.2005,
+  7.1664, 7.1833, 7.2978, 7.6200, 7.9583, 7.8878, 7.4939, 6.8522, 6.0293,
+  5.0829, 4.0626, 3.0105, 1.9614, 0.9435, -0.0210, -0.9156, -1.7288, -2.4538,
+  -3.0876, -3.6310, -4.0877, -4.4638, -4.7675, -5.0085, -5.1974, -5.3452,
+  -5.4631, -5.5612, -5.6490, -5.7342, -5.8223, -5.9162, -6.0156, -6.1168,
+  -6.2115, -6.2869, -6.3251, -6.3022, -6.1884, -5.9467, -5.5333, -4.8961,
+  -3.9752, -2.7900, -1.3498, 0.0051, 1.3047, 2.5743, 3.8347, 5.1017, 6.3865,
+  7.6955, 9.0305, 10.3884, 11.7615, 13.1374, 14.4989, 15.8240, 17.0861,
+  18.2537, 19.2909, 20.1568, 20.8058, 21.2000, 21.9709, 22.6022, 23.1064,
+  23.4961, 23.7839, 23.9822, 24.1037, 24.1610, 24.1665, 24.1329, 24.0727,
+  23.9985, 23.9228, 23.8583, 23.8173, 23.8127, 23.8568, 23.9622, 24.1416,
+  24.4074, 24.7731, 25.3383, 25.8760, 26.3887, 26.8786, 27.3482, 27.7998,
+  28.2357, 28.6583, 29.0700, 29.4731, 29.8700, 30.2630, 30.6545, 31.0468,
+  31.4423, 31.8434, 32.2523, 32.6716, 33.1034, 33.5799, 33.9889, 34.4988,
+  35.1014, 35.7881, 36.5508, 37.3809, 38.2703, 39.2104, 40.1929, 41.2096,
+  42.2520, 43.3118, 44.3805, 45.4500, 46.5118, 47.5575, 48.5788, 49.5673,
+  50.5148, 51.4127, 52.2528, 53.0268, 53.7261, 54.3426, 54.8777, 55.3164,
+  55.7768, 56.2964, 56.8946, 57.5748, 58.3276, 59.1337, 59.9666, 60.7954,
+  61.5880, 62.3135, 62.9454, 63.4640, 63.8600, 64.1365, 64.3125, 64.4253,
+  64.5337, 64.6900, 64.8500, 65.1500, 65.4600, 65.7800, 66.0700, 66.3200,
+  66.6000, 66.9100, 67.2800, 67.6400, 68.1000, 68.5900, 68.9700, 69.2200,
+  69.3600, 69.3600, 69.2900, 69.2000, 69.1800, 69.1400, 69.1400, 69.1400,
+  69.1400, 69.1400, 69.1400, 70.3330, 71.5260, 72.7190, 73.9120, 75.1050,
+  76.2980, 77.4910, 78.6840, 79.8770, 81.0700, 82.2630, 83.4560, 84.6490,
+  85.8420, 87.0350, 88.2280, 89.4210, 90.6140, 91.8070, 93.0000, 95.0380,
+  97.0824, 99.1332, 101.1904, 103.2540, 105.3240, 107.4004, 109.4832, 111.5724,
+  113.6680, 115.7700, 117.8784, 119.9932, 122.1144, 124.2420, 126.3760,
+  128.5164, 130.6632, 132.8164, 134.9760, 137.1420, 139.3144, 141.4932,
+  143.6784, 145.8700, 148.0680, 150.2724, 152.4832, 154.7004, 156.9240,
+  159.1540, 161.3904, 163.6332, 165.8824, 168.1380, 170.4000, 172.6684,
+  174.9432, 177.2244, 179.5120, 181.8060, 184.1064, 186.4132, 188.7264,
+  191.0460, 193.3720, 195.7044, 198.0432, 200.3884, 202.7400, 205.0980,
+  207.4624, 209.8332, 212.2104, 214.5940, 216.9840, 219.3804, 221.7832,
+  224.1924, 226.6080, 229.0300, 231.4584, 233.8932, 236.3344, 238.7820,
+  241.2360, 243.6964, 246.1632, 248.6364, 251.1160, 253.6020, 256.0944,
+  258.5932, 261.0984, 263.6100, 266.1280, 268.6524, 271.1832, 273.7204,
+  276.2640, 278.8140, 281.3704, 283.9332, 286.5024, 289.0780, 291.6600,
+  294.2484, 296.8432, 299.4444, 302.0520, 304.6660, 307.2864, 309.9132,
+  312.5464, 315.1860, 317.8320, 320.4844, 323.1432, 325.8084, 328.4800,
+];
+
+/// Second derivatives of the natural cubic spline through [deltaTKnots]
+const List<double> deltaTCurvature = [
+  0.00000000, -0.01433712, -0.00925153, -0.00985678, -0.00892136, -0.00785777,
+  -0.00764755, -0.00655203, -0.00634433, -0.00527065, -0.00497306, -0.00423711,
+  -0.00387849, -0.00304891, -0.00252585, -0.00244768, -0.00148342, -0.00121864,
+  -0.00084202, -0.00021326, -0.00010492, 0.00063294, 0.00057315, 0.00127445,
+  0.00152903, 0.00160941, 0.00223332, 0.00205730, 0.00273749, 0.00259275,
+  0.00309150, 0.00304124, 0.00334355, 0.00338457, 0.00351818, 0.00354272,
+  0.00391093, 0.00361355, 0.00383487, 0.00384698, 0.00357721, 0.00404418,
+  0.00364606, 0.00357159, 0.00366758, 0.00335808, 0.00330010, 0.00324153,
+  0.00293380, 0.00302328, 0.00237306, 0.00248446, 0.00208909, 0.00175917,
+  0.00167422, 0.00114394, 0.00095001, 0.00045600, 0.00022597, -0.00015988,
+  -0.00078645, -0.00089432, -0.00163627, -0.00216062, -0.00232127, -0.00295431,
+  -0.00386150, -0.00379968, -0.00493978, -0.00524121, -0.00589537, -0.00657730,
+  -0.00739543, -0.00764097, -0.00884067, -0.00919633, -0.01017400, -0.01070766,
+  -0.01179535, -0.01231094, -0.01336090, -0.01404546, -0.01505726, -0.01572551,
+  -0.01684070, -0.01771170, -0.01851251, -0.01983827, -0.02033441, -0.02182409,
+  -0.02256922, -0.02349902, -0.02503469, -0.02576222, -0.02671642, -0.02877208,
+  -0.02679526, -0.03984689, 0.00378283, -0.16488443, 0.24175488, -0.02633511,
+  0.06398556, 0.04939288, 0.05644291, 0.05183548, 0.04641516, 0.03790389,
+  0.02816928, 0.01741900, 0.00655474, -0.00463795, -0.01440295, -0.02415024,
+  -0.03179610, -0.03886536, -0.04374247, -0.04716475, -0.04899852, -0.04904117,
+  -0.04763681, -0.04421160, -0.04011680, -0.03412121, -0.02739835, -0.01948540,
+  -0.01166007, -0.00227432, 0.00635736, 0.01524489, 0.02386309, 0.03210276,
+  0.03912587, 0.04599377, 0.05049906, 0.05500998, 0.05706101, 0.05814597,
+  0.05715509, 0.05463366, 0.05071027, 0.04492525, 0.03778874, 0.02891981,
+  0.01993204, 0.00895204, -0.00114018, -0.01219131, -0.02209458, -0.03083037,
+  -0.03758395, -0.04203382, -0.04208076, -0.03804313, -0.02834671, -0.01057002,
+  0.01182681, 0.05746279, 0.06432204, 0.27084906, 0.09848172, -0.56817594,
+  -0.27857797, -0.25791220, -0.17657324, -0.12299484, -0.07244740, -0.03061555,
+  0.00410959, 0.03217718, 0.05438169, 0.07069607, 0.08223405, 0.08876774,
+  0.09189498, 0.09085233, 0.08709570, 0.08096488, 0.07264477, 0.06285604,
+  0.05213108, 0.04121964, 0.02959034, 0.01981899, 0.00993369, 0.00224623,
+  -0.00331863, -0.00637172, -0.00599447, -0.00265038, 0.00579600, 0.01846639,
+  0.03613843, 0.06017989, 0.08974202, 0.12625204, 0.17264984, 0.21334860,
+  0.31675574, 0.22182842, 0.38173056, -0.21875066, -0.01852793, -0.03893761,
+  -0.00572163, 0.00662414, 0.01882508, 0.02487553, 0.02687281, 0.02363322,
+  0.01599429, 0.00358961, -0.01355273, -0.03577870, -0.06173249, -0.09529135,
+  -0.12410212, -0.19070017, -0.14089721, -0.54711099, 0.80054117, -0.39485371,
+  -0.05872635, -0.13284090, -0.09691005, -0.09091889, -0.07641439, -0.06422356,
+  -0.05189138, -0.03901092, -0.02666492, -0.01392939, -0.00161754, 0.01139953,
+  0.02321940, 0.03672286, 0.04828916, 0.06232050, 0.07022885, 0.10076409,
+  0.04511478, 0.31817681, -0.12082200, 0.00011120, -0.02962281, -0.01841998,
+  -0.01849727, -0.01559093, -0.01333901, -0.01085301, -0.00864893, -0.00615126,
+  -0.00394603, -0.00146462, 0.00080450, 0.00304663, 0.00620898, 0.00571747,
+  0.01772116, -0.01420210, 0.11408725, -0.17394691, 0.17670038, 0.07254541,
+  0.08931800, 0.07478260, 0.06755159, 0.05941102, 0.05060431, 0.04237172,
+  0.03430881, 0.02559306, 0.01751897, 0.00873108, 0.00095671, -0.00775790,
+  -0.01612509, -0.02434173, -0.03290801, -0.04082625, -0.04978700, -0.05762577,
+  -0.06650992, -0.07293453, -0.08995195, -0.06405767, -0.14221737, 0.05452715,
+  0.05430878, 0.08343772, 0.08354032, 0.07440100, 0.05445568, 0.02757629,
+  -0.00396085, -0.03633288, -0.06790761, -0.09463666, -0.11514574, -0.12458038,
+  -0.12213275, -0.10388862, -0.06531276, -0.01406034, 0.09515410, -0.07915608,
+  0.24367022, -0.05552479, 0.03842894, -0.03819096, -0.06566511, 0.06085139,
+  0.00225956, 0.11011036, -0.08270100, 0.16069364, 0.03992646, -0.14039946,
+  -0.13832860, -0.08628614, -0.17652684, -0.04760650, -0.05304715, 0.13979511,
+  -0.08613328, 0.08473800, -0.01281872, -0.03346312, 0.14667121, -0.55322171,
+  2.06621563, -0.55364081, 0.14834761, -0.03974962, 0.01065088, -0.00285390,
+  0.00076471, -0.00020495, 0.00005510, -0.00001546, 0.00000673, -0.00001146,
+  0.00003911, -0.00014498, 0.00054082, -0.00201830, 0.00753237, -0.02811118,
+  0.10491234, -0.39153818, 1.46124037, -0.38342330, 0.11085284, -0.02158805,
+  0.01389938, 0.00439055, 0.00693843, 0.00625573, 0.00643866, 0.00638964,
+  0.00640278, 0.00639926, 0.00640020, 0.00639995, 0.00640001, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000, 0.00640000,
+  0.00640000, 0.00640000, 0.00639999, 0.00640005, 0.00639983, 0.00640063,
+  0.00639763, 0.00640884, 0.00636701, 0.00652312, 0.00594050, 0.00811487,
+  0.00000000,
+];
+
+/// IAU 1980 nutation: D, M, M', F, Ω multiples, then Δψ, Δψ per century,
+/// Δε and Δε per century in 0.00001″; largest Δψ first
+const List<int> nutationTerms = [
+  0, 0, 0, 0, 1, -1719960, -1742, 920250, 89,
+  -2, 0, 0, 2, 2, -131870, -16, 57360, -31,
+  0, 0, 0, 2, 2, -22740, -2, 9770, -5,
+  0, 0, 0, 0, 2, 20620, 2, -8950, 5,
+  0, 1, 0, 0, 0, 14260, -34, 540, -1,
+  0, 0, 1, 0, 0, 7120, 1, -70, 0,
+  -2, 1, 0, 2, 2, -5170, 12, 2240, -6,
+  0, 0, 0, 2, 1, -3860, -4, 2000, 0,
+  0, 0, 1, 2, 2, -3010, 0, 1290, -1,
+  -2, -1, 0, 2, 2, 2170, -5, -950, 3,
+  -2, 0, 1, 0, 0, -1580, 0, 0, 0,
+  -2, 0, 0, 2, 1, 1290, 1, -700, 0,
+  0, 0, -1, 2, 2, 1230, 0, -530, 0,
+  2, 0, 0, 0, 0, 630, 0, 0, 0,
+  0, 0, 1, 0, 1, 630, 1, -330, 0,
+  2, 0, -1, 2, 2, -590, 0, 260, 0,
+  0, 0, -1, 0, 1, -580, -1, 320, 0,
+  0, 0, 1, 2, 1, -510, 0, 270, 0,
+  -2, 0, 2, 0, 0, 480, 0, 0, 0,
+  0, 0, -2, 2, 1, 460, 0, -240, 0,
+  2, 0, 0, 2, 2, -380, 0, 160, 0,
+  0, 0, 2, 2, 2, -310, 0, 130, 0,
+  0, 0, 2, 0, 0, 290, 0, 0, 0,
+  -2, 0, 1, 2, 2, 290, 0, -120, 0,
+  0, 0, 0, 2, 0, 260, 0, 0, 0,
+  -2, 0, 0, 2, 0, -220, 0, 0, 0,
+  0, 0, -1, 2, 1, 210, 0, -100, 0,
+  0, 2, 0, 0, 0, 170, -1, 0, 0,
+  2, 0, -1, 0, 1, 160, 0, -80, 0,
+  -2, 2, 0, 2, 2, -160, 1, 70, 0,
+  0, 1, 0, 0, 1, -150, 0, 90, 0,
+  -2, 0, 1, 0, 1, -130, 0, 70, 0,
+  0, -1, 0, 0, 1, -120, 0, 60, 0,
+  0, 0, 2, -2, 0, 110, 0, 0, 0,
+  2, 0, -1, 2, 1, -100, 0, 50, 0,
+  2, 0, 1, 2, 2, -80, 0, 30, 0,
+  0, 1, 0, 2, 2, 70, 0, -30, 0,
+  -2, 1, 1, 0, 0, -70, 0, 0, 0,
+  0, -1, 0, 2, 2, -70, 0, 30, 0,
+  2, 0, 0, 2, 1, -70, 0, 30, 0,
+  2, 0, 1, 0, 0, 60, 0, 0, 0,
+  -2, 0, 2, 2, 2, 60, 0, -30, 0,
+  -2, 0, 1, 2, 1, 60, 0, -30, 0,
+  2, 0, -2, 0, 1, -60, 0, 30, 0,
+  2, 0, 0, 0, 1, -60, 0, 30, 0,
+  0, -1, 1, 0, 0, 50, 0, 0, 0,
+  -2, -1, 0, 2, 1, -50, 0, 30, 0,
+  -2, 0, 0, 0, 1, -50, 0, 30, 0,
+  0, 0, 2, 2, 1, -50, 0, 30, 0,
+  -2, 0, 2, 0, 1, 40, 0, 0, 0,
+  -2, 1, 0, 2, 1, 40, 0, 0, 0,
+  0, 0, 1, -2, 0, 40, 0, 0, 0,
+  -1, 0, 1, 0, 0, -40, 0, 0, 0,
+  -2, 1, 0, 0, 0, -40, 0, 0, 0,
+  1, 0, 0, 0, 0, -40, 0, 0, 0,
+  0, 0, 1, 2, 0, 30, 0, 0, 0,
+  0, 0, -2, 2, 2, -30, 0, 0, 0,
+  -1, -1, 1, 0, 0, -30, 0, 0, 0,
+  0, 1, 1, 0, 0, -30, 0, 0, 0,
+  0, -1, 1, 2, 2, -30, 0, 0, 0,
+  2, -1, -1, 2, 2, -30, 0, 0, 0,
+  0, 0, 3, 2, 2, -30, 0, 0, 0,
+  2, -1, 0, 2, 2, -30, 0, 0, 0,
+];
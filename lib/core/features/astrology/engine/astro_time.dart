@@ -0,0 +1,84 @@
+/// Astronomical Time
+///
+/// Julian days, Julian centuries from J2000 and delta-T (TT − UT) for the
+/// on-device astrology engine. Pure Dart, no Flutter.
+library;
+
+import 'astro_tables.g.dart';
+import 'precision.dart';
+
+/// Julian day of the J2000.0 epoch (2000-01-01 12:00 TT)
+const double j2000 = 2451545.0;
+
+/// Days per Julian century
+const double daysPerCentury = 36525.0;
+
+/// Julian day (UT) of a UTC instant
+double julianDayUt(DateTime utc) {
+  final t = utc.toUtc();
+  return 2440587.5 + t.microsecondsSinceEpoch / 86400000000.0;
+}
+
+/// UTC instant of a Julian day (UT)
+DateTime dateTimeFromJulianDay(double jd) {
+  final micros = ((jd - 2440587.5) * 86400000000.0).round();
+  return DateTime.fromMicrosecondsSinceEpoch(micros, isUtc: true);
+}
+
+/// Julian centuries of TT since J2000
+double julianCenturies(double jdTt) => (jdTt - j2000) / daysPerCentury;
+
+/// Julian day (TT) of a UTC instant
+///
+/// [Precision.high] adds [lunarAccelerationCorrection] to delta-T.
+double julianDayTt(DateTime utc, {Precision precision = Precision.high}) =>
+    julianDayTtFromUt(julianDayUt(utc), precision: precision);
+
+/// Julian day (TT) of a Julian day (UT), as [julianDayTt]
+double julianDayTtFromUt(
+  double jdUt, {
+  Precision precision = Precision.high,
+}) {
+  final year = decimalYear(jdUt);
+  var deltaT = deltaTSeconds(year);
+  if (precision == Precision.high) {
+    deltaT += lunarAccelerationCorrection(year);
+  }
+  return jdUt + deltaT / 86400.0;
+}
+
+/// Calendar year with fraction, for delta-T lookups
+double decimalYear(double jdUt) => 2000.0 + (jdUt - j2000) / 365.25;
+
+/// Delta-T in seconds
+///
+/// Over 1700–2150 a natural cubic spline through the yearly values of
+/// `astro_tables.g.dart`: Espenak & Meeus polynomials before 2005 and IERS
+/// observations to 2025, a fraction of a second against the published
+/// values. The 2025 value is then held to 2030 and joined linearly to the
+/// Espenak & Meeus prediction from 2050; years past the observations are
+/// estimates. Outside 1700–2150 the long-term parabola is used.
+double deltaTSeconds(double year) {
+  final x = year - deltaTFirstYear;
+  final last = deltaTKnots.length - 1;
+  if (x >= 0 && x < last) {
+    final i = x.floor();
+    final u = x - i;
+    final a = 1 - u;
+    return a * deltaTKnots[i] +
+        u * deltaTKnots[i + 1] +
+        ((a * a * a - a) * deltaTCurvature[i] +
+                (u * u * u - u) * deltaTCurvature[i + 1]) /
+            6;
+  }
+  final u = (year - 1820) / 100;
+  return -20 + 32 * u * u;
+}
+
+/// Correction in seconds of [deltaTSeconds] for the ELP-2000/82 lunar
+/// secular acceleration (−25.858″/cy² against the −26″/cy² the
+/// polynomials assume; Espenak & Meeus); at most 0.31 s over 1800–2100
+double lunarAccelerationCorrection(double year) {
+  final u = year - 1955;
+  return -0.000012932 * u * u;
+}
@@ -0,0 +1,39 @@
+/// Ayanamsha
+///
+/// Sidereal offsets for the ayanamsha types offered in the profile editor
+/// (`AyanamshaInfoHelper`), as the J2000 value plus general precession in
+/// longitude (IAU 2006).
+library;
+
+import 'astro_frame.dart';
+import 'lunar_ephemeris.dart';
+
+/// Ayanamsha
+class Ayanamsha {
+  Ayanamsha._();
+
+  /// Value at J2000.0 in degrees, per type
+  static const Map<String, double> _atJ2000 = {
+    'lahiri': 23.857092,
+    'raman': 22.410791,
+    'krishnamurti': 23.760240,
+    'faganBradley': 24.740300,
+    'yukteshwar': 22.478803,
+    'jnBhasin': 22.762137,
+    'babylonian': 24.616068,
+    'sassanian': 19.992870,
+    'aldebaran15Tau': 24.758479,
+    'galacticCenter': 26.846520,
+  };
+
+  /// Types the engine knows; anything else falls back to Lahiri
+  static Iterable<String> get types => _atJ2000.keys;
+
+  /// Ayanamsha in degrees at [jdTt] for [type]
+  static double degrees(String type, double jdTt) =>
+      (_atJ2000[type] ?? _atJ2000['lahiri']!) + generalPrecession(jdTt);
+
+  /// Sidereal longitude of a tropical [longitude]
+  static double sidereal(double longitude, String type, double jdTt) =>
+      normalizeDegrees(longitude - degrees(type, jdTt));
+}
@@ -0,0 +1,197 @@
+/// Engine Math
+///
+/// Trigonometry of the astrology engine, imported in place of `dart:math`.
+/// Dart evaluates `+ − × ÷` and `sqrt` as single correctly rounded IEEE 754
+/// operations on every target, without fused multiply-add, so a result
+/// differs between Android, iOS and the web only through the platform's
+/// `sin`, `cos` and `atan2`. In [EngineMath.deterministic] mode (the
+/// default) these are replaced by the fdlibm kernels below, written with
+/// basic operations in a fixed order, and the engine's output is the same
+/// bit for bit everywhere.
+library;
+
+import 'dart:math' as math;
+
+export 'dart:math' show pi, sqrt, min, max;
+
+/// Engine Math
+class EngineMath {
+  EngineMath._();
+
+  /// Use the portable kernels; switch off only to compare against the
+  /// platform library
+  static bool deterministic = true;
+}
+
+double sin(double x) => EngineMath.deterministic ? _sin(x) : math.sin(x);
+
+double cos(double x) => EngineMath.deterministic ? _cos(x) : math.cos(x);
+
+double tan(double x) =>
+    EngineMath.deterministic ? _sin(x) / _cos(x) : math.tan(x);
+
+double atan(double x) => EngineMath.deterministic ? _atan(x) : math.atan(x);
+
+double atan2(double y, double x) =>
+    EngineMath.deterministic ? _atan2(y, x) : math.atan2(y, x);
+
+double asin(double x) => EngineMath.deterministic
+    ? _atan2(x, math.sqrt((1 - x) * (1 + x)))
+    : math.asin(x);
+
+double acos(double x) => EngineMath.deterministic
+    ? _atan2(math.sqrt((1 - x) * (1 + x)), x)
+    : math.acos(x);
+
+// π/2 in three 33-bit parts (Cody–Waite), exact when multiplied by the
+// quadrant count of any angle the engine produces (|x| < 2^19·π/2)
+const double _twoOverPi = 6.36619772367581382433e-01;
+const double _pio2Part1 = 1.57079632673412561417e+00;
+const double _pio2Part2 = 6.07710050630396597660e-11;
+const double _pio2Part3 = 2.02226624871116645580e-21;
+
+// Minimax polynomials of fdlibm's __kernel_sin and __kernel_cos
+const double _s1 = -1.66666666666666324348e-01;
+const double _s2 = 8.33333333332248946124e-03;
+const double _s3 = -1.98412698298579493134e-04;
+const double _s4 = 2.75573137070700676789e-06;
+const double _s5 = -2.50507602534068634195e-08;
+const double _s6 = 1.58969099521155010221e-10;
+const double _c1 = 4.16666666666666019037e-02;
+const double _c2 = -1.38888888888741095749e-03;
+const double _c3 = 2.48015872894767294178e-05;
+const double _c4 = -2.75573143513906633035e-07;
+const double _c5 = 2.08757232129817482790e-09;
+const double _c6 = -1.13596475577881948265e-11;
+
+/// sin on [−π/4, π/4]
+double _kernelSin(double x) {
+  final z = x * x;
+  final r = _s2 + z * (_s3 + z * (_s4 + z * (_s5 + z * _s6)));
+  return x + z * x * (_s1 + z * r);
+}
+
+/// cos on [−π/4, π/4]
+double _kernelCos(double x) {
+  final z = x * x;
+  final r =
+      z * (_c1 + z * (_c2 + z * (_c3 + z * (_c4 + z * (_c5 + z * _c6)))));
+  final hz = 0.5 * z;
+  final w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + z * r);
+}
+
+/// sin(x + [quarters]·π/2), from x reduced to [−π/4, π/4]
+double _sinShifted(double x, int quarters) {
+  if (x.isNaN || x.isInfinite) return double.nan;
+  final k = (x * _twoOverPi).roundToDouble();
+  final r = ((x - k * _pio2Part1) - k * _pio2Part2) - k * _pio2Part3;
+  switch ((k.toInt() + quarters) & 3) {
+    case 0:
+      return _kernelSin(r);
+    case 1:
+      return _kernelCos(r);
+    case 2:
+      return -_kernelSin(r);
+    default:
+      return -_kernelCos(r);
+  }
+}
+
+double _sin(double x) => _sinShifted(x, 0);
+
+double _cos(double x) => _sinShifted(x, 1);
+
+// fdlibm s_atan.c: atan of the breakpoints 0.5, 1, 1.5, ∞ in two parts,
+// and the odd polynomial on the reduced argument
+const List<double> _atanHi = [
+  4.63647609000806093515e-01,
+  7.85398163397448278999e-01,
+  9.82793723247329054082e-01,
+  1.57079632679489655800e+00,
+];
+const List<double> _atanLo = [
+  2.26987774529616870924e-17,
+  3.06161699786838301793e-17,
+  1.39033110312309984516e-17,
+  6.12323399573676603587e-17,
+];
+const List<double> _aT = [
+  3.33333333333329318027e-01,
+  -1.99999999998764832476e-01,
+  1.42857142725034663711e-01,
+  -1.11111104054623557880e-01,
+  9.09088713343650656196e-02,
+  -7.69187620504482999495e-02,
+  6.66107313738753120669e-02,
+  -5.83357013379057348645e-02,
+  4.97687799461593236017e-02,
+  -3.65315727442169155270e-02,
+  1.62858201153657823623e-02,
+];
+
+double _atan(double x) {
+  if (x.isNaN) return x;
+  final negative = x < 0;
+  var a = x.abs();
+  int id;
+  if (a >= 2.4375) {
+    if (a >= 7.378697629483821e19) {
+      final z = _atanHi[3] + _atanLo[3];
+      return negative ? -z : z;
+    }
+    id = 3;
+    a = -1.0 / a;
+  } else if (a < 0.4375) {
+    if (a < 3.725290298461914e-9) return x;
+    id = -1;
+  } else if (a < 0.6875) {
+    id = 0;
+    a = (2.0 * a - 1.0) / (2.0 + a);
+  } else if (a < 1.1875) {
+    id = 1;
+    a = (a - 1.0) / (a + 1.0);
+  } else {
+    id = 2;
+    a = (a - 1.5) / (1.0 + 1.5 * a);
+  }
+
+  final z = a * a;
+  final w = z * z;
+  final s1 = z *
+      (_aT[0] +
+          w *
+              (_aT[2] +
+                  w * (_aT[4] + w * (_aT[6] + w * (_aT[8] + w * _aT[10])))));
+  final s2 = w *
+      (_aT[1] + w * (_aT[3] + w * (_aT[5] + w * (_aT[7] + w * _aT[9]))));
+  final result = id < 0
+      ? a - a * (s1 + s2)
+      : _atanHi[id] - ((a * (s1 + s2) - _atanLo[id]) - a);
+  return negative ? -result : result;
+}
+
+/// π in two parts
+const double _piHi = 3.1415926535897931160e+00;
+const double _piLo = 1.2246467991473531772e-16;
+
+double _atan2(double y, double x) {
+  if (x.isNaN || y.isNaN) return double.nan;
+  if (y == 0) {
+    if (x > 0 || (x == 0 && !x.isNegative)) return y;
+    return y.isNegative ? -_piHi : _piHi;
+  }
+  if (x == 0) return y > 0 ? _piHi / 2 : -_piHi / 2;
+  if (x.isInfinite) {
+    final z = y.isInfinite
+        ? (x > 0 ? _piHi / 4 : 3 * _piHi / 4)
+        : (x > 0 ? 0.0 : _piHi);
+    return y < 0 ? -z : z;
+  }
+  if (y.isInfinite) return y > 0 ? _piHi / 2 : -_piHi / 2;
+
+  final z = _atan((y / x).abs());
+  if (x > 0) return y < 0 ? -z : z;
+  final result = _piHi - (z - _piLo);
+  return y < 0 ? -result : result;
+}
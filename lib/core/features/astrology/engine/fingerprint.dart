@@ -0,0 +1,54 @@
+/// Engine Fingerprint
+///
+/// Content fingerprints of engine results. With the portable trigonometry
+/// of `engine_math.dart`, equal inputs give equal bits on every platform,
+/// so a fingerprint identifies a result across devices and the backend;
+/// stored results and shared caches are keyed by their inputs plus
+/// [engineVersion] and checked against it.
+library;
+
+import 'dart:typed_data';
+import 'package:archive/archive.dart' show getCrc32;
+
+/// Version of the engine's numerical output; bumped by any change that
+/// alters a result bit (series, constants, evaluation order)
+const int engineVersion = 3;
+
+/// Engine Fingerprint
+class EngineFingerprint {
+  EngineFingerprint._();
+
+  /// `<engineVersion>-<crc32>` of [data], serialized little-endian so the
+  /// value does not depend on the host byte order
+  static String of(TypedData data) {
+    final bytes = ByteData(data.lengthInBytes);
+    if (data is Float64List) {
+      for (var i = 0; i < data.length; i++) {
+        bytes.setFloat64(i * 8, data[i], Endian.little);
+      }
+    } else if (data is Int32List) {
+      for (var i = 0; i < data.length; i++) {
+        bytes.setInt32(i * 4, data[i], Endian.little);
+      }
+    } else if (data is Uint32List) {
+      for (var i = 0; i < data.length; i++) {
+        bytes.setUint32(i * 4, data[i], Endian.little);
+      }
+    } else if (data.elementSizeInBytes == 1) {
+      bytes.buffer.asUint8List().setAll(0,
+          data.buffer.asUint8List(data.offsetInBytes, data.lengthInBytes));
+    } else {
+      throw ArgumentError('Unsupported ${data.runtimeType}');
+    }
+    final crc = getCrc32(bytes.buffer.asUint8List());
+    return '$engineVersion-${crc.toRadixString(16).padLeft(8, '0')}';
+  }
+
+  /// Of a list of doubles, as [of] a [Float64List]
+  static String ofDoubles(List<double> values) =>
+      of(Float64List.fromList(values));
+
+  /// Whether [fingerprint] was made by this [engineVersion]
+  static bool isCurrent(String? fingerprint) =>
+      fingerprint != null && fingerprint.startsWith('$engineVersion-');
+}
@@ -0,0 +1,207 @@
+/// Gochara
+///
+/// Transits over the natal chart for a run of days, as one dense matrix for
+/// the calendar heatmap. Per day and graha: house from the natal moon and
+/// from the lagna, the transit sign's ashtakavarga bindus and the classical
+/// gochara result after vedha (obstruction); per day: tara bala and a
+/// summary score. One sweep over the days shares Earth's position,
+/// nutation and the ayanamsha across all grahas.
+library;
+
+import 'dart:typed_data';
+import 'ashtakavarga.dart';
+import 'astro_time.dart';
+import 'ayanamsha.dart';
+import 'fingerprint.dart';
+import 'natal_chart.dart';
+import 'planetary_ephemeris.dart';
+import 'precision.dart';
+import 'vimshottari.dart';
+
+/// Per-graha columns of a [GocharaMatrix]
+enum GocharaMetric {
+  /// House from the natal moon, 1 … 12
+  houseFromMoon,
+
+  /// House from the natal lagna, 1 … 12
+  houseFromLagna,
+
+  /// Bindus of the transit sign in the graha's own ashtakavarga, 0 … 8;
+  /// −1 for Rahu and Ketu
+  bindus,
+
+  /// +1 favourable, 0 favourable but obstructed by vedha, −1 unfavourable
+  effect,
+}
+
+/// Days × metrics transit matrix
+class GocharaMatrix {
+  /// Local date of row 0
+  final DateTime start;
+
+  final int days;
+
+  /// Row-major, [stride] values per day
+  final Int8List data;
+
+  /// Per-graha columns, then tara and score
+  static const int stride = _grahas * _metrics + _dayColumns;
+
+  static const int _grahas = 9;
+  static const int _metrics = 4;
+  static const int _dayColumns = 2;
+  static const int _tara = _grahas * _metrics;
+  static const int _score = _tara + 1;
+
+  GocharaMatrix(this.start, this.days) : data = Int8List(days * stride);
+
+  String get fingerprint => EngineFingerprint.of(data);
+
+  int value(int day, Graha graha, GocharaMetric metric) =>
+      data[day * stride + graha.index * _metrics + metric.index];
+
+  /// Tara from the birth star, 1 (Janma) … 9 (Parama Mitra)
+  int tara(int day) => data[day * stride + _tara];
+
+  /// Sum of the grahas' effects, ±1 for tara bala and ±1 for the moon's
+  /// bindus; positive days are good
+  int score(int day) => data[day * stride + _score];
+
+  /// Row of a local date, or −1 outside the matrix
+  int dayOf(DateTime date) {
+    final day = DateTime.utc(date.year, date.month, date.day)
+        .difference(DateTime.utc(start.year, start.month, start.day))
+        .inDays;
+    return day >= 0 && day < days ? day : -1;
+  }
+
+  /// The score column
+  Int8List get scores =>
+      Int8List.fromList([for (var day = 0; day < days; day++) score(day)]);
+}
+
+/// Gochara
+class Gochara {
+  Gochara._();
+
+  /// Favourable houses from the moon and their vedha houses: entry h-1 is
+  /// the vedha house of a favourable house h, 0 when h is unfavourable
+  static const List<List<int>> _vedha = [
+    // Sun: 3/9, 6/12, 10/4, 11/5
+    [0, 0, 9, 0, 0, 12, 0, 0, 0, 4, 5, 0],
+    // Moon: 1/5, 3/9, 6/12, 7/2, 10/4, 11/8
+    [5, 0, 9, 0, 0, 12, 2, 0, 0, 4, 8, 0],
+    // Mars: 3/12, 6/9, 11/5
+    [0, 0, 12, 0, 0, 9, 0, 0, 0, 0, 5, 0],
+    // Mercury: 2/5, 4/3, 6/9, 8/1, 10/8, 11/12
+    [0, 5, 0, 3, 0, 9, 0, 1, 0, 8, 12, 0],
+    // Jupiter: 2/12, 5/4, 7/3, 9/10, 11/8
+    [0, 12, 0, 0, 4, 0, 3, 0, 10, 0, 8, 0],
+    // Venus: 1/8, 2/7, 3/1, 4/10, 5/9, 8/5, 9/11, 11/6, 12/3
+    [8, 7, 1, 10, 9, 0, 0, 5, 11, 0, 6, 3],
+    // Saturn: 3/12, 6/9, 11/5
+    [0, 0, 12, 0, 0, 9, 0, 0, 0, 0, 5, 0],
+    // Rahu and Ketu as Saturn
+    [0, 0, 12, 0, 0, 9, 0, 0, 0, 0, 5, 0],
+    [0, 0, 12, 0, 0, 9, 0, 0, 0, 0, 5, 0],
+  ];
+
+  /// Favourable taras (Sampat, Kshema, Sadhana, Mitra, Parama Mitra)
+  static const int _goodTaras = 1 << 2 | 1 << 4 | 1 << 6 | 1 << 8 | 1 << 9;
+
+  /// Sun/Saturn and Moon/Mercury do not obstruct each other
+  static bool _exempt(int a, int b) {
+    final pair = 1 << a | 1 << b;
+    return pair == (1 << Graha.sun.index | 1 << Graha.saturn.index) ||
+        pair == (1 << Graha.moon.index | 1 << Graha.mercury.index);
+  }
+
+  /// Transits over [natal] for [days] days from the local date [start],
+  /// evaluated at [hour] local time (6 AM, as the daily predictions)
+  static GocharaMatrix compute(
+    NatalChart natal, {
+    required DateTime start,
+    required int days,
+    required String ayanamsha,
+    int hour = 6,
+    Precision precision = Precision.high,
+  }) {
+    final matrix = GocharaMatrix(
+        DateTime(start.year, start.month, start.day), days);
+    final data = matrix.data;
+    final bindus = Ashtakavarga.bhinna(natal);
+    final moonSign = natal.rashi(Graha.moon.index);
+    final lagnaSign = natal.rashi(NatalChart.lagna);
+    final birthStar =
+        (natal.longitude(Graha.moon) / nakshatraSpan).floor() % 27;
+
+    final grahas = Graha.values.length;
+    final longitudes = Float64List(grahas);
+    final houses = Int8List(grahas);
+
+    for (var day = 0; day < days; day++) {
+      final instant =
+          DateTime(start.year, start.month, start.day + day, hour).toUtc();
+      final jdTt = julianDayTt(instant, precision: precision);
+      grahaLongitudes(jdTt, longitudes, precision: precision);
+      final ayanamshaDegrees = Ayanamsha.degrees(ayanamsha, jdTt);
+
+      final row = day * GocharaMatrix.stride;
+      for (var g = 0; g < grahas; g++) {
+        var sidereal = (longitudes[g] - ayanamshaDegrees) % 360;
+        if (sidereal < 0) sidereal += 360;
+        longitudes[g] = sidereal;
+        final sign = sidereal ~/ 30;
+        houses[g] = (sign - moonSign) % 12 + 1;
+
+        final column = row + g * GocharaMatrix._metrics;
+        data[column + GocharaMetric.houseFromMoon.index] = houses[g];
+        data[column + GocharaMetric.houseFromLagna.index] =
+            (sign - lagnaSign) % 12 + 1;
+        data[column + GocharaMetric.bindus.index] =
+            g < Ashtakavarga.planets ? bindus[g * 12 + sign] : -1;
+      }
+
+      // Gochara with vedha: a favourable house is obstructed when another
+      // graha transits its vedha house
+      var score = 0;
+      for (var g = 0; g < grahas; g++) {
+        final vedhaHouse = _vedha[g][houses[g] - 1];
+        var effect = -1;
+        if (vedhaHouse != 0) {
+          effect = 1;
+          for (var o = 0; o < grahas; o++) {
+            if (o != g && houses[o] == vedhaHouse && !_exempt(g, o)) {
+              effect = 0;
+              break;
+            }
+          }
+        }
+        data[row + g * GocharaMatrix._metrics + GocharaMetric.effect.index] =
+            effect;
+        score += effect;
+      }
+
+      final star = (longitudes[Graha.moon.index] / nakshatraSpan).floor();
+      final tara = (star - birthStar) % 27 % 9 + 1;
+      data[row + GocharaMatrix._tara] = tara;
+      score += (_goodTaras >> tara) & 1 == 1 ? 1 : -1;
+      final moonBindus = data[row +
+          Graha.moon.index * GocharaMatrix._metrics +
+          GocharaMetric.bindus.index];
+      score += moonBindus >= 4 ? 1 : -1;
+      data[row + GocharaMatrix._score] = score;
+    }
+    return matrix;
+  }
+
+  /// The whole calendar [year], at the heatmap's [Precision.fast]
+  static GocharaMatrix year(NatalChart natal, int year, String ayanamsha) =>
+      compute(
+        natal,
+        start: DateTime(year),
+        days: DateTime.utc(year + 1).difference(DateTime.utc(year)).inDays,
+        ayanamsha: ayanamsha,
+        precision: Precision.fast,
+      );
+}
@@ -0,0 +1,53 @@
+/// Lagna
+///
+/// Sidereal time, obliquity of the ecliptic and the ascendant (the ecliptic
+/// degree rising on the eastern horizon) from Meeus, "Astronomical
+/// Algorithms" ch. 12 and 22.
+library;
+
+import 'astro_frame.dart';
+import 'astro_time.dart';
+import 'engine_math.dart' as math;
+import 'lunar_ephemeris.dart';
+
+export 'astro_frame.dart' show meanObliquity;
+
+const double _deg = math.pi / 180;
+
+/// Rate of the sidereal time in degrees per day of UT (Meeus 12.4)
+const double siderealDegreesPerDay = 360.98564736629;
+
+/// Mean sidereal time at Greenwich in degrees (Meeus 12.4)
+double greenwichSiderealTime(double jdUt) {
+  final t = (jdUt - j2000) / daysPerCentury;
+  return normalizeDegrees(280.46061837 +
+      siderealDegreesPerDay * (jdUt - j2000) +
+      0.000387933 * t * t -
+      t * t * t / 38710000);
+}
+
+/// Apparent tropical longitude of the ascendant
+///
+/// [latitude] and [longitude] in degrees, east positive. The local sidereal
+/// time includes the equation of the equinoxes and the true obliquity is
+/// used, so the result is on the same true equinox as the graha longitudes
+/// and shares their [AstroFrame].
+double ascendantLongitude(double jdUt, double latitude, double longitude) {
+  final frame = AstroFrame.of(julianDayTtFromUt(jdUt));
+  final ramc =
+      greenwichSiderealTime(jdUt) + frame.equationOfEquinoxes + longitude;
+  return ascendantFromRamc(ramc, frame.trueObliquity, latitude);
+}
+
+/// Ascendant from the local sidereal time [ramc] and the [obliquity], in
+/// degrees; for sweeps over nearby instants, where the sidereal time
+/// advances at [siderealDegreesPerDay] and the obliquity stays put
+double ascendantFromRamc(double ramc, double obliquity, double latitude) {
+  final r = ramc * _deg;
+  final e = obliquity * _deg;
+  final ascendant = math.atan2(
+    math.cos(r),
+    -(math.sin(r) * math.cos(e) + math.tan(latitude * _deg) * math.sin(e)),
+  );
+  return normalizeDegrees(ascendant / _deg);
+}
@@ -0,0 +1,473 @@
+/// Lunar Calendar
+///
+/// Sankrantis (the sidereal Sun entering a rashi) and tithi, nakshatra and
+/// yoga boundaries over a range of days from one sweep, and the lunar
+/// months they define under the amanta (new moon to new moon) and
+/// purnimanta (full moon to full moon) conventions, with adhika
+/// (intercalary) and kshaya (dropped) masas.
+///
+/// The sweep samples the Sun and Moon every six hours at
+/// [Precision.fast], which is enough to bracket every boundary (no tithi,
+/// nakshatra or yoga lasts under nineteen hours), and refines each bracket
+/// by the secant method at the requested precision. The resulting
+/// [SkyEvents] are the one pass over the sky that month naming, the
+/// panchang and tithi-keyed festival rules all read.
+///
+/// An amanta month is named after the rashi the Sun occupies at its
+/// opening new moon: the month that opens with the Sun in Meena is Chaitra.
+/// A month without a sankranti is adhika and shares its name with the
+/// month after it; a month with two sankrantis is kshaya-bearing, and the
+/// name the second would give is skipped. A purnimanta month takes the
+/// name of the amanta month that opens within it, so its dark fortnight
+/// carries the name of the following amanta month.
+library;
+
+import 'dart:typed_data';
+import 'astro_time.dart';
+import 'ayanamsha.dart';
+import 'lunar_ephemeris.dart';
+import 'planetary_ephemeris.dart';
+import 'precision.dart';
+import 'vimshottari.dart';
+
+/// Kind of a [SkyEvents] entry
+enum SkyEventKind {
+  /// The sidereal Sun enters a rashi; the value is the rashi, 0 (Mesha) …
+  /// 11 (Meena)
+  sankranti,
+
+  /// A tithi begins; the value is the tithi, 0 (Shukla Pratipada, at the
+  /// new moon) … 29 (Amavasya), 15 (Krishna Pratipada) at the full moon
+  tithi,
+
+  /// The sidereal Moon enters a nakshatra, 0 (Ashwini) … 26 (Revati)
+  nakshatra,
+
+  /// A yoga (sidereal Sun plus Moon in 13°20′ steps) begins, 0 (Vishkambha)
+  /// … 26 (Vaidhriti)
+  yoga;
+
+  /// Degrees of the underlying angle per value
+  double get span => const [30.0, 12.0, nakshatraSpan, nakshatraSpan][index];
+
+  /// Number of values
+  int get count => const [12, 30, 27, 27][index];
+}
+
+/// Month naming convention
+enum MonthConvention {
+  /// New moon to new moon, as in South and West India
+  amanta,
+
+  /// Full moon to full moon, as in North India
+  purnimanta;
+
+  static const Set<String> _purnimantaRegions = {
+    'north india',
+    'north indian',
+    'delhi',
+    'punjab',
+    'haryana',
+  };
+
+  /// Convention of a calendar region (`RegionAyanamshaMapper` names)
+  static MonthConvention forRegion(String region) =>
+      _purnimantaRegions.contains(region.toLowerCase())
+          ? MonthConvention.purnimanta
+          : MonthConvention.amanta;
+}
+
+/// Sankrantis and tithi starts in time order
+class SkyEvents {
+  /// Julian days (UT) of the events
+  final Float64List jdUt;
+
+  /// [SkyEventKind] index per event
+  final Int8List kinds;
+
+  /// Rashi or tithi per event
+  final Int8List values;
+
+  /// Value of each [SkyEventKind] at the start of the sweep
+  final Int8List startValues;
+
+  /// Ayanamsha of the sidereal values
+  final String ayanamsha;
+
+  SkyEvents._(
+    this.jdUt,
+    this.kinds,
+    this.values,
+    this.startValues,
+    this.ayanamsha,
+  );
+
+  int get length => jdUt.length;
+
+  /// Sidereal rashi of the Sun at the start of the sweep
+  int get startRashi => startValues[SkyEventKind.sankranti.index];
+
+  /// Event indices per kind, built on first use
+  late final List<Int32List> _byKind = [
+    for (final kind in SkyEventKind.values)
+      Int32List.fromList([
+        for (var i = 0; i < length; i++)
+          if (kinds[i] == kind.index) i,
+      ]),
+  ];
+
+  /// Position in [_byKind] of the first [kind] event after [jdUt]
+  int _after(SkyEventKind kind, double jdUt) {
+    final indices = _byKind[kind.index];
+    var low = 0, high = indices.length;
+    while (low < high) {
+      final middle = (low + high) >> 1;
+      if (this.jdUt[indices[middle]] <= jdUt) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    return low;
+  }
+
+  /// Value of [kind] at [jdUt]: that of the last event at or before it,
+  /// or the sweep's start value
+  int valueAt(SkyEventKind kind, double jdUt) {
+    final position = _after(kind, jdUt);
+    return position == 0
+        ? startValues[kind.index]
+        : values[_byKind[kind.index][position - 1]];
+  }
+
+  /// Julian day (UT) of the first [kind] event after [jdUt], or NaN past
+  /// the end of the sweep
+  double nextAfter(SkyEventKind kind, double jdUt) {
+    final indices = _byKind[kind.index];
+    final position = _after(kind, jdUt);
+    return position < indices.length
+        ? this.jdUt[indices[position]]
+        : double.nan;
+  }
+
+  SkyEventKind kind(int i) => SkyEventKind.values[kinds[i]];
+
+  DateTime at(int i) => dateTimeFromJulianDay(jdUt[i]);
+
+  /// Indices of the events of [kind] with [value]
+  Iterable<int> where(SkyEventKind kind, int value) sync* {
+    for (var i = 0; i < length; i++) {
+      if (kinds[i] == kind.index && values[i] == value) yield i;
+    }
+  }
+
+  /// Instants of the new moons (starts of Shukla Pratipada)
+  List<DateTime> get newMoons =>
+      [for (final i in where(SkyEventKind.tithi, 0)) at(i)];
+
+  /// Instants of the full moons (starts of Krishna Pratipada)
+  List<DateTime> get fullMoons =>
+      [for (final i in where(SkyEventKind.tithi, 15)) at(i)];
+
+  /// Instants of the sankrantis, as (rashi, instant)
+  List<(int, DateTime)> get sankrantis => [
+        for (var i = 0; i < length; i++)
+          if (kinds[i] == SkyEventKind.sankranti.index) (values[i], at(i)),
+      ];
+}
+
+/// One lunar month
+class LunarMonth {
+  /// Opening new moon (amanta) or full moon (purnimanta), UTC
+  final DateTime start;
+
+  /// Start of the next month, UTC
+  final DateTime end;
+
+  /// 0 (Chaitra) … 11 (Phalguna)
+  final int index;
+
+  /// Intercalary: no sankranti falls in the amanta month
+  final bool adhika;
+
+  /// Two sankrantis fall in the amanta month, so the following name is
+  /// skipped
+  final bool kshaya;
+
+  final MonthConvention convention;
+
+  const LunarMonth({
+    required this.start,
+    required this.end,
+    required this.index,
+    required this.convention,
+    this.adhika = false,
+    this.kshaya = false,
+  });
+
+  static const List<String> names = [
+    'Chaitra',
+    'Vaishakha',
+    'Jyeshtha',
+    'Ashadha',
+    'Shravana',
+    'Bhadrapada',
+    'Ashvin',
+    'Kartika',
+    'Margashirsha',
+    'Pausha',
+    'Magha',
+    'Phalguna',
+  ];
+
+  /// Name with its Adhika prefix, e.g. "Adhika Shravana"
+  String get name => adhika ? 'Adhika ${names[index]}' : names[index];
+
+  bool contains(DateTime instant) =>
+      !instant.isBefore(start) && instant.isBefore(end);
+
+  @override
+  String toString() => '$name ${start.toIso8601String()}';
+}
+
+/// Lunar Calendar
+class LunarCalendar {
+  LunarCalendar._();
+
+  /// Sampling interval of the sweep, days
+  static const double _step = 0.25;
+
+  /// Secant iterations stop below this, days (about 0.01 s)
+  static const double _tolerance = 1e-7;
+
+  /// Events of [kinds] from [startUtc] to [endUtc]; month naming needs
+  /// the default sankrantis and tithis
+  static SkyEvents scan(
+    DateTime startUtc,
+    DateTime endUtc, {
+    required String ayanamsha,
+    Precision precision = Precision.high,
+    Set<SkyEventKind> kinds = const {
+      SkyEventKind.sankranti,
+      SkyEventKind.tithi,
+    },
+  }) {
+    final jds = <double>[];
+    final eventKinds = <int>[];
+    final values = <int>[];
+
+    final startUt = julianDayUt(startUtc);
+    final endUt = julianDayUt(endUtc);
+    final scanned = [
+      for (final kind in SkyEventKind.values)
+        if (kinds.contains(kind)) kind,
+    ];
+
+    // Delta-T drifts by under a minute a century: one extra step covers it
+    final offset = julianDayTtFromUt(startUt, precision: precision) - startUt;
+    final end = endUt + offset + _step;
+    var a = startUt + offset;
+    _sample(a, ayanamsha);
+    final startValues = Int8List.fromList(_sampled);
+    final previous = Int8List.fromList(_sampled);
+    while (a < end) {
+      final b = a + _step;
+      _sample(b, ayanamsha);
+
+      // At most one event of each kind per step, sorted into time order
+      var pending = 0;
+      for (final kind in scanned) {
+        final value = _sampled[kind.index];
+        if (value == previous[kind.index]) continue;
+        previous[kind.index] = value;
+        final target = value * kind.span;
+        final jd = _refine(
+            a, b, (x) => _angle(kind, x, ayanamsha, precision) - target);
+        var j = pending++;
+        for (; j > 0 && _pendingJd[j - 1] > jd; j--) {
+          _pendingJd[j] = _pendingJd[j - 1];
+          _pendingKind[j] = _pendingKind[j - 1];
+          _pendingValue[j] = _pendingValue[j - 1];
+        }
+        _pendingJd[j] = jd;
+        _pendingKind[j] = kind.index;
+        _pendingValue[j] = value;
+      }
+      for (var j = 0; j < pending; j++) {
+        final jdUt = _universal(_pendingJd[j], precision);
+        if (jdUt < startUt || jdUt >= endUt) continue;
+        jds.add(jdUt);
+        eventKinds.add(_pendingKind[j]);
+        values.add(_pendingValue[j]);
+      }
+      a = b;
+    }
+
+    return SkyEvents._(
+      Float64List.fromList(jds),
+      Int8List.fromList(eventKinds),
+      Int8List.fromList(values),
+      startValues,
+      ayanamsha,
+    );
+  }
+
+  /// Complete lunar months in [events] under [convention]
+  static List<LunarMonth> months(
+    SkyEvents events, {
+    MonthConvention convention = MonthConvention.amanta,
+  }) {
+    final amanta = <LunarMonth>[];
+    var rashi = events.startRashi;
+    int? opening;
+    var sankrantis = 0;
+    var openingRashi = rashi;
+    for (var i = 0; i < events.length; i++) {
+      final kind = events.kind(i);
+      if (kind == SkyEventKind.sankranti) {
+        rashi = events.values[i];
+        sankrantis++;
+        continue;
+      }
+      if (events.values[i] != 0) continue;
+      if (opening != null) {
+        amanta.add(LunarMonth(
+          start: events.at(opening),
+          end: events.at(i),
+          index: (openingRashi + 1) % 12,
+          convention: MonthConvention.amanta,
+          adhika: sankrantis == 0,
+          kshaya: sankrantis > 1,
+        ));
+      }
+      opening = i;
+      openingRashi = rashi;
+      sankrantis = 0;
+    }
+    if (convention == MonthConvention.amanta) return amanta;
+
+    // Each purnimanta month takes the amanta month opening inside it
+    final fullMoons = events.fullMoons;
+    final purnimanta = <LunarMonth>[];
+    var m = 0;
+    for (var f = 0; f + 1 < fullMoons.length; f++) {
+      final start = fullMoons[f], end = fullMoons[f + 1];
+      while (m < amanta.length && amanta[m].start.isBefore(start)) {
+        m++;
+      }
+      if (m == amanta.length) break;
+      final month = amanta[m];
+      if (!month.start.isBefore(end)) continue;
+      purnimanta.add(LunarMonth(
+        start: start,
+        end: end,
+        index: month.index,
+        convention: MonthConvention.purnimanta,
+        adhika: month.adhika,
+        kshaya: month.kshaya,
+      ));
+    }
+    return purnimanta;
+  }
+
+  /// Lunar months overlapping the Gregorian [year], for a calendar region
+  static List<LunarMonth> year(
+    int year, {
+    required String ayanamsha,
+    MonthConvention convention = MonthConvention.amanta,
+    Precision precision = Precision.standard,
+  }) {
+    // Five weeks of margin either side so that the year's first and last
+    // months are complete
+    final events = scan(
+      DateTime.utc(year - 1, 11, 25),
+      DateTime.utc(year + 1, 2, 5),
+      ayanamsha: ayanamsha,
+      precision: precision,
+    );
+    final first = DateTime.utc(year), last = DateTime.utc(year + 1);
+    return [
+      for (final month in months(events, convention: convention))
+        if (month.end.isAfter(first) && month.start.isBefore(last)) month,
+    ];
+  }
+
+  /// Angle of [kind] in degrees, [0, 360)
+  static double _angle(
+    SkyEventKind kind,
+    double jdTt,
+    String ayanamsha,
+    Precision precision,
+  ) {
+    final sun = sunApparentLongitude(jdTt, precision: precision);
+    if (kind == SkyEventKind.sankranti) {
+      return Ayanamsha.sidereal(sun, ayanamsha, jdTt);
+    }
+    final moon = moonApparentLongitude(jdTt, precision: precision);
+    return _fromLongitudes(kind, sun, moon, ayanamsha, jdTt);
+  }
+
+  /// Angle of [kind] from tropical [sun] and [moon] longitudes
+  static double _fromLongitudes(
+    SkyEventKind kind,
+    double sun,
+    double moon,
+    String ayanamsha,
+    double jdTt,
+  ) =>
+      switch (kind) {
+        SkyEventKind.sankranti => Ayanamsha.sidereal(sun, ayanamsha, jdTt),
+        SkyEventKind.tithi => normalizeDegrees(moon - sun),
+        SkyEventKind.nakshatra => Ayanamsha.sidereal(moon, ayanamsha, jdTt),
+        SkyEventKind.yoga => normalizeDegrees(
+            sun + moon - 2 * Ayanamsha.degrees(ayanamsha, jdTt)),
+      };
+
+  /// Value of every [SkyEventKind] at the last [_sample]
+  static final Int8List _sampled = Int8List(SkyEventKind.values.length);
+
+  /// Events found within one step, before sorting into time order
+  static final Float64List _pendingJd =
+      Float64List(SkyEventKind.values.length);
+  static final Int8List _pendingKind = Int8List(SkyEventKind.values.length);
+  static final Int8List _pendingValue = Int8List(SkyEventKind.values.length);
+
+  /// Every kind's value at [jdTt] into [_sampled], at [Precision.fast]
+  /// with one Sun and one Moon evaluation
+  static void _sample(double jdTt, String ayanamsha) {
+    final sun = sunApparentLongitude(jdTt, precision: Precision.fast);
+    final moon = moonApparentLongitude(jdTt, precision: Precision.fast);
+    for (final kind in SkyEventKind.values) {
+      final angle = _fromLongitudes(kind, sun, moon, ayanamsha, jdTt);
+      _sampled[kind.index] = (angle / kind.span).floor() % kind.count;
+    }
+  }
+
+  /// Root of an angle difference [f] near [a] … [b] by the secant method;
+  /// differences are wrapped to (−180, 180] so the crossing of 0°/360°
+  /// behaves as any other
+  static double _refine(double a, double b, double Function(double) f) {
+    double wrapped(double jd) {
+      final d = f(jd) % 360;
+      return d > 180 ? d - 360 : d;
+    }
+
+    var x0 = a, x1 = b;
+    var f0 = wrapped(x0), f1 = wrapped(x1);
+    for (var i = 0; i < 10 && f1 != f0; i++) {
+      final x2 = x1 - f1 * (x1 - x0) / (f1 - f0);
+      x0 = x1;
+      f0 = f1;
+      x1 = x2;
+      if ((x1 - x0).abs() < _tolerance) break;
+      f1 = wrapped(x1);
+    }
+    return x1;
+  }
+
+  /// Julian day (UT) of a Julian day (TT), inverting [julianDayTtFromUt]
+  static double _universal(double jdTt, Precision precision) {
+    final guess = jdTt - deltaTSeconds(decimalYear(jdTt)) / 86400;
+    return jdTt - (julianDayTtFromUt(guess, precision: precision) - guess);
+  }
+}
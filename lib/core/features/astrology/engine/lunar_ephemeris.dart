@@ -0,0 +1,258 @@
+/// Lunar Ephemeris
+///
+/// Geocentric ecliptic longitude of the Moon from the truncated ELP-2000/82
+/// series in Meeus, "Astronomical Algorithms" ch. 47 (about 10" accuracy),
+/// plus nutation for the apparent longitude. The [Precision] tiers below
+/// [Precision.high] sum a truncated series through angle addition instead
+/// of one sine per term.
+library;
+
+import 'dart:typed_data';
+import 'astro_frame.dart';
+import 'astro_time.dart';
+import 'engine_math.dart' as math;
+import 'precision.dart';
+
+const double _deg = math.pi / 180;
+
+/// Normalize an angle to [0, 360)
+double normalizeDegrees(double degrees) {
+  final r = degrees % 360.0;
+  return r < 0 ? r + 360.0 : r;
+}
+
+/// Periodic terms of the Moon's longitude: D, M, M', F, Σl (1e-6 degrees)
+const List<int> _longitudeTerms = [
+  0, 0, 1, 0, 6288774, //
+  2, 0, -1, 0, 1274027,
+  2, 0, 0, 0, 658314,
+  0, 0, 2, 0, 213618,
+  0, 1, 0, 0, -185116,
+  0, 0, 0, 2, -114332,
+  2, 0, -2, 0, 58793,
+  2, -1, -1, 0, 57066,
+  2, 0, 1, 0, 53322,
+  2, -1, 0, 0, 45758,
+  0, 1, -1, 0, -40923,
+  1, 0, 0, 0, -34720,
+  0, 1, 1, 0, -30383,
+  2, 0, 0, -2, 15327,
+  0, 0, 1, 2, -12528,
+  0, 0, 1, -2, 10980,
+  4, 0, -1, 0, 10675,
+  0, 0, 3, 0, 10034,
+  4, 0, -2, 0, 8548,
+  2, 1, -1, 0, -7888,
+  2, 1, 0, 0, -6766,
+  1, 0, -1, 0, -5163,
+  1, 1, 0, 0, 4987,
+  2, -1, 1, 0, 4036,
+  2, 0, 2, 0, 3994,
+  4, 0, 0, 0, 3861,
+  2, 0, -3, 0, 3665,
+  0, 1, -2, 0, -2689,
+  2, 0, -1, 2, -2602,
+  2, -1, -2, 0, 2390,
+  1, 0, 1, 0, -2348,
+  2, -2, 0, 0, 2236,
+  0, 1, 2, 0, -2120,
+  0, 2, 0, 0, -2069,
+  2, -2, -1, 0, 2048,
+  2, 0, 1, -2, -1773,
+  2, 0, 0, 2, -1595,
+  4, -1, -1, 0, 1215,
+  0, 0, 2, 2, -1110,
+  3, 0, -1, 0, -892,
+  2, 1, 1, 0, -810,
+  4, -1, -2, 0, 759,
+  0, 2, -1, 0, -713,
+  2, 2, -1, 0, -700,
+  2, 1, -2, 0, 691,
+  2, -1, 0, -2, 596,
+  4, 0, 1, 0, 549,
+  0, 0, 4, 0, 537,
+  4, -1, 0, 0, 520,
+  1, 0, -2, 0, -487,
+  2, 1, 0, -2, -399,
+  0, 0, 2, -2, -381,
+  1, 1, 1, 0, 351,
+  3, 0, -2, 0, -340,
+  4, 0, -3, 0, 330,
+  2, -1, 2, 0, 327,
+  0, 2, 1, 0, -323,
+  1, 1, -1, 0, 299,
+  2, 0, 3, 0, 294,
+];
+
+/// Smallest amplitudes (1e-6 degrees) summed by the truncated tiers; the
+/// dropped terms, with the A2 term, add up to at most 12.1″
+/// ([Precision.standard]) and 38.2″ ([Precision.fast])
+const int _standardCutoff = 400;
+const int _fastCutoff = 1000;
+
+/// The terms of [_longitudeTerms] at or above a cutoff, as indices into
+/// [_cos]/[_sin] per argument, eccentricity powers and amplitudes
+class _TruncatedSeries {
+  final Int32List indices;
+  final Int32List eccentricity;
+  final Float64List amplitudes;
+
+  _TruncatedSeries._(this.indices, this.eccentricity, this.amplitudes);
+
+  factory _TruncatedSeries(int cutoff) {
+    final kept = [
+      for (var i = 0; i < _longitudeTerms.length; i += 5)
+        if (_longitudeTerms[i + 4].abs() >= cutoff) i,
+    ];
+    final indices = Int32List(kept.length * 4);
+    final eccentricity = Int32List(kept.length);
+    final amplitudes = Float64List(kept.length);
+    for (var k = 0; k < kept.length; k++) {
+      final i = kept[k];
+      for (var a = 0; a < 4; a++) {
+        indices[k * 4 + a] = a * _multiples + _maxMultiple +
+            _longitudeTerms[i + a];
+      }
+      eccentricity[k] = _longitudeTerms[i + 1].abs();
+      amplitudes[k] = _longitudeTerms[i + 4].toDouble();
+    }
+    return _TruncatedSeries._(indices, eccentricity, amplitudes);
+  }
+}
+
+final _TruncatedSeries _standardSeries = _TruncatedSeries(_standardCutoff);
+final _TruncatedSeries _fastSeries = _TruncatedSeries(_fastCutoff);
+
+/// Multiples −4 … 4 of D, M, M' and F
+const int _maxMultiple = 4;
+const int _multiples = 2 * _maxMultiple + 1;
+final Float64List _cos = Float64List(4 * _multiples);
+final Float64List _sin = Float64List(4 * _multiples);
+
+/// Fill row [row] of [_cos]/[_sin] with the multiples of [angle] (radians)
+/// by the angle-addition recurrence
+void _fillMultiples(int row, double angle) {
+  final zero = row * _multiples + _maxMultiple;
+  final c = math.cos(angle), s = math.sin(angle);
+  _cos[zero] = 1;
+  _sin[zero] = 0;
+  for (var k = 1; k <= _maxMultiple; k++) {
+    final pc = _cos[zero + k - 1], ps = _sin[zero + k - 1];
+    final nc = pc * c - ps * s;
+    final ns = ps * c + pc * s;
+    _cos[zero + k] = nc;
+    _sin[zero + k] = ns;
+    _cos[zero - k] = nc;
+    _sin[zero - k] = -ns;
+  }
+}
+
+/// Σ amplitude · sin(argument) of a truncated series, from the filled
+/// multiples; the sine of each four-angle sum is the imaginary part of a
+/// product of unit complex numbers
+double _truncatedSum(_TruncatedSeries series, double e) {
+  final e2 = e * e;
+  final indices = series.indices;
+  final amplitudes = series.amplitudes;
+  var sum = 0.0;
+  for (var k = 0; k < amplitudes.length; k++) {
+    final d = indices[k * 4], m = indices[k * 4 + 1];
+    final mp = indices[k * 4 + 2], f = indices[k * 4 + 3];
+    final re1 = _cos[d] * _cos[m] - _sin[d] * _sin[m];
+    final im1 = _sin[d] * _cos[m] + _cos[d] * _sin[m];
+    final re2 = _cos[mp] * _cos[f] - _sin[mp] * _sin[f];
+    final im2 = _sin[mp] * _cos[f] + _cos[mp] * _sin[f];
+    final power = series.eccentricity[k];
+    final scale = power == 0 ? 1.0 : (power == 1 ? e : e2);
+    sum += amplitudes[k] * scale * (im1 * re2 + re1 * im2);
+  }
+  return sum;
+}
+
+/// Geometric longitude of the Moon (tropical, mean equinox of date)
+double moonGeometricLongitude(
+  double jdTt, {
+  Precision precision = Precision.high,
+}) {
+  final t = julianCenturies(jdTt);
+  final t2 = t * t;
+  final t3 = t2 * t;
+  final t4 = t3 * t;
+
+  final lp = 218.3164477 +
+      481267.88123421 * t -
+      0.0015786 * t2 +
+      t3 / 538841 -
+      t4 / 65194000;
+  final d = 297.8501921 +
+      445267.1114034 * t -
+      0.0018819 * t2 +
+      t3 / 545868 -
+      t4 / 113065000;
+  final m = 357.5291092 + 35999.0502909 * t - 0.0001536 * t2 + t3 / 24490000;
+  final mp = 134.9633964 +
+      477198.8675055 * t +
+      0.0087414 * t2 +
+      t3 / 69699 -
+      t4 / 14712000;
+  final f = 93.2720950 +
+      483202.0175233 * t -
+      0.0036539 * t2 -
+      t3 / 3526000 +
+      t4 / 863310000;
+
+  // Eccentricity of Earth's orbit scales terms containing M
+  final e = 1 - 0.002516 * t - 0.0000074 * t2;
+  final a1 = 119.75 + 131.849 * t;
+  final a2 = 53.09 + 479264.290 * t;
+
+  if (precision != Precision.high) {
+    _fillMultiples(0, d * _deg);
+    _fillMultiples(1, m * _deg);
+    _fillMultiples(2, mp * _deg);
+    _fillMultiples(3, f * _deg);
+    final sum = _truncatedSum(
+            precision == Precision.fast ? _fastSeries : _standardSeries, e) +
+        3958 * math.sin(a1 * _deg) +
+        1962 * math.sin((lp - f) * _deg);
+    return normalizeDegrees(lp + sum / 1e6);
+  }
+
+  var sum = 0.0;
+  for (var i = 0; i < _longitudeTerms.length; i += 5) {
+    final cm = _longitudeTerms[i + 1];
+    final arg = (_longitudeTerms[i] * d +
+            cm * m +
+            _longitudeTerms[i + 2] * mp +
+            _longitudeTerms[i + 3] * f) *
+        _deg;
+    var coefficient = _longitudeTerms[i + 4].toDouble();
+    if (cm == 1 || cm == -1) {
+      coefficient *= e;
+    } else if (cm == 2 || cm == -2) {
+      coefficient *= e * e;
+    }
+    sum += coefficient * math.sin(arg);
+  }
+  sum += 3958 * math.sin(a1 * _deg) +
+      1962 * math.sin((lp - f) * _deg) +
+      318 * math.sin(a2 * _deg);
+
+  return normalizeDegrees(lp + sum / 1e6);
+}
+
+/// Nutation in longitude in degrees, from the [AstroFrame] of [jdTt]
+/// (the IAU 1980 series; its two largest terms for [Precision.fast])
+double nutationInLongitude(
+  double jdTt, {
+  Precision precision = Precision.high,
+}) =>
+    AstroFrame.of(jdTt, precision: precision).nutationLongitude;
+
+/// Apparent tropical longitude of the Moon (true equinox of date)
+double moonApparentLongitude(
+  double jdTt, {
+  Precision precision = Precision.high,
+}) =>
+    normalizeDegrees(moonGeometricLongitude(jdTt, precision: precision) +
+        nutationInLongitude(jdTt, precision: precision));
@@ -0,0 +1,132 @@
+/// Natal Chart
+///
+/// Sidereal longitudes of the nine grahas and the lagna at birth, with the
+/// grahas' daily motion and the birth instant and place: the input of the
+/// transit, strength and varga engines. Computed once per profile.
+library;
+
+import 'dart:typed_data';
+import 'astro_time.dart';
+import 'ayanamsha.dart';
+import 'fingerprint.dart';
+import 'lagna.dart';
+import 'planetary_ephemeris.dart';
+
+/// Sidereal natal positions
+class NatalChart {
+  /// Index of the lagna in [longitudes], after the nine grahas
+  static const int lagna = 9;
+
+  /// Number of [longitudes]
+  static const int points = 10;
+
+  /// Length of [toList]
+  static const int serializedLength = points + 9 + 4;
+
+  /// Sidereal longitudes in degrees, in [Graha] order, then the lagna
+  final Float64List longitudes;
+
+  /// Daily motion of the nine grahas in degrees; negative when retrograde
+  final Float64List speeds;
+
+  /// Birth instant as a Julian day (UT)
+  final double jdUt;
+
+  /// Birth place in degrees, east positive
+  final double latitude;
+  final double eastLongitude;
+
+  /// Ayanamsha at birth in degrees (sidereal = tropical − ayanamsha)
+  final double ayanamshaDegrees;
+
+  NatalChart(
+    this.longitudes, {
+    Float64List? speeds,
+    this.jdUt = j2000,
+    this.latitude = 0,
+    this.eastLongitude = 0,
+    this.ayanamshaDegrees = 0,
+  })  : speeds = speeds ?? Float64List(Graha.values.length),
+        assert(longitudes.length == points);
+
+  /// Compute for a birth instant in UTC and place (degrees, east positive)
+  factory NatalChart.compute({
+    required DateTime birthUtc,
+    required double latitude,
+    required double longitude,
+    required String ayanamsha,
+  }) {
+    final jdUt = julianDayUt(birthUtc);
+    final jdTt = julianDayTt(birthUtc);
+    final ayanamshaDegrees = Ayanamsha.degrees(ayanamsha, jdTt);
+
+    final out = Float64List(points);
+    grahaLongitudes(jdTt, out);
+    out[lagna] = ascendantLongitude(jdUt, latitude, longitude);
+    for (var i = 0; i < points; i++) {
+      out[i] = Ayanamsha.sidereal(out[i], ayanamsha, jdTt);
+    }
+
+    // Daily motion from a day-wide central difference
+    final grahas = Graha.values.length;
+    final before = Float64List(grahas);
+    final after = Float64List(grahas);
+    grahaLongitudes(jdTt - 0.5, before);
+    grahaLongitudes(jdTt + 0.5, after);
+    final speeds = Float64List(grahas);
+    for (var i = 0; i < grahas; i++) {
+      var delta = (after[i] - before[i]) % 360;
+      if (delta > 180) delta -= 360;
+      speeds[i] = delta;
+    }
+
+    return NatalChart(
+      out,
+      speeds: speeds,
+      jdUt: jdUt,
+      latitude: latitude,
+      eastLongitude: longitude,
+      ayanamshaDegrees: ayanamshaDegrees,
+    );
+  }
+
+  /// Restore from [toList]
+  factory NatalChart.fromList(List<dynamic> values) {
+    final all = [for (final v in values) (v as num).toDouble()];
+    if (all.length != serializedLength) {
+      throw FormatException('Natal chart of ${all.length} values');
+    }
+    const grahas = points + 9;
+    return NatalChart(
+      Float64List.fromList(all.sublist(0, points)),
+      speeds: Float64List.fromList(all.sublist(points, grahas)),
+      jdUt: all[grahas],
+      latitude: all[grahas + 1],
+      eastLongitude: all[grahas + 2],
+      ayanamshaDegrees: all[grahas + 3],
+    );
+  }
+
+  List<double> toList() => [
+        ...longitudes,
+        ...speeds,
+        jdUt,
+        latitude,
+        eastLongitude,
+        ayanamshaDegrees,
+      ];
+
+  /// Content fingerprint of [toList]
+  String get fingerprint => EngineFingerprint.ofDoubles(toList());
+
+  double longitude(Graha graha) => longitudes[graha.index];
+
+  double get lagnaLongitude => longitudes[lagna];
+
+  /// 0-based sign of point [index] ([Graha.index] or [lagna])
+  int rashi(int index) => (longitudes[index] / 30).floor() % 12;
+
+  /// Signs of all points, in [longitudes] order
+  Int8List get rashis =>
+      Int8List.fromList([for (var i = 0; i < points; i++) rashi(i)]);
+}
@@ -0,0 +1,281 @@
+/// Panchang
+///
+/// The five limbs of the day (vaara, tithi, nakshatra, yoga, karana) at
+/// sunrise, with sunrise, sunset and the times the tithi, nakshatra and
+/// yoga end, for many locations and dates in one call.
+///
+/// Everything that does not depend on the place is computed once: one
+/// [LunarCalendar.scan] gives every tithi, nakshatra and yoga boundary of
+/// the range, and one [EphemerisCache] day fit gives the Sun and Moon at
+/// any instant of a day. Per location and date only sunrise and sunset are
+/// solved (a few interpolated Sun positions each) and the boundaries are
+/// looked up by binary search, so a batch costs one sweep plus a small
+/// constant per location-day.
+library;
+
+import 'dart:typed_data';
+import 'astro_time.dart';
+import 'engine_math.dart' as math;
+import 'ephemeris_cache.dart';
+import 'lagna.dart';
+import 'lunar_calendar.dart';
+import 'lunar_ephemeris.dart';
+import 'planetary_ephemeris.dart';
+import 'precision.dart';
+
+const double _deg = math.pi / 180;
+
+/// A place for the panchang, in degrees (east positive)
+class PanchangLocation {
+  final double latitude;
+  final double longitude;
+
+  const PanchangLocation(this.latitude, this.longitude);
+}
+
+/// Karanas: the seven movable ones, then the four fixed ones
+enum Karana {
+  bava,
+  balava,
+  kaulava,
+  taitila,
+  garaja,
+  vanija,
+  vishti,
+  shakuni,
+  chatushpada,
+  naga,
+  kimstughna;
+
+  /// Karana of the half-tithi [half], 0 … 59 from the new moon
+  static Karana ofHalf(int half) {
+    if (half == 0) return kimstughna;
+    if (half >= 57) return Karana.values[half - 57 + shakuni.index];
+    return Karana.values[(half - 1) % 7];
+  }
+}
+
+/// The panchang of one location on one date
+class PanchangDay {
+  final PanchangLocation location;
+
+  /// Civil date at the location
+  final DateTime date;
+
+  /// Sunrise and sunset in UTC; null where the Sun does not rise or set
+  final DateTime? sunrise;
+  final DateTime? sunset;
+
+  /// Weekday, 0 (Sunday) … 6 (Saturday)
+  final int vaara;
+
+  /// Values at sunrise (at local noon where the Sun does not rise), as
+  /// [SkyEventKind] values
+  final int tithi;
+  final int nakshatra;
+  final int yoga;
+  final Karana karana;
+
+  /// When the tithi, nakshatra and yoga current at sunrise end, UTC
+  final DateTime? tithiEnd;
+  final DateTime? nakshatraEnd;
+  final DateTime? yogaEnd;
+
+  const PanchangDay({
+    required this.location,
+    required this.date,
+    required this.sunrise,
+    required this.sunset,
+    required this.vaara,
+    required this.tithi,
+    required this.nakshatra,
+    required this.yoga,
+    required this.karana,
+    required this.tithiEnd,
+    required this.nakshatraEnd,
+    required this.yogaEnd,
+  });
+}
+
+/// Locations × dates panchang
+class PanchangTable {
+  final List<PanchangLocation> locations;
+
+  /// First civil date
+  final DateTime start;
+
+  final int days;
+
+  /// Per cell: Julian days (UT) of sunrise, sunset, tithi end, nakshatra
+  /// end and yoga end, NaN when absent
+  final Float64List times;
+
+  /// Per cell: vaara, tithi, nakshatra, yoga and karana
+  final Int8List values;
+
+  static const int stride = 5;
+
+  PanchangTable(this.locations, this.start, this.days)
+      : times = Float64List(locations.length * days * stride),
+        values = Int8List(locations.length * days * stride);
+
+  /// Cell of [location] on the [day]th date
+  int cell(int location, int day) => (location * days + day) * stride;
+
+  PanchangDay day(int location, int day) {
+    final base = cell(location, day);
+    DateTime? time(int i) {
+      final jd = times[base + i];
+      return jd.isNaN ? null : dateTimeFromJulianDay(jd);
+    }
+
+    return PanchangDay(
+      location: locations[location],
+      date: DateTime.utc(start.year, start.month, start.day + day),
+      sunrise: time(0),
+      sunset: time(1),
+      vaara: values[base],
+      tithi: values[base + 1],
+      nakshatra: values[base + 2],
+      yoga: values[base + 3],
+      karana: Karana.values[values[base + 4]],
+      tithiEnd: time(2),
+      nakshatraEnd: time(3),
+      yogaEnd: time(4),
+    );
+  }
+}
+
+/// Panchang
+class Panchang {
+  Panchang._();
+
+  /// Altitude of the Sun's upper limb at rising and setting: refraction
+  /// 34′ and semi-diameter 16′ below the horizon
+  static const double _horizon = -0.8333;
+
+  /// Panchang of every location on [days] civil dates from [start]
+  ///
+  /// [events], when given, replaces the batch's own sweep so that one scan
+  /// can also feed month naming: it must hold tithi, nakshatra and yoga
+  /// events from two days before [start] to three days after the last date.
+  static PanchangTable batch(
+    List<PanchangLocation> locations, {
+    required DateTime start,
+    required int days,
+    required String ayanamsha,
+    Precision precision = Precision.high,
+    SkyEvents? events,
+  }) {
+    final table = PanchangTable(
+        locations, DateTime.utc(start.year, start.month, start.day), days);
+
+    // Location-independent: every boundary from two days before the first
+    // date (the values at its earliest sunrise) to three days after the
+    // last (the ends of its latest limbs)
+    final first = table.start;
+    events ??= LunarCalendar.scan(
+      first.subtract(const Duration(days: 2)),
+      first.add(Duration(days: days + 3)),
+      ayanamsha: ayanamsha,
+      precision: precision,
+      kinds: const {
+        SkyEventKind.tithi,
+        SkyEventKind.nakshatra,
+        SkyEventKind.yoga,
+      },
+    );
+    final sun = EphemerisCache(capacity: 4);
+
+    // Day-major so that the Sun's day fits are reused across locations
+    for (var day = 0; day < days; day++) {
+      final date = DateTime.utc(first.year, first.month, first.day + day);
+      final midnightUt = julianDayUt(date);
+      final vaara = date.weekday % 7;
+      for (var l = 0; l < locations.length; l++) {
+        final location = locations[l];
+        // Local mean midnight of the date
+        final midnight = midnightUt - location.longitude / 360;
+        final sunrise = _sunEvent(sun, midnight + 0.25, location, true);
+        final sunset = _sunEvent(sun, midnight + 0.75, location, false);
+        final at = sunrise.isNaN ? midnight + 0.5 : sunrise;
+
+        final base = table.cell(l, day);
+        table.times[base] = sunrise;
+        table.times[base + 1] = sunset;
+        table.times[base + 2] = events.nextAfter(SkyEventKind.tithi, at);
+        table.times[base + 3] = events.nextAfter(SkyEventKind.nakshatra, at);
+        table.times[base + 4] = events.nextAfter(SkyEventKind.yoga, at);
+
+        final tithi = events.valueAt(SkyEventKind.tithi, at);
+        table.values[base] = vaara;
+        table.values[base + 1] = tithi;
+        table.values[base + 2] = events.valueAt(SkyEventKind.nakshatra, at);
+        table.values[base + 3] = events.valueAt(SkyEventKind.yoga, at);
+        table.values[base + 4] = _karana(sun, tithi, at).index;
+      }
+    }
+    return table;
+  }
+
+  /// Panchang of one location on one date
+  static PanchangDay single(
+    PanchangLocation location, {
+    required DateTime date,
+    required String ayanamsha,
+    Precision precision = Precision.high,
+  }) =>
+      batch(
+        [location],
+        start: date,
+        days: 1,
+        ayanamsha: ayanamsha,
+        precision: precision,
+      ).day(0, 0);
+
+  /// Karana at [jdUt] within [tithi]: the tithi's first or second half
+  static Karana _karana(EphemerisCache cache, int tithi, double jdUt) {
+    final jdTt = julianDayTtFromUt(jdUt);
+    final elongation = normalizeDegrees(
+        cache.longitude(Graha.moon, jdTt) - cache.longitude(Graha.sun, jdTt));
+    // The cached elongation decides only the half; the tithi itself comes
+    // from the refined boundaries
+    final into = normalizeDegrees(elongation - tithi * 12);
+    return Karana.ofHalf(tithi * 2 + (into >= 6 && into < 12 ? 1 : 0));
+  }
+
+  /// Julian day (UT) of sunrise ([rising]) or sunset nearest [guess], or
+  /// NaN when the Sun stays above or below the horizon
+  static double _sunEvent(
+    EphemerisCache cache,
+    double guess,
+    PanchangLocation location,
+    bool rising,
+  ) {
+    final phi = location.latitude * _deg;
+    var jd = guess;
+    for (var i = 0; i < 5; i++) {
+      final jdTt = julianDayTtFromUt(jd);
+      final lambda = cache.longitude(Graha.sun, jdTt) * _deg;
+      final epsilon = meanObliquity(jdTt) * _deg;
+      final rightAscension = math.atan2(
+              math.cos(epsilon) * math.sin(lambda), math.cos(lambda)) /
+          _deg;
+      final sinDeclination = math.sin(epsilon) * math.sin(lambda);
+      final cosDeclination = math.sqrt(1 - sinDeclination * sinDeclination);
+
+      final cosHour = (math.sin(_horizon * _deg) -
+              math.sin(phi) * sinDeclination) /
+          (math.cos(phi) * cosDeclination);
+      if (cosHour < -1 || cosHour > 1) return double.nan;
+      final hour = math.acos(cosHour) / _deg;
+
+      final local = greenwichSiderealTime(jd) + location.longitude;
+      var delta = (rising ? -hour : hour) - (local - rightAscension);
+      delta = (delta + 540) % 360 - 180;
+      jd += delta / siderealDegreesPerDay;
+      if (delta.abs() < 1e-4) break;
+    }
+    return jd;
+  }
+}
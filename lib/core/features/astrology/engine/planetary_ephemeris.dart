@@ -0,0 +1,244 @@
+/// Planetary Ephemeris
+///
+/// Geocentric longitudes of the nine grahas. The Sun and planets come from
+/// the Keplerian elements of Standish, "Keplerian Elements for Approximate
+/// Positions of the Major Planets" (JPL, 1800–2050), with light-time,
+/// annual aberration, precession and nutation from the [AstroFrame]; the
+/// Moon from [moonApparentLongitude]; Rahu and Ketu from the mean lunar
+/// node. Errors are under a minute of arc for the Sun and inner planets and
+/// a few minutes for Jupiter and Saturn, well inside what sign, house and
+/// nakshatra placement need. Below [Precision.high], light-time comes from
+/// the planet's orbital velocity instead of a second orbit evaluation.
+library;
+
+import 'dart:typed_data';
+import 'astro_frame.dart';
+import 'astro_time.dart';
+import 'engine_math.dart' as math;
+import 'lunar_ephemeris.dart';
+import 'precision.dart';
+
+const double _deg = math.pi / 180;
+
+/// The nine grahas: the weekday lords, then the lunar nodes
+enum Graha { sun, moon, mars, mercury, jupiter, venus, saturn, rahu, ketu }
+
+// Bodies in [_elements]
+const int _mercury = 0;
+const int _venus = 1;
+const int _earth = 2;
+const int _mars = 3;
+const int _jupiter = 4;
+const int _saturn = 5;
+
+/// a (AU), e, I, L, long. perihelion, long. node (degrees) at J2000, then
+/// their rates per Julian century; ecliptic and equinox of J2000
+const List<double> _elements = [
+  // Mercury
+  0.38709927, 0.20563593, 7.00497902, 252.25032350, 77.45779628, //
+  48.33076593,
+  0.00000037, 0.00001906, -0.00594749, 149472.67411175, 0.16047689, //
+  -0.12534081,
+  // Venus
+  0.72333566, 0.00677672, 3.39467605, 181.97909950, 131.60246718, //
+  76.67984255,
+  0.00000390, -0.00004107, -0.00078890, 58517.81538729, 0.00268329, //
+  -0.27769418,
+  // Earth-Moon barycentre
+  1.00000261, 0.01671123, -0.00001531, 100.46457166, 102.93768193, 0.0, //
+  0.00000562, -0.00004392, -0.01294668, 35999.37244981, 0.32327364, 0.0,
+  // Mars
+  1.52371034, 0.09339410, 1.84969142, -4.55343205, -23.94362959, //
+  49.55953891,
+  0.00001847, 0.00007882, -0.00813131, 19140.30268499, 0.44441088, //
+  -0.29257343,
+  // Jupiter
+  5.20288700, 0.04838624, 1.30439695, 34.39644051, 14.72847983, //
+  100.47390909,
+  -0.00011607, -0.00013253, -0.00183714, 3034.74612775, 0.21252668, //
+  0.20469106,
+  // Saturn
+  9.53667594, 0.05386179, 2.48599187, 49.95424423, 92.59887831, //
+  113.66242448,
+  -0.00125060, -0.00050991, 0.00193609, 1222.49362201, -0.41897216, //
+  -0.28867794,
+];
+
+/// Light travel time per AU, in Julian centuries
+const double _lightTimePerAu = 0.0057755183 / daysPerCentury;
+
+/// Constant of aberration in degrees
+const double _aberration = 20.49552 / 3600;
+
+/// Heliocentric ecliptic coordinates (J2000) of [body] into [out]; with
+/// [velocity], its velocity in AU per Julian century into out[3 … 5]
+void _heliocentric(
+  int body,
+  double t,
+  Float64List out, {
+  bool velocity = false,
+}) {
+  final base = body * 12;
+  double element(int i) => _elements[base + i] + _elements[base + 6 + i] * t;
+
+  final a = element(0);
+  final e = element(1);
+  final inclination = element(2) * _deg;
+  final meanLongitude = element(3);
+  final perihelion = element(4);
+  final node = element(5) * _deg;
+  final argument = perihelion * _deg - node;
+
+  var m = (meanLongitude - perihelion) % 360;
+  if (m > 180) m -= 360;
+  m *= _deg;
+
+  // Kepler's equation by Newton's method; e < 0.21 converges in a few steps
+  var eccentricAnomaly = m + e * math.sin(m);
+  for (var i = 0; i < 6; i++) {
+    final delta = (eccentricAnomaly - e * math.sin(eccentricAnomaly) - m) /
+        (1 - e * math.cos(eccentricAnomaly));
+    eccentricAnomaly -= delta;
+    if (delta.abs() < 1e-10) break;
+  }
+
+  final xp = a * (math.cos(eccentricAnomaly) - e);
+  final yp = a * math.sqrt(1 - e * e) * math.sin(eccentricAnomaly);
+
+  final cw = math.cos(argument), sw = math.sin(argument);
+  final cn = math.cos(node), sn = math.sin(node);
+  final ci = math.cos(inclination), si = math.sin(inclination);
+  out[0] = (cw * cn - sw * sn * ci) * xp + (-sw * cn - cw * sn * ci) * yp;
+  out[1] = (cw * sn + sw * cn * ci) * xp + (-sw * sn + cw * cn * ci) * yp;
+  out[2] = sw * si * xp + cw * si * yp;
+  if (!velocity) return;
+
+  // dE/dt from Kepler's equation, with the mean motion in radians
+  final meanMotion = (_elements[base + 9] - _elements[base + 10]) * _deg;
+  final rate = meanMotion / (1 - e * math.cos(eccentricAnomaly));
+  final vxp = -a * math.sin(eccentricAnomaly) * rate;
+  final vyp = a * math.sqrt(1 - e * e) * math.cos(eccentricAnomaly) * rate;
+  out[3] = (cw * cn - sw * sn * ci) * vxp + (-sw * cn - cw * sn * ci) * vyp;
+  out[4] = (cw * sn + sw * cn * ci) * vxp + (-sw * sn + cw * cn * ci) * vyp;
+  out[5] = sw * si * vxp + cw * si * vyp;
+}
+
+final Float64List _earthXyz = Float64List(3);
+final Float64List _bodyXyz = Float64List(6);
+
+/// Apparent geocentric longitude (mean ecliptic and equinox of date) of a
+/// planet, with one light-time iteration; below [Precision.high] the
+/// retarded position is extrapolated from the velocity (second-order error
+/// under 0.1″)
+double _planetLongitude(
+  int body,
+  double t,
+  Precision precision,
+  AstroFrame frame,
+) {
+  final extrapolate = precision != Precision.high;
+  _heliocentric(body, t, _bodyXyz, velocity: extrapolate);
+  var dx = _bodyXyz[0] - _earthXyz[0];
+  var dy = _bodyXyz[1] - _earthXyz[1];
+  var dz = _bodyXyz[2] - _earthXyz[2];
+  final distance = math.sqrt(dx * dx + dy * dy + dz * dz);
+
+  if (extrapolate) {
+    final lightTime = distance * _lightTimePerAu;
+    dx -= _bodyXyz[3] * lightTime;
+    dy -= _bodyXyz[4] * lightTime;
+    dz -= _bodyXyz[5] * lightTime;
+    return frame.longitudeOfDate(dx, dy, dz);
+  }
+
+  _heliocentric(body, t - distance * _lightTimePerAu, _bodyXyz);
+  dx = _bodyXyz[0] - _earthXyz[0];
+  dy = _bodyXyz[1] - _earthXyz[1];
+  dz = _bodyXyz[2] - _earthXyz[2];
+  return frame.longitudeOfDate(dx, dy, dz);
+}
+
+/// Mean longitude of the Moon's ascending node (Meeus 47.7)
+double meanLunarNode(double jdTt) {
+  final t = julianCenturies(jdTt);
+  return normalizeDegrees(125.0445479 -
+      1934.1362891 * t +
+      0.0020754 * t * t +
+      t * t * t / 467441 -
+      t * t * t * t / 60616000);
+}
+
+/// Apparent longitude of the Sun on the true equinox of [frame], from
+/// Earth's position in [_earthXyz]
+double _sunLongitude(AstroFrame frame) =>
+    frame.longitudeOfDate(-_earthXyz[0], -_earthXyz[1], -_earthXyz[2]) +
+    frame.nutationLongitude -
+    _aberration;
+
+/// Apparent tropical longitudes (true equinox of date) of all nine grahas at
+/// [jdTt], written to [out] in [Graha] order
+///
+/// Earth's position and the [AstroFrame] are evaluated once for all bodies;
+/// callers sweeping many instants reuse [out].
+void grahaLongitudes(
+  double jdTt,
+  Float64List out, {
+  Precision precision = Precision.high,
+}) {
+  final t = julianCenturies(jdTt);
+  final frame = AstroFrame.of(jdTt, precision: precision);
+  final nutation = frame.nutationLongitude;
+
+  _heliocentric(_earth, t, _earthXyz);
+
+  double planet(int body) => normalizeDegrees(
+      _planetLongitude(body, t, precision, frame) + nutation - _aberration);
+
+  final node = meanLunarNode(jdTt) + nutation;
+  out[Graha.sun.index] = normalizeDegrees(_sunLongitude(frame));
+  out[Graha.moon.index] =
+      moonApparentLongitude(jdTt, precision: precision);
+  out[Graha.mars.index] = planet(_mars);
+  out[Graha.mercury.index] = planet(_mercury);
+  out[Graha.jupiter.index] = planet(_jupiter);
+  out[Graha.venus.index] = planet(_venus);
+  out[Graha.saturn.index] = planet(_saturn);
+  out[Graha.rahu.index] = normalizeDegrees(node);
+  out[Graha.ketu.index] = normalizeDegrees(node + 180);
+}
+
+/// Apparent tropical longitude of one graha
+double grahaLongitude(
+  Graha graha,
+  double jdTt, {
+  Precision precision = Precision.high,
+}) {
+  final out = Float64List(Graha.values.length);
+  grahaLongitudes(jdTt, out, precision: precision);
+  return out[graha.index];
+}
+
+/// Apparent tropical longitude of the Sun alone, for the panchang
+///
+/// [Precision.fast] uses the low-accuracy solar theory of Meeus ch. 25
+/// (about 0.01°) instead of Earth's orbit.
+double sunApparentLongitude(
+  double jdTt, {
+  Precision precision = Precision.high,
+}) {
+  final t = julianCenturies(jdTt);
+  if (precision == Precision.fast) {
+    final l0 = 280.46646 + 36000.76983 * t + 0.0003032 * t * t;
+    final m = (357.52911 + 35999.05029 * t - 0.0001537 * t * t) * _deg;
+    final centre =
+        (1.914602 - 0.004817 * t - 0.000014 * t * t) * math.sin(m) +
+            (0.019993 - 0.000101 * t) * math.sin(2 * m) +
+            0.000289 * math.sin(3 * m);
+    final omega = (125.04 - 1934.136 * t) * _deg;
+    return normalizeDegrees(
+        l0 + centre - 0.00569 - 0.00478 * math.sin(omega));
+  }
+  _heliocentric(_earth, t, _earthXyz);
+  return normalizeDegrees(
+      _sunLongitude(AstroFrame.of(jdTt, precision: precision)));
+}
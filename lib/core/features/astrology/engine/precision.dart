@@ -0,0 +1,25 @@
+/// Precision
+///
+/// Accuracy tiers of the astronomy engine. A tier chooses how much of the
+/// lunar series is summed, which nutation terms are applied, how light-time
+/// is handled for the planets and whether delta-T carries the lunar
+/// secular acceleration correction. Bounds are against [Precision.high].
+library;
+
+/// Accuracy tier of an ephemeris or panchang call
+enum Precision {
+  /// Calendar cells and heatmaps: every graha within 1.5′. Lunar terms of
+  /// 0.001° and more, two nutation terms and the low-accuracy solar theory
+  /// for the Sun alone, which skips Earth's orbit.
+  fast,
+
+  /// Transit views: every graha within 15″. Lunar terms of 0.0004° and
+  /// more and light-time extrapolated from the planet's velocity.
+  standard,
+
+  /// Birth charts near sign boundaries: the full lunar series, light-time
+  /// by re-evaluating the orbit and delta-T corrected to the ELP-2000/82
+  /// lunar acceleration. Standard and high apply the full IAU 1980
+  /// nutation series.
+  high,
+}
@@ -0,0 +1,375 @@
+/// Birth-time Rectification
+///
+/// Sweeps a window around a guessed birth instant and scores every instant
+/// against the native's life events: the Vimshottari maha and antar dasha
+/// lords running at an event should signify the event's houses, from the
+/// lagna (by lordship, occupation or as karaka) and from the navamsa lagna
+/// (by lordship). Consecutive instants with the same lagna, navamsa lagna
+/// and dasha periods form one [RectificationCandidate].
+///
+/// The sweep is incremental: the sidereal time advances linearly, the
+/// obliquity, nutation and ayanamsha are held for the window, and the
+/// grahas follow a quadratic through its start, middle and end, stepped by
+/// finite differences. Ranges of instants evaluate independently, so the
+/// window can be split across isolates.
+library;
+
+import 'dart:typed_data';
+import 'astro_frame.dart';
+import 'astro_time.dart';
+import 'ayanamsha.dart';
+import 'lagna.dart';
+import 'planetary_ephemeris.dart';
+import 'vimshottari.dart';
+
+/// Kinds of life event a native can date
+enum LifeEventKind {
+  marriage,
+  childbirth,
+  career,
+  education,
+  relocation,
+  health,
+}
+
+/// A dated life event
+class LifeEvent {
+  final LifeEventKind kind;
+  final DateTime date;
+
+  const LifeEvent(this.kind, this.date);
+}
+
+/// A run of instants with the same lagna, navamsa lagna and periods
+class RectificationCandidate {
+  final DateTime startUtc;
+
+  /// Last instant of the run
+  final DateTime endUtc;
+
+  /// 0-based signs
+  final int lagnaSign;
+  final int navamsaSign;
+
+  /// Points for every event whose periods signify it; higher is better
+  final int score;
+
+  const RectificationCandidate(
+    this.startUtc,
+    this.endUtc,
+    this.lagnaSign,
+    this.navamsaSign,
+    this.score,
+  );
+
+  DateTime get middleUtc => startUtc.add(endUtc.difference(startUtc) ~/ 2);
+}
+
+/// Evaluated instants `from` … `from + length − 1` of a sweep
+class RectificationChunk {
+  final int from;
+  final Int8List lagna;
+  final Int8List navamsa;
+  final Int16List score;
+
+  /// `maha * 9 + antar` per instant and event
+  final Int8List periods;
+
+  RectificationChunk(this.from, int length, int events)
+      : lagna = Int8List(length),
+        navamsa = Int8List(length),
+        score = Int16List(length),
+        periods = Int8List(length * events);
+
+  int get length => lagna.length;
+}
+
+const int _grahas = 9;
+
+/// Sign lords as [Graha] indices, Aries … Pisces
+const List<int> _signLords = [2, 5, 3, 1, 0, 3, 5, 2, 4, 6, 6, 4];
+
+/// [Graha] index of each [Vimshottari.lords] entry
+const List<int> _dashaGrahas = [8, 5, 0, 1, 2, 7, 4, 6, 3];
+
+/// Houses and karaka per [LifeEventKind]
+const List<List<int>> _eventHouses = [
+  [7, 2], // marriage
+  [5, 9], // childbirth
+  [10, 6], // career
+  [4, 5], // education
+  [4, 12], // relocation
+  [6, 8], // health
+];
+const List<int> _eventKarakas = [5, 4, 0, 3, 7, 6];
+
+/// A sweep over a window of birth instants
+class RectificationSweep {
+  /// First instant
+  final DateTime startUtc;
+
+  /// [startUtc] as a Julian day (UT)
+  final double startJdUt;
+
+  final int stepSeconds;
+
+  /// Number of instants, start and end included
+  final int instants;
+
+  final double latitude;
+
+  /// Local apparent sidereal time at the first instant, degrees
+  final double ramc;
+  final double obliquity;
+  final double ayanamshaDegrees;
+
+  /// Per graha: tropical longitude at instant 0 and the quadratic's linear
+  /// and square coefficients per step
+  final Float64List _base;
+  final Float64List _linear;
+  final Float64List _square;
+
+  /// Event kinds and Julian days (UT)
+  final Int8List _eventKinds;
+  final Float64List _eventDays;
+
+  RectificationSweep._(
+    this.startUtc,
+    this.startJdUt,
+    this.stepSeconds,
+    this.instants,
+    this.latitude,
+    this.ramc,
+    this.obliquity,
+    this.ayanamshaDegrees,
+    this._base,
+    this._linear,
+    this._square,
+    this._eventKinds,
+    this._eventDays,
+  );
+
+  /// A window of ±[radius] around [guessUtc] at [stepSeconds] resolution,
+  /// at a birth place in degrees (east positive)
+  factory RectificationSweep.around({
+    required DateTime guessUtc,
+    required double latitude,
+    required double longitude,
+    required String ayanamsha,
+    required List<LifeEvent> events,
+    Duration radius = const Duration(hours: 2),
+    int stepSeconds = 10,
+  }) {
+    final half = radius.inSeconds ~/ stepSeconds;
+    final startUtc = guessUtc.subtract(Duration(seconds: half * stepSeconds));
+    final startJdUt = julianDayUt(startUtc);
+    final jdTt = julianDayTt(guessUtc);
+
+    // Held for the window: under 0.01″ of change in four hours
+    final frame = AstroFrame.of(jdTt);
+    final obliquity = frame.trueObliquity;
+    final ramc = greenwichSiderealTime(startJdUt) +
+        frame.equationOfEquinoxes +
+        longitude;
+
+    // Quadratic through the start, middle and end of the window
+    final span = half * stepSeconds / 86400;
+    final startTt = julianDayTt(startUtc);
+    final y0 = Float64List(_grahas);
+    final y1 = Float64List(_grahas);
+    final y2 = Float64List(_grahas);
+    grahaLongitudes(startTt, y0);
+    grahaLongitudes(startTt + span, y1);
+    grahaLongitudes(startTt + 2 * span, y2);
+    final linear = Float64List(_grahas);
+    final square = Float64List(_grahas);
+    for (var g = 0; g < _grahas; g++) {
+      final d1 = _wrap(y1[g] - y0[g]);
+      final d2 = _wrap(y2[g] - y1[g]);
+      final c = half == 0 ? 0.0 : (d2 - d1) / (2 * half * half);
+      square[g] = c;
+      linear[g] = half == 0 ? 0.0 : d1 / half - c * half;
+    }
+
+    return RectificationSweep._(
+      startUtc,
+      startJdUt,
+      stepSeconds,
+      2 * half + 1,
+      latitude,
+      ramc,
+      obliquity,
+      Ayanamsha.degrees(ayanamsha, jdTt),
+      y0,
+      linear,
+      square,
+      Int8List.fromList([for (final event in events) event.kind.index]),
+      Float64List.fromList(
+          [for (final event in events) julianDayUt(event.date.toUtc())]),
+    );
+  }
+
+  int get events => _eventKinds.length;
+
+  /// UTC instant of index [i]
+  DateTime instant(int i) => startUtc.add(Duration(seconds: i * stepSeconds));
+
+  /// Evaluate instants [from] … [to] − 1
+  RectificationChunk evaluate(int from, int to) {
+    final chunk = RectificationChunk(from, to - from, events);
+    final stepDays = stepSeconds / 86400;
+    final ramcStep = siderealDegreesPerDay * stepDays;
+
+    // Longitudes and first differences at [from]; the second difference of
+    // a quadratic is constant
+    final longitude = Float64List(_grahas);
+    final delta = Float64List(_grahas);
+    for (var g = 0; g < _grahas; g++) {
+      final c = _square[g];
+      longitude[g] = _base[g] + _linear[g] * from + c * from * from;
+      delta[g] = _linear[g] + c * (2 * from + 1);
+    }
+
+    final signs = Int8List(_grahas)..fillRange(0, _grahas, -1);
+    var lagnaSign = -1;
+    var navamsaSign = -1;
+    var houseMasks = Int32List(0);
+    var navamsaMasks = Int32List(0);
+
+    for (var k = 0; k < chunk.length; k++) {
+      final i = from + k;
+      final lagna = _sidereal(ascendantFromRamc(
+          ramc + ramcStep * i, obliquity, latitude));
+      final lagnaNow = lagna ~/ 30;
+      final navamsaNow = (lagna * 9 / 30).floor() % 12;
+
+      var changed = lagnaNow != lagnaSign || navamsaNow != navamsaSign;
+      for (var g = 0; g < _grahas; g++) {
+        final sign = _sidereal(longitude[g]) ~/ 30;
+        if (sign != signs[g]) {
+          signs[g] = sign;
+          changed = true;
+        }
+      }
+      // Significators change only with a sign; most instants reuse them
+      if (changed) {
+        lagnaSign = lagnaNow;
+        navamsaSign = navamsaNow;
+        houseMasks = _significators(lagnaSign, signs, true);
+        navamsaMasks = _significators(navamsaSign, signs, false);
+      }
+
+      final moon = _sidereal(longitude[Graha.moon.index]);
+      final birth = startJdUt + stepDays * i;
+      var score = 0;
+      for (var e = 0; e < events; e++) {
+        final period = Vimshottari.periodIndex(moon, _eventDays[e] - birth);
+        chunk.periods[k * events + e] = period;
+        final houses = houseMasks[_eventKinds[e]];
+        final navamsa = navamsaMasks[_eventKinds[e]];
+        final maha = 1 << _dashaGrahas[period ~/ 9];
+        final antar = 1 << _dashaGrahas[period % 9];
+        if (houses & maha != 0) score += 2;
+        if (houses & antar != 0) score += 2;
+        if (navamsa & maha != 0) score += 1;
+        if (navamsa & antar != 0) score += 1;
+      }
+      chunk.lagna[k] = lagnaSign;
+      chunk.navamsa[k] = navamsaSign;
+      chunk.score[k] = score;
+
+      for (var g = 0; g < _grahas; g++) {
+        longitude[g] += delta[g];
+        delta[g] += 2 * _square[g];
+      }
+    }
+    return chunk;
+  }
+
+  /// Candidates of evaluated [chunks] covering the window, best first; ties
+  /// go to the run nearest the guess
+  List<RectificationCandidate> candidates(List<RectificationChunk> chunks) {
+    final ordered = [...chunks]..sort((a, b) => a.from.compareTo(b.from));
+    final runs = <RectificationCandidate>[];
+    RectificationChunk? runChunk;
+    var runIndex = 0;
+    var runStart = 0;
+
+    bool same(RectificationChunk a, int i, RectificationChunk b, int j) {
+      if (a.lagna[i] != b.lagna[j] || a.navamsa[i] != b.navamsa[j]) {
+        return false;
+      }
+      for (var e = 0; e < events; e++) {
+        if (a.periods[i * events + e] != b.periods[j * events + e]) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void close(int end) {
+      final chunk = runChunk!;
+      runs.add(RectificationCandidate(
+        instant(runStart),
+        instant(end),
+        chunk.lagna[runIndex],
+        chunk.navamsa[runIndex],
+        chunk.score[runIndex],
+      ));
+    }
+
+    for (final chunk in ordered) {
+      for (var k = 0; k < chunk.length; k++) {
+        if (runChunk == null || !same(runChunk, runIndex, chunk, k)) {
+          if (runChunk != null) close(chunk.from + k - 1);
+          runChunk = chunk;
+          runIndex = k;
+          runStart = chunk.from + k;
+        }
+      }
+    }
+    if (runChunk != null) close(instants - 1);
+
+    final guess = instant(instants ~/ 2);
+    int distance(RectificationCandidate c) =>
+        c.middleUtc.difference(guess).inSeconds.abs();
+    return runs
+      ..sort((a, b) => a.score != b.score
+          ? b.score.compareTo(a.score)
+          : distance(a).compareTo(distance(b)));
+  }
+
+  /// The whole window on the calling isolate
+  List<RectificationCandidate> run() => candidates([evaluate(0, instants)]);
+
+  /// Per event kind, a mask of the grahas signifying its houses counted
+  /// from [ascendant]: lords, and with [full] also occupants and karaka
+  static Int32List _significators(int ascendant, Int8List signs, bool full) {
+    final masks = Int32List(LifeEventKind.values.length);
+    for (var kind = 0; kind < masks.length; kind++) {
+      var mask = 0;
+      for (final house in _eventHouses[kind]) {
+        final sign = (ascendant + house - 1) % 12;
+        mask |= 1 << _signLords[sign];
+        if (!full) continue;
+        for (var g = 0; g < _grahas; g++) {
+          if (signs[g] == sign) mask |= 1 << g;
+        }
+      }
+      if (full) mask |= 1 << _eventKarakas[kind];
+      masks[kind] = mask;
+    }
+    return masks;
+  }
+
+  double _sidereal(double tropical) {
+    final value = (tropical - ayanamshaDegrees) % 360;
+    return value < 0 ? value + 360 : value;
+  }
+
+  static double _wrap(double degrees) {
+    final value = degrees % 360;
+    return value > 180 ? value - 360 : value;
+  }
+
+}
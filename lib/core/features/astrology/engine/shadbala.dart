@@ -0,0 +1,296 @@
+/// Shadbala
+///
+/// The six-fold strength of the seven planets (Brihat Parashara Hora
+/// Shastra, ch. 27) in virupas (1/60 rupa):
+/// - sthana: exaltation, odd/even sign and navamsa, kendra and drekkana;
+/// - dig: distance from the powerless house cusp;
+/// - kala: day/night, paksha, tribhaga, weekday and hora lords, ayana;
+/// - chesta: motional strength;
+/// - naisargika: the fixed natural strengths;
+/// - drik: benefic minus malefic aspects received.
+///
+/// Houses are equal from the lagna. Abda and masa lords, planetary war and
+/// saptavargaja bala are not included.
+library;
+
+import 'dart:typed_data';
+import 'engine_math.dart' as math;
+import 'fingerprint.dart';
+import 'lagna.dart';
+import 'natal_chart.dart';
+import 'planetary_ephemeris.dart';
+
+const double _deg = math.pi / 180;
+
+/// The six components
+enum ShadbalaComponent { sthana, dig, kala, chesta, naisargika, drik }
+
+/// Shadbala of one chart
+class ShadbalaResult {
+  /// Virupas, `values[planet * 6 + component.index]`
+  final Float64List values;
+
+  ShadbalaResult(this.values);
+
+  String get fingerprint => EngineFingerprint.of(values);
+
+  /// Minimum total in rupas for a planet to count as strong, Sun … Saturn
+  static const List<double> requiredRupas = [6.5, 6, 5, 7, 6.5, 5.5, 5];
+
+  double component(Graha planet, ShadbalaComponent component) =>
+      values[planet.index * _components + component.index];
+
+  /// Total in virupas
+  double total(Graha planet) {
+    var sum = 0.0;
+    for (var c = 0; c < _components; c++) {
+      sum += values[planet.index * _components + c];
+    }
+    return sum;
+  }
+
+  double rupas(Graha planet) => total(planet) / 60;
+
+  /// Strength against [requiredRupas]; 1 and above is strong
+  double ratio(Graha planet) => rupas(planet) / requiredRupas[planet.index];
+}
+
+const int _components = 6;
+const int _planets = 7;
+
+// [Graha] indices of the seven planets
+const int _sun = 0;
+const int _moon = 1;
+const int _mars = 2;
+const int _mercury = 3;
+const int _jupiter = 4;
+const int _venus = 5;
+const int _saturn = 6;
+
+/// Shadbala
+class Shadbala {
+  Shadbala._();
+
+  /// Deep exaltation points, Sun … Saturn
+  static const List<double> _exaltation = [10, 33, 298, 165, 95, 357, 200];
+
+  /// Naisargika bala, Sun … Saturn
+  static const List<double> _natural = [
+    60, 51.43, 17.14, 25.70, 34.28, 42.85, 8.57, //
+  ];
+
+  /// House (from the lagna) where each planet gains full dig bala
+  static const List<int> _digHouse = [10, 4, 10, 1, 1, 4, 7];
+
+  /// Drekkana (0 … 2) giving 15 virupas: male, female, neutral planets
+  static const List<int> _drekkana = [0, 2, 0, 1, 0, 2, 1];
+
+  /// Fastest direct and retrograde daily motion (degrees) of Mars … Saturn
+  static const List<double> _fastest = [0, 0, 0.79, 2.2, 0.24, 1.26, 0.13];
+  static const List<double> _fastestRetro = [
+    0, 0, -0.40, -1.4, -0.14, -0.64, -0.08, //
+  ];
+
+  /// Weekday lords from Monday, and the Chaldean order of the horas
+  static const List<int> _weekdayLords = [
+    _moon, _mars, _mercury, _jupiter, _venus, _saturn, _sun, //
+  ];
+  static const List<int> _chaldean = [
+    _saturn, _jupiter, _mars, _sun, _venus, _mercury, _moon, //
+  ];
+
+  /// Angular distance in degrees, 0 … 180
+  static double _distance(double a, double b) {
+    final d = (a - b).abs() % 360;
+    return d > 180 ? 360 - d : d;
+  }
+
+  /// Shadbala of [chart]
+  static ShadbalaResult compute(NatalChart chart) {
+    final values = Float64List(_planets * _components);
+    _computeInto(chart, values, 0);
+    return ShadbalaResult(values);
+  }
+
+  /// Totals in virupas of many charts, seven per chart (Sun … Saturn)
+  static Float64List batch(List<NatalChart> charts) {
+    final totals = Float64List(charts.length * _planets);
+    final values = Float64List(_planets * _components);
+    for (var i = 0; i < charts.length; i++) {
+      values.fillRange(0, values.length, 0);
+      _computeInto(charts[i], values, 0);
+      for (var p = 0; p < _planets; p++) {
+        var sum = 0.0;
+        for (var c = 0; c < _components; c++) {
+          sum += values[p * _components + c];
+        }
+        totals[i * _planets + p] = sum;
+      }
+    }
+    return totals;
+  }
+
+  static void _computeInto(NatalChart chart, Float64List out, int offset) {
+    final lon = chart.longitudes;
+    final lagnaSign = chart.rashi(NatalChart.lagna);
+    final obliquity = meanObliquity(chart.jdUt);
+
+    // Sun's hour angle and half day arc at the birth place
+    final sunTropical = (lon[_sun] + chart.ayanamshaDegrees) * _deg;
+    final eps = obliquity * _deg;
+    final sunRa = math.atan2(
+            math.cos(eps) * math.sin(sunTropical), math.cos(sunTropical)) /
+        _deg;
+    final sunDeclination =
+        math.asin(math.sin(eps) * math.sin(sunTropical)) / _deg;
+    var hourAngle = (greenwichSiderealTime(chart.jdUt) +
+            chart.eastLongitude -
+            sunRa) %
+        360;
+    if (hourAngle > 180) hourAngle -= 360;
+    final cosHalfDay = (-math.tan(chart.latitude * _deg) *
+            math.tan(sunDeclination * _deg))
+        .clamp(-1.0, 1.0);
+    final halfDay = math.acos(cosHalfDay) / _deg;
+    final isDay = hourAngle.abs() < halfDay;
+
+    // Fraction of the day or night elapsed at birth
+    final elapsed = isDay
+        ? (hourAngle + halfDay) / (2 * halfDay)
+        : ((hourAngle - halfDay) % 360) / (360 - 2 * halfDay);
+
+    // Vara: the weekday of the last sunrise; hora: planetary hour since it
+    final beforeSunrise = !isDay && hourAngle < 0;
+    final noonJd = chart.jdUt -
+        hourAngle / 360 +
+        chart.eastLongitude / 360 -
+        (beforeSunrise ? 1 : 0);
+    final varaLord = _weekdayLords[(noonJd + 0.5).floor() % 7];
+    final hora = isDay ? (elapsed * 12).floor() : 12 + (elapsed * 12).floor();
+    final horaLord =
+        _chaldean[(_chaldean.indexOf(varaLord) + hora) % _planets];
+
+    // Paksha: the Moon's elongation from the Sun
+    final elongation = _distance(lon[_moon], lon[_sun]);
+    final waxing = (lon[_moon] - lon[_sun]) % 360 < 180;
+
+    for (var p = 0; p < _planets; p++) {
+      final row = offset + p * _components;
+      final longitude = lon[p];
+      final sign = chart.rashi(p);
+
+      // Sthana
+      var sthana = _distance(longitude, _exaltation[p] + 180) / 3;
+      final navamsa = (longitude * 9 / 30).floor() % 12;
+      final feminine = p == _moon || p == _venus;
+      // Sign index 0 (Mesha) is an odd sign
+      if (sign.isEven != feminine) sthana += 15;
+      if (navamsa.isEven != feminine) sthana += 15;
+      final house = (sign - lagnaSign) % 12 + 1;
+      sthana += house % 3 == 1
+          ? 60
+          : house % 3 == 2
+              ? 30
+              : 15;
+      if ((longitude % 30) ~/ 10 == _drekkana[p]) sthana += 15;
+      out[row + ShadbalaComponent.sthana.index] = sthana;
+
+      // Dig: distance from the cusp opposite the house of full strength
+      final weakCusp = chart.lagnaLongitude + (_digHouse[p] + 5) * 30;
+      out[row + ShadbalaComponent.dig.index] =
+          _distance(longitude, weakCusp) / 3;
+
+      // Kala
+      final nata = hourAngle.abs();
+      var kala = switch (p) {
+        _mercury => 60.0,
+        _sun || _jupiter || _venus => 60 * (180 - nata) / 180,
+        _ => 60 * nata / 180,
+      };
+      final benefic =
+          p == _moon || p == _mercury || p == _jupiter || p == _venus;
+      final paksha = benefic ? elongation / 3 : (180 - elongation) / 3;
+      kala += p == _moon ? 2 * paksha : paksha;
+      final third = (elapsed * 3).floor().clamp(0, 2);
+      final tribhagaLord = isDay
+          ? const [_mercury, _sun, _saturn][third]
+          : const [_moon, _venus, _mars][third];
+      if (p == _jupiter || p == tribhagaLord) kala += 60;
+      if (p == varaLord) kala += 45;
+      if (p == horaLord) kala += 60;
+      final ayana = _ayana(p, longitude + chart.ayanamshaDegrees, obliquity);
+      kala += p == _sun ? 2 * ayana : ayana;
+      out[row + ShadbalaComponent.kala.index] = kala;
+
+      // Chesta: the Sun's is its ayana bala, the Moon's its paksha bala;
+      // others grow linearly from fastest direct (0) to fastest retrograde
+      out[row + ShadbalaComponent.chesta.index] = switch (p) {
+        _sun => ayana,
+        _moon => paksha,
+        _ => (60 *
+                (_fastest[p] - chart.speeds[p]) /
+                (_fastest[p] - _fastestRetro[p]))
+            .clamp(0.0, 60.0),
+      };
+
+      out[row + ShadbalaComponent.naisargika.index] = _natural[p];
+
+      // Drik: a quarter of benefic minus malefic aspects received
+      var drik = 0.0;
+      for (var q = 0; q < _planets; q++) {
+        if (q == p) continue;
+        final aspect = _aspect(q, (longitude - lon[q]) % 360);
+        final beneficAspect = q == _jupiter ||
+            q == _venus ||
+            q == _mercury ||
+            (q == _moon && waxing);
+        drik += beneficAspect ? aspect : -aspect;
+      }
+      out[row + ShadbalaComponent.drik.index] = drik / 4;
+    }
+  }
+
+  /// Ayana bala from the declination of a tropical longitude
+  static double _ayana(int planet, double tropical, double obliquity) {
+    final declination =
+        math.asin(math.sin(obliquity * _deg) * math.sin(tropical * _deg)) /
+            _deg;
+    final arc = switch (planet) {
+      _moon || _saturn => obliquity - declination,
+      _mercury => obliquity + declination.abs(),
+      _ => obliquity + declination,
+    };
+    return 60 * arc / (2 * obliquity);
+  }
+
+  /// Drishti of [planet] on a point [angle] degrees ahead, in virupas
+  static double _aspect(int planet, double angle) {
+    var value = angle < 30
+        ? 0.0
+        : angle < 60
+            ? (angle - 30) / 2
+            : angle < 90
+                ? angle - 45
+                : angle < 120
+                    ? (120 - angle) / 2 + 30
+                    : angle < 150
+                        ? 150 - angle
+                        : angle < 180
+                            ? (angle - 150) * 2
+                            : angle < 300
+                                ? (300 - angle) / 2
+                                : 0.0;
+    // Special aspects: Mars 4th/8th, Jupiter 5th/9th, Saturn 3rd/10th
+    if (planet == _mars &&
+        ((angle >= 90 && angle < 120) || (angle >= 210 && angle < 240))) {
+      value += 15;
+    } else if (planet == _jupiter &&
+        ((angle >= 120 && angle < 150) || (angle >= 240 && angle < 270))) {
+      value += 30;
+    } else if (planet == _saturn &&
+        ((angle >= 60 && angle < 90) || (angle >= 270 && angle < 300))) {
+      value += 45;
+    }
+    return math.min(value, 60);
+  }
+}
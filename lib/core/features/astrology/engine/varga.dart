@@ -0,0 +1,158 @@
+/// Varga
+///
+/// The sixteen Parashari divisional charts (Brihat Parashara Hora Shastra,
+/// ch. 6) of every natal point. Each division maps a sign and the part of
+/// it a longitude falls in to a sign of the divisional chart; the rules are
+/// folded once into a lookup (division × sign × part), so a chart is one
+/// pass of table reads over points × divisions.
+library;
+
+import 'dart:typed_data';
+import 'fingerprint.dart';
+import 'natal_chart.dart';
+
+/// The Shodasavarga, D1 … D60
+enum Varga {
+  d1(1, 'Rashi'),
+  d2(2, 'Hora'),
+  d3(3, 'Drekkana'),
+  d4(4, 'Chaturthamsa'),
+  d7(7, 'Saptamsa'),
+  d9(9, 'Navamsa'),
+  d10(10, 'Dasamsa'),
+  d12(12, 'Dwadasamsa'),
+  d16(16, 'Shodasamsa'),
+  d20(20, 'Vimsamsa'),
+  d24(24, 'Chaturvimsamsa'),
+  d27(27, 'Bhamsa'),
+  d30(30, 'Trimsamsa'),
+  d40(40, 'Khavedamsa'),
+  d45(45, 'Akshavedamsa'),
+  d60(60, 'Shashtyamsa');
+
+  /// Parts per sign
+  final int division;
+
+  final String title;
+
+  const Varga(this.division, this.title);
+
+  /// Short label, e.g. "D9"
+  String get label => 'D$division';
+}
+
+/// Signs of all natal points in all vargas
+class VargaTable {
+  /// Values per point
+  static const int stride = 16;
+
+  /// 0-based signs, `signs[point * stride + varga.index]`; points are in
+  /// [NatalChart.longitudes] order
+  final Int8List signs;
+
+  VargaTable(this.signs)
+      : assert(signs.length == NatalChart.points * stride);
+
+  int sign(int point, Varga varga) => signs[point * stride + varga.index];
+
+  String get fingerprint => EngineFingerprint.of(signs);
+
+  /// Signs of all points in one varga
+  Int8List chart(Varga varga) => Int8List.fromList([
+        for (var point = 0; point < NatalChart.points; point++)
+          sign(point, varga),
+      ]);
+}
+
+/// Varga
+class Vargas {
+  Vargas._();
+
+  /// Rows of the lookup: the finest division
+  static const int _parts = 60;
+
+  /// [Varga.division] in [Varga] order
+  static final List<int> _divisions = [
+    for (final varga in Varga.values) varga.division,
+  ];
+
+  /// Signs lorded by Mars, Saturn, Jupiter, Mercury and Venus, and the
+  /// degree where each trimsamsa ends, in odd and in even signs
+  static const List<int> _trimsamsaOdd = [0, 10, 8, 2, 6];
+  static const List<int> _trimsamsaEven = [1, 5, 11, 9, 7];
+  static const List<int> _trimsamsaEndOdd = [5, 10, 18, 25, 30];
+  static const List<int> _trimsamsaEndEven = [5, 12, 20, 25, 30];
+
+  /// `[(varga.index * 12 + sign) * _parts + part]`, part 0 … division − 1
+  static final Int8List _lookup = _buildLookup();
+
+  static Int8List _buildLookup() {
+    final lookup = Int8List(Varga.values.length * 12 * _parts);
+    for (final varga in Varga.values) {
+      for (var sign = 0; sign < 12; sign++) {
+        final row = (varga.index * 12 + sign) * _parts;
+        for (var part = 0; part < varga.division; part++) {
+          lookup[row + part] = _rule(varga, sign, part);
+        }
+      }
+    }
+    return lookup;
+  }
+
+  /// Divisional sign of part [k] of [sign]
+  static int _rule(Varga varga, int sign, int k) {
+    // Sign index 0 (Mesha) is odd; modality 0 movable, 1 fixed, 2 dual
+    final odd = sign.isEven;
+    final modality = sign % 3;
+    final start = switch (varga) {
+      Varga.d1 || Varga.d3 || Varga.d4 || Varga.d12 || Varga.d60 => sign,
+      Varga.d2 => odd ? 4 : 3,
+      Varga.d7 => odd ? sign : sign + 6,
+      Varga.d9 || Varga.d27 => sign * varga.division,
+      Varga.d10 => odd ? sign : sign + 8,
+      Varga.d16 || Varga.d45 => const [0, 4, 8][modality],
+      Varga.d20 => const [0, 8, 4][modality],
+      Varga.d24 => odd ? 4 : 3,
+      Varga.d40 => odd ? 0 : 6,
+      Varga.d30 => 0,
+    };
+    if (varga == Varga.d30) {
+      // Unequal parts over whole degrees: part k is the degree k … k + 1
+      final degree = k;
+      final ends = odd ? _trimsamsaEndOdd : _trimsamsaEndEven;
+      var i = 0;
+      while (degree >= ends[i]) {
+        i++;
+      }
+      return odd ? _trimsamsaOdd[i] : _trimsamsaEven[i];
+    }
+    final step = switch (varga) {
+      Varga.d3 => 4,
+      Varga.d4 => 3,
+      // Hora: Sun and Moon in odd signs, Moon and Sun in even signs
+      Varga.d2 => odd ? -1 : 1,
+      _ => 1,
+    };
+    return (start + k * step) % 12;
+  }
+
+  /// All sixteen vargas of [chart]
+  static VargaTable compute(NatalChart chart) {
+    final signs = Int8List(NatalChart.points * VargaTable.stride);
+    final longitudes = chart.longitudes;
+    final vargas = Varga.values.length;
+    for (var point = 0; point < NatalChart.points; point++) {
+      final longitude = longitudes[point] % 360;
+      final sign = longitude ~/ 30;
+      final degree = longitude - sign * 30;
+      final row = sign * _parts;
+      final out = point * VargaTable.stride;
+      for (var v = 0; v < vargas; v++) {
+        final division = _divisions[v];
+        final part = (degree * division / 30).floor().clamp(0, division - 1);
+        signs[out + v] = _lookup[v * 12 * _parts + row + part];
+      }
+    }
+    return VargaTable(signs);
+  }
+}
@@ -0,0 +1,111 @@
+/// Vimshottari Dasha
+///
+/// Maha and antar dasha lords from the natal moon's longitude. The 120-year
+/// cycle starts at the lord of the birth nakshatra, with the balance left of
+/// that nakshatra at birth.
+library;
+
+/// Nakshatra span in degrees (13°20')
+const double nakshatraSpan = 360 / 27;
+
+/// A running dasha period
+class DashaPeriod {
+  final String lord;
+  final DateTime start;
+  final DateTime end;
+
+  const DashaPeriod(this.lord, this.start, this.end);
+}
+
+/// Maha dasha with the antar dasha running at the queried instant
+class DashaState {
+  final DashaPeriod mahadasha;
+  final DashaPeriod antardasha;
+
+  const DashaState(this.mahadasha, this.antardasha);
+}
+
+/// Vimshottari Dasha
+class Vimshottari {
+  Vimshottari._();
+
+  /// Dasha lords in order, starting with the lord of Ashwini
+  static const List<String> lords = [
+    'Ketu',
+    'Venus',
+    'Sun',
+    'Moon',
+    'Mars',
+    'Rahu',
+    'Jupiter',
+    'Saturn',
+    'Mercury',
+  ];
+
+  /// Maha dasha length in years, parallel to [lords]
+  static const List<int> years = [7, 20, 6, 10, 7, 18, 16, 19, 17];
+
+  static const int cycleYears = 120;
+  static const double _daysPerYear = 365.25;
+
+  /// Lord index of a 0-based nakshatra index
+  static int lordOf(int nakshatra) => nakshatra % 9;
+
+  /// Dasha running at [at] for a native born at [birth] with the moon at
+  /// sidereal [moonLongitude]
+  static DashaState at(double moonLongitude, DateTime birth, DateTime at) {
+    final nakshatra = (moonLongitude / nakshatraSpan).floor() % 27;
+    final elapsedFraction = (moonLongitude % nakshatraSpan) / nakshatraSpan;
+
+    var lord = lordOf(nakshatra);
+    // Start of the first maha dasha, before birth by the elapsed part
+    var start = birth.subtract(_years(years[lord] * elapsedFraction));
+    var end = start.add(_years(years[lord].toDouble()));
+    while (!end.isAfter(at)) {
+      lord = (lord + 1) % 9;
+      start = end;
+      end = start.add(_years(years[lord].toDouble()));
+    }
+    final mahadasha = DashaPeriod(lords[lord], start, end);
+
+    // Antar dashas split the maha dasha in proportion, starting with itself
+    var sub = lord;
+    var subStart = start;
+    while (true) {
+      final length = years[lord] * years[sub] / cycleYears;
+      final subEnd = subStart.add(_years(length));
+      if (subEnd.isAfter(at) || sub == (lord + 8) % 9) {
+        return DashaState(
+            mahadasha, DashaPeriod(lords[sub], subStart, subEnd));
+      }
+      sub = (sub + 1) % 9;
+      subStart = subEnd;
+    }
+  }
+
+  /// Maha and antar dasha running [elapsedDays] after birth as lord indices,
+  /// `maha * 9 + antar`; [at] without date arithmetic, for sweeps
+  static int periodIndex(double moonLongitude, double elapsedDays) {
+    final nakshatra = (moonLongitude / nakshatraSpan).floor() % 27;
+    final elapsedFraction = (moonLongitude % nakshatraSpan) / nakshatraSpan;
+
+    var lord = lordOf(nakshatra);
+    // Years since the first maha dasha started
+    var t = elapsedDays / _daysPerYear + years[lord] * elapsedFraction;
+    if (t < 0) t = 0;
+    while (t >= years[lord]) {
+      t -= years[lord];
+      lord = (lord + 1) % 9;
+    }
+    var sub = lord;
+    while (true) {
+      final length = years[lord] * years[sub] / cycleYears;
+      if (t < length || sub == (lord + 8) % 9) return lord * 9 + sub;
+      t -= length;
+      sub = (sub + 1) % 9;
+    }
+  }
+
+  static Duration _years(double years) =>
+      Duration(microseconds: (years * _daysPerYear * 86400e6).round());
+}
@@ -0,0 +1,419 @@
+/// Yoga Engine
+///
+/// Detects yogas and doshas from declarative [YogaRule]s over chart
+/// predicates. Rules are compiled once: every distinct predicate becomes an
+/// atom (one bit of a word set) and every rule a disjunction of terms, each
+/// term a pair of required and forbidden atom masks. Evaluating a chart is
+/// one pass over the atoms and then mask tests, a few microseconds for the
+/// whole rule set.
+library;
+
+import 'dart:typed_data';
+import 'fingerprint.dart';
+import 'natal_chart.dart';
+import 'yoga_rules.dart';
+
+/// Points a predicate can name, in [NatalChart.longitudes] order
+enum ChartPoint {
+  sun,
+  moon,
+  mars,
+  mercury,
+  jupiter,
+  venus,
+  saturn,
+  rahu,
+  ketu,
+  lagna,
+}
+
+/// Auspicious combination or affliction
+enum YogaKind { yoga, dosha }
+
+/// A chart predicate
+///
+/// Houses are 1-based and counted from a point (the lagna unless stated);
+/// signs are 0-based from Aries.
+abstract class YogaCondition {
+  const YogaCondition();
+}
+
+/// [point] occupies one of [houses] from [from]
+class InHouses extends YogaCondition {
+  final ChartPoint point;
+  final List<int> houses;
+  final ChartPoint from;
+
+  const InHouses(this.point, this.houses, {this.from = ChartPoint.lagna});
+}
+
+/// [point] occupies one of [signs]
+class InSigns extends YogaCondition {
+  final ChartPoint point;
+  final List<int> signs;
+
+  const InSigns(this.point, this.signs);
+}
+
+/// The lord of [house] from [from] occupies one of [houses] from [from]
+class LordInHouses extends YogaCondition {
+  final int house;
+  final List<int> houses;
+  final ChartPoint from;
+
+  const LordInHouses(this.house, this.houses,
+      {this.from = ChartPoint.lagna});
+}
+
+/// None of [points] occupies any of [houses] from [from]
+class NoneInHouses extends YogaCondition {
+  final List<ChartPoint> points;
+  final List<int> houses;
+  final ChartPoint from;
+
+  const NoneInHouses(this.points, this.houses,
+      {this.from = ChartPoint.lagna});
+}
+
+/// Every one of [points] occupies one of [houses] from [from]
+class AllInHouses extends YogaCondition {
+  final List<ChartPoint> points;
+  final List<int> houses;
+  final ChartPoint from;
+
+  const AllInHouses(this.points, this.houses,
+      {this.from = ChartPoint.lagna});
+}
+
+/// The lords of [houseA] and [houseB] from [from] are one planet, conjunct,
+/// in each other's signs or in mutual seventh aspect
+class LordsRelated extends YogaCondition {
+  final int houseA;
+  final int houseB;
+  final ChartPoint from;
+
+  const LordsRelated(this.houseA, this.houseB,
+      {this.from = ChartPoint.lagna});
+}
+
+/// All [points] lie on one side of the Rahu–Ketu axis
+class HemmedByNodes extends YogaCondition {
+  final List<ChartPoint> points;
+
+  const HemmedByNodes(this.points);
+}
+
+class AllOf extends YogaCondition {
+  final List<YogaCondition> conditions;
+
+  const AllOf(this.conditions);
+}
+
+class AnyOf extends YogaCondition {
+  final List<YogaCondition> conditions;
+
+  const AnyOf(this.conditions);
+}
+
+class Not extends YogaCondition {
+  final YogaCondition condition;
+
+  const Not(this.condition);
+}
+
+/// A named yoga or dosha
+class YogaRule {
+  final String id;
+  final String name;
+  final YogaKind kind;
+  final YogaCondition when;
+
+  /// One line on what it indicates
+  final String description;
+
+  const YogaRule(
+    this.id,
+    this.name,
+    this.kind,
+    this.when, {
+    this.description = '',
+  });
+}
+
+/// Rules present in one chart
+class YogaSet {
+  final List<YogaRule> rules;
+
+  /// Bit r set when `rules[r]` holds
+  final Uint32List bits;
+
+  const YogaSet(this.rules, this.bits);
+
+  String get fingerprint => EngineFingerprint.of(bits);
+
+  bool operator [](int rule) => (bits[rule >> 5] >> (rule & 31)) & 1 == 1;
+
+  bool has(String id) {
+    final index = rules.indexWhere((rule) => rule.id == id);
+    return index >= 0 && this[index];
+  }
+
+  List<YogaRule> get present => [
+        for (var r = 0; r < rules.length; r++)
+          if (this[r]) rules[r],
+      ];
+}
+
+// Atom opcodes; each atom is [op, a, b, mask]
+const int _opHouses = 0;
+const int _opSigns = 1;
+const int _opLordHouses = 2;
+const int _opNone = 3;
+const int _opAll = 4;
+const int _opRelated = 5;
+const int _opHemmed = 6;
+const int _atomWidth = 4;
+
+/// Sign lords as point indices, Aries … Pisces
+const List<int> _signLords = [2, 5, 3, 1, 0, 3, 5, 2, 4, 6, 6, 4];
+
+/// A disjunct of a rule: atoms that must hold and atoms that must not
+class _Term {
+  final Set<int> required;
+  final Set<int> forbidden;
+
+  const _Term(this.required, this.forbidden);
+}
+
+/// Yoga Engine
+class YogaEngine {
+  static YogaEngine? _instance;
+
+  /// The engine over [YogaRules.all]
+  static YogaEngine get instance {
+    _instance ??= YogaEngine.compile(YogaRules.all);
+    return _instance!;
+  }
+
+  final List<YogaRule> rules;
+
+  /// [_atomWidth] values per atom
+  final Int32List _atoms;
+
+  /// Words of an atom set and of a rule set
+  final int _atomWords;
+  final int _ruleWords;
+
+  /// Per term, [_atomWords] required then [_atomWords] forbidden masks
+  final Uint32List _terms;
+
+  /// Terms of rule r: `_ruleTerms[r]` … `_ruleTerms[r + 1] − 1`
+  final Int32List _ruleTerms;
+
+  YogaEngine._(this.rules, this._atoms, this._terms, this._ruleTerms)
+      : _atomWords = (_atoms.length ~/ _atomWidth + 31) >> 5,
+        _ruleWords = (rules.length + 31) >> 5;
+
+  /// Compile [rules] into atoms and term masks
+  factory YogaEngine.compile(List<YogaRule> rules) {
+    final atomKeys = <String, int>{};
+    final atoms = <int>[];
+
+    int atom(int op, int a, int b, int mask) {
+      return atomKeys.putIfAbsent('$op/$a/$b/$mask', () {
+        atoms.addAll([op, a, b, mask]);
+        return atomKeys.length;
+      });
+    }
+
+    int bits(Iterable<int> values, [int offset = 0]) =>
+        values.fold(0, (mask, value) => mask | 1 << (value - offset));
+    int points(List<ChartPoint> points) => bits(points.map((p) => p.index));
+
+    List<_Term> dnf(YogaCondition condition, bool negate) {
+      List<_Term> leaf(int index) => [
+            negate ? _Term(const {}, {index}) : _Term({index}, const {}),
+          ];
+      return switch (condition) {
+        InHouses c => leaf(atom(
+            _opHouses, c.point.index, c.from.index, bits(c.houses, 1))),
+        InSigns c => leaf(atom(_opSigns, c.point.index, 0, bits(c.signs))),
+        LordInHouses c => leaf(atom(
+            _opLordHouses, c.house, c.from.index, bits(c.houses, 1))),
+        NoneInHouses c => leaf(atom(
+            _opNone, points(c.points), c.from.index, bits(c.houses, 1))),
+        AllInHouses c => leaf(atom(
+            _opAll, points(c.points), c.from.index, bits(c.houses, 1))),
+        LordsRelated c =>
+          leaf(atom(_opRelated, c.houseA, c.houseB, c.from.index)),
+        HemmedByNodes c => leaf(atom(_opHemmed, points(c.points), 0, 0)),
+        Not c => dnf(c.condition, !negate),
+        // AND of disjunctions is their product; NOT flips AND and OR
+        AllOf c when !negate => _product([
+            for (final child in c.conditions) dnf(child, false),
+          ]),
+        AllOf c => [for (final child in c.conditions) ...dnf(child, true)],
+        AnyOf c when negate => _product([
+            for (final child in c.conditions) dnf(child, true),
+          ]),
+        AnyOf c => [for (final child in c.conditions) ...dnf(child, false)],
+        _ => throw ArgumentError('Unknown condition $condition'),
+      };
+    }
+
+    final ruleTerms = <List<_Term>>[
+      for (final rule in rules) dnf(rule.when, false),
+    ];
+
+    final atomWords = (atomKeys.length + 31) >> 5;
+    final termCount = ruleTerms.fold<int>(0, (sum, t) => sum + t.length);
+    final terms = Uint32List(termCount * 2 * atomWords);
+    final offsets = Int32List(rules.length + 1);
+    var t = 0;
+    for (var r = 0; r < rules.length; r++) {
+      offsets[r] = t;
+      for (final term in ruleTerms[r]) {
+        final base = t * 2 * atomWords;
+        for (final a in term.required) {
+          terms[base + (a >> 5)] |= 1 << (a & 31);
+        }
+        for (final a in term.forbidden) {
+          terms[base + atomWords + (a >> 5)] |= 1 << (a & 31);
+        }
+        t++;
+      }
+    }
+    offsets[rules.length] = t;
+    return YogaEngine._(rules, Int32List.fromList(atoms), terms, offsets);
+  }
+
+  /// Product of disjunctions, without self-contradictory terms
+  static List<_Term> _product(List<List<_Term>> factors) {
+    var result = [const _Term({}, {})];
+    for (final factor in factors) {
+      result = [
+        for (final a in result)
+          for (final b in factor)
+            if (!a.required.any(b.forbidden.contains) &&
+                !b.required.any(a.forbidden.contains))
+              _Term({...a.required, ...b.required},
+                  {...a.forbidden, ...b.forbidden}),
+      ];
+    }
+    return result;
+  }
+
+  int get atomCount => _atoms.length ~/ _atomWidth;
+
+  /// Rules holding in [chart]
+  YogaSet evaluate(NatalChart chart) {
+    final bits = Uint32List(_ruleWords);
+    _evaluateInto(chart, Uint32List(_atomWords), Int8List(NatalChart.points),
+        bits, 0);
+    return YogaSet(rules, bits);
+  }
+
+  /// Rule bits of many charts, [ruleWords] words per chart
+  Uint32List batch(List<NatalChart> charts) {
+    final out = Uint32List(charts.length * _ruleWords);
+    final atoms = Uint32List(_atomWords);
+    final signs = Int8List(NatalChart.points);
+    for (var i = 0; i < charts.length; i++) {
+      atoms.fillRange(0, atoms.length, 0);
+      _evaluateInto(charts[i], atoms, signs, out, i * _ruleWords);
+    }
+    return out;
+  }
+
+  int get ruleWords => _ruleWords;
+
+  /// [YogaSet] of chart [index] of a [batch] result
+  YogaSet batchResult(Uint32List batch, int index) => YogaSet(
+      rules,
+      Uint32List.sublistView(
+          batch, index * _ruleWords, (index + 1) * _ruleWords));
+
+  void _evaluateInto(NatalChart chart, Uint32List atoms, Int8List signs,
+      Uint32List out, int offset) {
+    for (var p = 0; p < NatalChart.points; p++) {
+      signs[p] = chart.rashi(p);
+    }
+
+    final count = atomCount;
+    for (var i = 0; i < count; i++) {
+      final base = i * _atomWidth;
+      final a = _atoms[base + 1];
+      final b = _atoms[base + 2];
+      final mask = _atoms[base + 3];
+      final holds = switch (_atoms[base]) {
+        _opHouses => (mask >> _house(signs, a, b)) & 1 == 1,
+        _opSigns => (mask >> signs[a]) & 1 == 1,
+        _opLordHouses =>
+          (mask >> _house(signs, _lord(signs, a, b), b)) & 1 == 1,
+        _opNone => _occupied(signs, a, b) & mask == 0,
+        _opAll => _occupied(signs, a, b) & ~mask == 0,
+        _opRelated =>
+          _related(_lord(signs, a, mask), _lord(signs, b, mask), signs),
+        _opHemmed => _hemmed(a, chart.longitudes),
+        _ => false,
+      };
+      if (holds) atoms[i >> 5] |= 1 << (i & 31);
+    }
+
+    for (var r = 0; r < rules.length; r++) {
+      for (var t = _ruleTerms[r]; t < _ruleTerms[r + 1]; t++) {
+        final base = t * 2 * _atomWords;
+        var match = true;
+        for (var w = 0; w < _atomWords && match; w++) {
+          final required = _terms[base + w];
+          match = atoms[w] & required == required &&
+              atoms[w] & _terms[base + _atomWords + w] == 0;
+        }
+        if (match) {
+          out[offset + (r >> 5)] |= 1 << (r & 31);
+          break;
+        }
+      }
+    }
+  }
+
+  /// House (0-based) of [point] from [from]
+  static int _house(Int8List signs, int point, int from) =>
+      (signs[point] - signs[from]) % 12;
+
+  /// Lord of [house] (1-based) from [from]
+  static int _lord(Int8List signs, int house, int from) =>
+      _signLords[(signs[from] + house - 1) % 12];
+
+  /// Houses (bit h−1 for house h) from [from] occupied by the [points] mask
+  static int _occupied(Int8List signs, int points, int from) {
+    var houses = 0;
+    for (var p = 0; p < NatalChart.points; p++) {
+      if ((points >> p) & 1 == 1) houses |= 1 << _house(signs, p, from);
+    }
+    return houses;
+  }
+
+  static bool _related(int a, int b, Int8List signs) {
+    if (a == b) return true;
+    final distance = (signs[a] - signs[b]) % 12;
+    return distance == 0 ||
+        distance == 6 ||
+        (_signLords[signs[a]] == b && _signLords[signs[b]] == a);
+  }
+
+  static bool _hemmed(int mask, Float64List longitudes) {
+    final rahu = longitudes[ChartPoint.rahu.index];
+    var ahead = 0;
+    var behind = 0;
+    for (var p = 0; p < NatalChart.points; p++) {
+      if ((mask >> p) & 1 == 0) continue;
+      if ((longitudes[p] - rahu) % 360 < 180) {
+        ahead++;
+      } else {
+        behind++;
+      }
+    }
+    return ahead == 0 || behind == 0;
+  }
+}
@@ -0,0 +1,238 @@
+/// Yoga Rules
+///
+/// The classical yogas and doshas the [YogaEngine] detects, as declarative
+/// rules (Brihat Parashara Hora Shastra, Phaladeepika). Houses count from
+/// the lagna unless a rule says otherwise.
+library;
+
+import 'yoga.dart';
+
+const List<int> _kendras = [1, 4, 7, 10];
+const List<int> _dusthanas = [6, 8, 12];
+const List<int> _manglikHouses = [1, 2, 4, 7, 8, 12];
+
+/// Mars, Mercury, Jupiter, Venus and Saturn
+const List<ChartPoint> _taraGrahas = [
+  ChartPoint.mars,
+  ChartPoint.mercury,
+  ChartPoint.jupiter,
+  ChartPoint.venus,
+  ChartPoint.saturn,
+];
+
+const List<ChartPoint> _sevenGrahas = [
+  ChartPoint.sun,
+  ChartPoint.moon,
+  ..._taraGrahas,
+];
+
+/// Yoga Rules
+class YogaRules {
+  YogaRules._();
+
+  static const List<YogaRule> all = [
+    YogaRule(
+      'gaja_kesari',
+      'Gaja Kesari',
+      YogaKind.yoga,
+      InHouses(ChartPoint.jupiter, _kendras, from: ChartPoint.moon),
+      description: 'Jupiter in a kendra from the Moon: fame and wisdom',
+    ),
+    YogaRule(
+      'budha_aditya',
+      'Budha Aditya',
+      YogaKind.yoga,
+      InHouses(ChartPoint.mercury, [1], from: ChartPoint.sun),
+      description: 'Mercury with the Sun: intelligence and skill',
+    ),
+    YogaRule(
+      'chandra_mangala',
+      'Chandra Mangala',
+      YogaKind.yoga,
+      InHouses(ChartPoint.mars, [1], from: ChartPoint.moon),
+      description: 'Mars with the Moon: enterprise and earnings',
+    ),
+    // Pancha Mahapurusha yogas: own or exaltation sign, in a kendra
+    YogaRule(
+      'ruchaka',
+      'Ruchaka',
+      YogaKind.yoga,
+      AllOf([
+        InSigns(ChartPoint.mars, [0, 7, 9]),
+        InHouses(ChartPoint.mars, _kendras),
+      ]),
+      description: 'Mars strong in a kendra: courage and command',
+    ),
+    YogaRule(
+      'bhadra',
+      'Bhadra',
+      YogaKind.yoga,
+      AllOf([
+        InSigns(ChartPoint.mercury, [2, 5]),
+        InHouses(ChartPoint.mercury, _kendras),
+      ]),
+      description: 'Mercury strong in a kendra: learning and eloquence',
+    ),
+    YogaRule(
+      'hamsa',
+      'Hamsa',
+      YogaKind.yoga,
+      AllOf([
+        InSigns(ChartPoint.jupiter, [3, 8, 11]),
+        InHouses(ChartPoint.jupiter, _kendras),
+      ]),
+      description: 'Jupiter strong in a kendra: virtue and respect',
+    ),
+    YogaRule(
+      'malavya',
+      'Malavya',
+      YogaKind.yoga,
+      AllOf([
+        InSigns(ChartPoint.venus, [1, 6, 11]),
+        InHouses(ChartPoint.venus, _kendras),
+      ]),
+      description: 'Venus strong in a kendra: comfort and refinement',
+    ),
+    YogaRule(
+      'sasa',
+      'Sasa',
+      YogaKind.yoga,
+      AllOf([
+        InSigns(ChartPoint.saturn, [6, 9, 10]),
+        InHouses(ChartPoint.saturn, _kendras),
+      ]),
+      description: 'Saturn strong in a kendra: authority and endurance',
+    ),
+    YogaRule(
+      'raja',
+      'Raja',
+      YogaKind.yoga,
+      AnyOf([
+        LordsRelated(1, 5),
+        LordsRelated(1, 9),
+        LordsRelated(4, 5),
+        LordsRelated(4, 9),
+        LordsRelated(7, 5),
+        LordsRelated(7, 9),
+        LordsRelated(10, 5),
+        LordsRelated(10, 9),
+      ]),
+      description: 'A kendra lord joined with a trikona lord: rise in status',
+    ),
+    YogaRule(
+      'dhana',
+      'Dhana',
+      YogaKind.yoga,
+      AnyOf([
+        LordsRelated(2, 5),
+        LordsRelated(2, 9),
+        LordsRelated(2, 11),
+        LordsRelated(11, 5),
+        LordsRelated(11, 9),
+      ]),
+      description: 'Lords of wealth joined with trikona lords: prosperity',
+    ),
+    YogaRule(
+      'vipareeta_raja',
+      'Vipareeta Raja',
+      YogaKind.yoga,
+      AnyOf([
+        LordInHouses(6, _dusthanas),
+        LordInHouses(8, _dusthanas),
+        LordInHouses(12, _dusthanas),
+      ]),
+      description: 'A dusthana lord in a dusthana: success through adversity',
+    ),
+    YogaRule(
+      'adhi',
+      'Adhi',
+      YogaKind.yoga,
+      AllInHouses(
+        [ChartPoint.mercury, ChartPoint.jupiter, ChartPoint.venus],
+        [6, 7, 8],
+        from: ChartPoint.moon,
+      ),
+      description: 'Benefics in the 6th, 7th and 8th from the Moon: leadership',
+    ),
+    YogaRule(
+      'amala',
+      'Amala',
+      YogaKind.yoga,
+      AnyOf([
+        InHouses(ChartPoint.mercury, [10]),
+        InHouses(ChartPoint.jupiter, [10]),
+        InHouses(ChartPoint.venus, [10]),
+      ]),
+      description: 'A benefic in the 10th: lasting reputation',
+    ),
+    YogaRule(
+      'sunapha',
+      'Sunapha',
+      YogaKind.yoga,
+      Not(NoneInHouses(_taraGrahas, [2], from: ChartPoint.moon)),
+      description: 'A planet in the 2nd from the Moon: self-earned wealth',
+    ),
+    YogaRule(
+      'anapha',
+      'Anapha',
+      YogaKind.yoga,
+      Not(NoneInHouses(_taraGrahas, [12], from: ChartPoint.moon)),
+      description: 'A planet in the 12th from the Moon: health and charm',
+    ),
+    YogaRule(
+      'kemadruma',
+      'Kemadruma',
+      YogaKind.dosha,
+      AllOf([
+        NoneInHouses(_taraGrahas, [2, 12], from: ChartPoint.moon),
+        // Cancelled by planets in a kendra from the Moon
+        NoneInHouses(_taraGrahas, _kendras, from: ChartPoint.moon),
+      ]),
+      description: 'The Moon unsupported on both sides: hardship',
+    ),
+    YogaRule(
+      'shakata',
+      'Shakata',
+      YogaKind.dosha,
+      InHouses(ChartPoint.jupiter, _dusthanas, from: ChartPoint.moon),
+      description: 'Jupiter in a dusthana from the Moon: ups and downs',
+    ),
+    YogaRule(
+      'manglik',
+      'Manglik',
+      YogaKind.dosha,
+      AnyOf([
+        InHouses(ChartPoint.mars, _manglikHouses),
+        InHouses(ChartPoint.mars, _manglikHouses, from: ChartPoint.moon),
+        InHouses(ChartPoint.mars, _manglikHouses, from: ChartPoint.venus),
+      ]),
+      description: 'Mars afflicting the house of marriage (Kuja dosha)',
+    ),
+    YogaRule(
+      'kala_sarpa',
+      'Kala Sarpa',
+      YogaKind.dosha,
+      HemmedByNodes(_sevenGrahas),
+      description: 'All planets between Rahu and Ketu: delays and obstacles',
+    ),
+    YogaRule(
+      'guru_chandala',
+      'Guru Chandala',
+      YogaKind.dosha,
+      InHouses(ChartPoint.jupiter, [1], from: ChartPoint.rahu),
+      description: 'Jupiter with Rahu: misguided judgement',
+    ),
+    YogaRule(
+      'grahana',
+      'Grahana',
+      YogaKind.dosha,
+      AnyOf([
+        InHouses(ChartPoint.sun, [1], from: ChartPoint.rahu),
+        InHouses(ChartPoint.sun, [1], from: ChartPoint.ketu),
+        InHouses(ChartPoint.moon, [1], from: ChartPoint.rahu),
+        InHouses(ChartPoint.moon, [1], from: ChartPoint.ketu),
+      ]),
+      description: 'A luminary with a node: anxiety and setbacks',
+    ),
+  ];
+}
@@ -0,0 +1,310 @@
+/// Astro Request Handler
+///
+/// Answers the `AstrologyApiService` endpoints from the on-device engine,
+/// without Flutter, for the `skvk-astro` command-line tool and its HTTP
+/// mode: full birth chart, daily predictions and calendar month and year.
+/// Responses use the API's keys with times in UTC, as the backend sends
+/// them; `AstrologyServiceBridge` converts them as usual.
+///
+/// Calendar years are computed whole and kept in a small cache, so the
+/// twelve month requests of a year (or a batch of them) cost one sweep.
+/// One handler serves one isolate; the server runs one per core.
+library;
+
+import '../../calendar/calendar_exporter.dart';
+import '../../predictions/local/local_prediction_engine.dart';
+import '../engine/fingerprint.dart';
+import '../engine/lunar_calendar.dart';
+import '../engine/natal_chart.dart';
+import '../engine/panchang.dart';
+import '../engine/planetary_ephemeris.dart';
+import '../engine/vimshottari.dart';
+
+/// Status and JSON body of one request
+class AstroResponse {
+  final int status;
+  final Map<String, dynamic> body;
+
+  const AstroResponse(this.status, this.body);
+
+  /// Error in the API's `code`/`message`/`userMessage` shape
+  factory AstroResponse.error(int status, String code, String message) =>
+      AstroResponse(status, {
+        'code': code,
+        'message': message,
+        'userMessage': message,
+      });
+
+  bool get ok => status == 200;
+}
+
+/// Astro Request Handler
+class AstroRequestHandler {
+  static const String birthChartPath = '/api/v1/astrology/full-birth-chart';
+  static const String compatibilityPath = '/api/v1/astrology/compatibility';
+  static const String predictionsPath = '/api/v1/astrology/predictions';
+  static const String calendarYearPath = '/api/v1/calendar/year';
+  static const String calendarMonthPath = '/api/v1/calendar/month';
+
+  /// POST: a JSON list of `{"path": …, "query": {…}}`
+  static const String batchPath = '/api/v1/batch';
+
+  static const List<String> _planetNames = [
+    'Sun',
+    'Moon',
+    'Mars',
+    'Mercury',
+    'Jupiter',
+    'Venus',
+    'Saturn',
+    'Rahu',
+    'Ketu',
+  ];
+
+  /// Calendar years kept, most recently used last
+  final int yearCapacity;
+
+  final Map<String, List<Map<String, Object?>>> _years = {};
+
+  AstroRequestHandler({this.yearCapacity = 8});
+
+  /// Answer a GET of [path] with [query]
+  AstroResponse handle(String path, Map<String, String> query) {
+    try {
+      return switch (path) {
+        birthChartPath => _birthChart(query),
+        predictionsPath => _predictions(query),
+        calendarMonthPath => _calendarMonth(query),
+        calendarYearPath => _calendarYear(query),
+        compatibilityPath => AstroResponse.error(501, 'NOT_IMPLEMENTED',
+            'Compatibility is not computed on device'),
+        _ => AstroResponse.error(404, 'NOT_FOUND', 'No endpoint $path'),
+      };
+    } on FormatException catch (e) {
+      return AstroResponse.error(400, 'BAD_REQUEST', e.message);
+    }
+  }
+
+  /// Answer each request of a batch, in order
+  ///
+  /// Requests are evaluated grouped by endpoint and location so that the
+  /// calendar years they share are computed once.
+  List<AstroResponse> handleBatch(List<dynamic> requests) {
+    final parsed = <(String, Map<String, String>)>[];
+    for (final request in requests) {
+      if (request is! Map || request['path'] is! String) {
+        parsed.add(('', const {}));
+        continue;
+      }
+      final query = request['query'];
+      parsed.add((
+        request['path'] as String,
+        {
+          if (query is Map)
+            for (final entry in query.entries)
+              '${entry.key}': '${entry.value}',
+        },
+      ));
+    }
+
+    String group(int i) {
+      final (path, query) = parsed[i];
+      return '$path|${query['latitude']}|${query['longitude']}|'
+          '${query['year']}';
+    }
+
+    final order = [for (var i = 0; i < parsed.length; i++) i]
+      ..sort((a, b) => group(a).compareTo(group(b)));
+    final responses = List<AstroResponse?>.filled(parsed.length, null);
+    for (final i in order) {
+      final (path, query) = parsed[i];
+      responses[i] = path.isEmpty
+          ? AstroResponse.error(400, 'BAD_REQUEST', 'Request without path')
+          : handle(path, query);
+    }
+    return responses.cast<AstroResponse>();
+  }
+
+  AstroResponse _birthChart(Map<String, String> query) {
+    final date = _required(query, 'dateOfBirth');
+    final time = _required(query, 'timeOfBirth');
+    final birthUtc = DateTime.parse('${date}T${time}Z');
+    final ayanamsha = query['ayanamsha'] ?? 'lahiri';
+    final chart = NatalChart.compute(
+      birthUtc: birthUtc,
+      latitude: _number(query, 'latitude'),
+      longitude: _number(query, 'longitude'),
+      ayanamsha: ayanamsha,
+    );
+
+    final moon = MoonPosition(chart.longitude(Graha.moon)).toMap();
+    final dasha =
+        Vimshottari.at(chart.longitude(Graha.moon), birthUtc, DateTime.now());
+    Map<String, Object?> period(DashaPeriod p) => {
+          'lord': p.lord,
+          'startTime': p.start.toUtc().toIso8601String(),
+          'endTime': p.end.toUtc().toIso8601String(),
+        };
+
+    return AstroResponse(200, {
+      'source': 'local',
+      'birthDateTime': birthUtc.toIso8601String(),
+      'latitude': chart.latitude,
+      'longitude': chart.eastLongitude,
+      'ayanamsha': ayanamsha,
+      'rashi': moon['rashi'],
+      'nakshatra': moon['nakshatra'],
+      'pada': moon['pada'],
+      'birthChart': {
+        'ascendant': MoonPosition(chart.lagnaLongitude).toMap(),
+        'planetaryPositions': {
+          for (final graha in Graha.values)
+            _planetNames[graha.index]: {
+              ...MoonPosition(chart.longitude(graha)).toMap(),
+              'speed': chart.speeds[graha.index],
+              'isRetrograde': chart.speeds[graha.index] < 0,
+            },
+        },
+      },
+      'dasha': {
+        'mahadasha': period(dasha.mahadasha),
+        'antardasha': period(dasha.antardasha),
+      },
+      'fingerprint': chart.fingerprint,
+      'engineVersion': engineVersion,
+      'calculatedAt': DateTime.now().toUtc().toIso8601String(),
+    });
+  }
+
+  AstroResponse _predictions(Map<String, String> query) {
+    final type = _required(query, 'predictionType');
+    if (type != 'daily') {
+      return AstroResponse.error(501, 'NOT_IMPLEMENTED',
+          'Only daily predictions are computed on device');
+    }
+    final birthUtc = _utc(_required(query, 'birthDateTime'));
+    final ayanamsha = query['ayanamsha'] ?? 'lahiri';
+    final target = query['targetDate'];
+    final day = target == null || target.isEmpty
+        ? DateTime.now().toUtc()
+        : DateTime.parse('${target}T00:00:00Z');
+    // Six in the morning, local mean time at the current place
+    final hour = 6 - _number(query, 'currentLongitude') / 15;
+    final targetUtc = DateTime.utc(day.year, day.month, day.day)
+        .add(Duration(minutes: (hour * 60).round()));
+
+    final natal = MoonPosition.at(birthUtc, ayanamsha);
+    return AstroResponse(200, {
+      ...LocalPredictionEngine.daily(
+        natal: natal,
+        birthUtc: birthUtc,
+        targetUtc: targetUtc,
+        ayanamsha: ayanamsha,
+      ),
+      'predictionType': type,
+      'targetDate': _isoDate(day),
+      'calculatedAt': DateTime.now().toUtc().toIso8601String(),
+    });
+  }
+
+  AstroResponse _calendarMonth(Map<String, String> query) {
+    final year = _integer(query, 'year');
+    final month = _integer(query, 'month');
+    if (month < 1 || month > 12) {
+      throw FormatException('month $month');
+    }
+    final prefix = _isoDate(DateTime.utc(year, month)).substring(0, 8);
+    return AstroResponse(200, {
+      'year': year,
+      'month': month,
+      'region': query['region'],
+      'days': [
+        for (final day in _year(query, year))
+          if ((day['date'] as String).startsWith(prefix)) day,
+      ],
+      'calculatedAt': DateTime.now().toUtc().toIso8601String(),
+    });
+  }
+
+  AstroResponse _calendarYear(Map<String, String> query) {
+    final year = _integer(query, 'year');
+    final months = <String, Map<String, Object?>>{
+      for (var m = 1; m <= 12; m++) '$m': {'month': m, 'days': <Object?>[]},
+    };
+    for (final day in _year(query, year)) {
+      final month = int.parse((day['date'] as String).substring(5, 7));
+      (months['$month']!['days'] as List).add(day);
+    }
+    return AstroResponse(200, {
+      'year': year,
+      'region': query['region'],
+      'months': months,
+      'calculatedAt': DateTime.now().toUtc().toIso8601String(),
+    });
+  }
+
+  /// Day maps of [year] at the query's place, from the cache when present
+  List<Map<String, Object?>> _year(Map<String, String> query, int year) {
+    final latitude = _number(query, 'latitude');
+    final longitude = _number(query, 'longitude');
+    final ayanamsha = query['ayanamsha'] ?? 'lahiri';
+    final convention = MonthConvention.forRegion(query['region'] ?? '');
+    final key = '$year|$latitude|$longitude|$ayanamsha|${convention.name}';
+
+    final cached = _years.remove(key);
+    if (cached != null) return _years[key] = cached;
+
+    final exporter = CalendarExporter(
+      location: PanchangLocation(latitude, longitude),
+      ayanamsha: ayanamsha,
+      convention: convention,
+    );
+    final days = [
+      for (final day in exporter.days(
+          from: DateTime.utc(year), to: DateTime.utc(year, 12, 31)))
+        {
+          ...day.toJson(),
+          'festivals': [
+            for (final (_, name) in day.observances) {'name': name},
+          ],
+        },
+    ];
+    _years[key] = days;
+    while (_years.length > yearCapacity) {
+      _years.remove(_years.keys.first);
+    }
+    return days;
+  }
+
+  static String _isoDate(DateTime d) => d.toIso8601String().substring(0, 10);
+
+  /// [value] parsed as UTC when it has no offset, as the API sends it
+  static DateTime _utc(String value) {
+    final parsed = DateTime.parse(value);
+    if (parsed.isUtc) return parsed;
+    return DateTime.utc(parsed.year, parsed.month, parsed.day, parsed.hour,
+        parsed.minute, parsed.second, parsed.millisecond);
+  }
+
+  static String _required(Map<String, String> query, String name) {
+    final value = query[name];
+    if (value == null || value.isEmpty) {
+      throw FormatException('Missing $name');
+    }
+    return value;
+  }
+
+  static double _number(Map<String, String> query, String name) {
+    final value = double.tryParse(_required(query, name));
+    if (value == null || !value.isFinite) {
+      throw FormatException('$name is not a number');
+    }
+    return value;
+  }
+
+  static int _integer(Map<String, String> query, String name) {
+    final value = int.tryParse(_required(query, name));
+    if (value == null) throw FormatException('$name is not an integer');
+    return value;
+  }
+}
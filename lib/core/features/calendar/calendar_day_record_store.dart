@@ -0,0 +1,186 @@
+/// Calendar Day Record Store
+///
+/// Compact per-day calendar records packed into typed arrays, one block per
+/// year. Used by views that paint many days at once (year grid) so they don't
+/// have to walk the raw API maps for every cell.
+library;
+
+import 'dart:typed_data';
+
+/// Day flag bits
+class CalendarDayFlags {
+  static const int hasData = 1 << 0;
+  static const int festival = 1 << 1;
+  static const int amavasya = 1 << 2;
+  static const int purnima = 1 << 3;
+  static const int ekadashi = 1 << 4;
+}
+
+/// Packed records for one year
+///
+/// Indexed by day of year (0-based). Tithi and nakshatra hold the numeric
+/// ids (0 = unknown).
+class CalendarYearRecords {
+  final int year;
+  final Uint8List tithi;
+  final Uint8List nakshatra;
+  final Uint8List flags;
+
+  /// First festival name per day, only for days that have one
+  final Map<int, String> festivalNames = {};
+
+  /// Bumped on every ingest so painters can cheaply detect changes
+  int revision = 0;
+
+  CalendarYearRecords(this.year)
+      : tithi = Uint8List(366),
+        nakshatra = Uint8List(366),
+        flags = Uint8List(366);
+
+  int flagsFor(DateTime date) => flags[dayOfYear(date)];
+
+  bool hasFlag(DateTime date, int flag) => flagsFor(date) & flag != 0;
+
+  /// Number of festival days in a month
+  int festivalCount(int month) {
+    final start = dayOfYear(DateTime(year, month, 1));
+    final end = dayOfYear(DateTime(year, month + 1, 0));
+    var count = 0;
+    for (var i = start; i <= end; i++) {
+      if (flags[i] & CalendarDayFlags.festival != 0) count++;
+    }
+    return count;
+  }
+
+  /// 0-based day of year
+  static int dayOfYear(DateTime date) {
+    return DateTime.utc(date.year, date.month, date.day)
+        .difference(DateTime.utc(date.year, 1, 1))
+        .inDays;
+  }
+}
+
+/// Calendar Day Record Store
+///
+/// Fed from calendar month/year API responses; read synchronously by painters.
+class CalendarDayRecordStore {
+  static final CalendarDayRecordStore _instance =
+      CalendarDayRecordStore._internal();
+  factory CalendarDayRecordStore() => _instance;
+  CalendarDayRecordStore._internal();
+
+  static CalendarDayRecordStore get instance => _instance;
+
+  /// Keep a handful of years around; a year is ~1.1 KB
+  static const int _maxYears = 8;
+
+  final Map<String, CalendarYearRecords> _years = {};
+
+  String _key(String region, int year) => '$region:$year';
+
+  /// Records for [year] in [region], or null if nothing was ingested yet
+  CalendarYearRecords? recordsFor(String region, int year) {
+    return _years[_key(region, year)];
+  }
+
+  CalendarYearRecords _recordsOrCreate(String region, int year) {
+    final key = _key(region, year);
+    final existing = _years.remove(key);
+    final records = existing ?? CalendarYearRecords(year);
+    _years[key] = records; // Re-insert to keep most recent last
+
+    while (_years.length > _maxYears) {
+      _years.remove(_years.keys.first);
+    }
+    return records;
+  }
+
+  /// Ingest the 'days' list of a calendar month response
+  void ingestMonth(String region, int year, Map<String, dynamic> monthData) {
+    final days = monthData['days'];
+    if (days is! List) return;
+    final records = _recordsOrCreate(region, year);
+    for (final day in days) {
+      if (day is Map<String, dynamic>) {
+        _ingestDay(records, day);
+      }
+    }
+    records.revision++;
+  }
+
+  /// Ingest a calendar year response ('months' -> '1'..'12' -> 'days')
+  void ingestYear(String region, int year, Map<String, dynamic> yearData) {
+    final months = yearData['months'];
+    if (months is! Map) return;
+    final records = _recordsOrCreate(region, year);
+    for (final monthData in months.values) {
+      if (monthData is! Map) continue;
+      final days = monthData['days'];
+      if (days is! List) continue;
+      for (final day in days) {
+        if (day is Map<String, dynamic>) {
+          _ingestDay(records, day);
+        }
+      }
+    }
+    records.revision++;
+  }
+
+  void _ingestDay(CalendarYearRecords records, Map<String, dynamic> day) {
+    final rawDate = day['date'];
+    final date = rawDate is DateTime
+        ? rawDate
+        : rawDate is String
+            ? DateTime.tryParse(rawDate)
+            : null;
+    if (date == null || date.year != records.year) return;
+
+    final index = CalendarYearRecords.dayOfYear(date);
+    final tithiId = _numericId(day['tithi'] ?? day['tithiName']);
+    final nakshatraId = _numericId(day['nakshatra'] ?? day['nakshatraName']);
+
+    var flags = CalendarDayFlags.hasData;
+    final festivals = day['festivals'];
+    if (festivals is List && festivals.isNotEmpty) {
+      flags |= CalendarDayFlags.festival;
+      final first = festivals.first;
+      final name = first is Map ? first['name'] as String? : first?.toString();
+      if (name != null && name.isNotEmpty) {
+        records.festivalNames[index] = name;
+      }
+    } else {
+      records.festivalNames.remove(index);
+    }
+    if (day['isAmavasya'] == true || tithiId == 30) {
+      flags |= CalendarDayFlags.amavasya;
+    }
+    if (day['isPurnima'] == true || tithiId == 15) {
+      flags |= CalendarDayFlags.purnima;
+    }
+    if (tithiId == 11 || tithiId == 26) {
+      flags |= CalendarDayFlags.ekadashi;
+    }
+
+    records.tithi[index] = tithiId ?? 0;
+    records.nakshatra[index] = nakshatraId ?? 0;
+    records.flags[index] = flags;
+  }
+
+  /// Pull a numeric id out of `{number: 11}`, `{name: "Tithi 11"}`, 11 or "11"
+  int? _numericId(dynamic value) {
+    if (value == null) return null;
+    if (value is int) return value;
+    if (value is Map) {
+      final number = value['number'] ?? value['id'];
+      if (number is int) return number;
+      return _numericId(value['name']);
+    }
+    final match = RegExp(r'(\d+)').firstMatch(value.toString());
+    return match != null ? int.tryParse(match.group(1)!) : null;
+  }
+
+  /// Clear all records
+  void clear() {
+    _years.clear();
+  }
+}
@@ -0,0 +1,429 @@
+/// Calendar Exporter
+///
+/// Streams the on-device panchang and its observances (Ekadashi, Purnima,
+/// Amavasya, sankrantis and adhika masas) for a location as iCalendar
+/// (RFC 5545) or newline-delimited JSON. The range is walked a year at a
+/// time: one [LunarCalendar.scan] per year feeds both month naming and
+/// [Panchang.batch], and every day is written as soon as it is computed,
+/// so memory stays constant however many years are exported.
+///
+/// A tithi's observance is kept on the day of the first sunrise within the
+/// tithi or, for a kshaya tithi that no sunrise falls in, on the day it
+/// begins and ends in.
+///
+/// Pure Dart apart from [exportToFile]'s `dart:io`.
+library;
+
+import 'dart:convert';
+import 'dart:io';
+import '../astrology/engine/astro_time.dart';
+import '../astrology/engine/lunar_calendar.dart';
+import '../astrology/engine/panchang.dart';
+import '../astrology/engine/precision.dart';
+
+/// Output format
+enum ExportFormat { ics, ndjson }
+
+/// Panchang quantities with display names
+enum PanchangLimb { tithi, nakshatra, yoga, karana, paksha }
+
+/// Display name of [limb] number [id], 1-based as `AstrologyNameService`
+/// numbers them (tithi 1 … 30, karana 1 Bava … 11 Kimstughna)
+typedef PanchangNamer = String Function(PanchangLimb limb, int id);
+
+/// Calendar Exporter
+class CalendarExporter {
+  final PanchangLocation location;
+  final String ayanamsha;
+  final MonthConvention convention;
+  final PanchangNamer names;
+  final Precision precision;
+
+  /// Also write one all-day iCalendar event per day with its panchang;
+  /// otherwise only observances. NDJSON always has every day.
+  final bool dailyPanchang;
+
+  /// Local time of a UTC instant, for the times in iCalendar descriptions
+  /// (NDJSON keeps the API's UTC)
+  final DateTime Function(DateTime utc) localTime;
+
+  /// Name of [localTime]'s zone, the calendar's `X-WR-TIMEZONE`
+  final String timeZone;
+
+  const CalendarExporter({
+    required this.location,
+    this.ayanamsha = 'lahiri',
+    this.convention = MonthConvention.amanta,
+    this.names = idNames,
+    this.precision = Precision.standard,
+    this.dailyPanchang = false,
+    this.localTime = utcTime,
+    this.timeZone = 'UTC',
+  });
+
+  static DateTime utcTime(DateTime utc) => utc.toUtc();
+
+  /// Names as the server sends them, "Tithi 11", for readers that localize
+  /// with `AstrologyNameService.get…NameFromString`
+  static String idNames(PanchangLimb limb, int id) {
+    final label = limb.name;
+    return '${label[0].toUpperCase()}${label.substring(1)} $id';
+  }
+
+  static const List<String> _rashis = [
+    'Mesha',
+    'Vrishabha',
+    'Mithuna',
+    'Karka',
+    'Simha',
+    'Kanya',
+    'Tula',
+    'Vrishchika',
+    'Dhanu',
+    'Makara',
+    'Kumbha',
+    'Meena',
+  ];
+
+  /// Days computed per sweep
+  static const int _chunkDays = 366;
+
+  /// Margin of the sweep around a chunk: the lunar months overlapping its
+  /// ends must be complete
+  static const Duration _margin = Duration(days: 45);
+
+  /// Every civil date [from] … [to] (inclusive) in order, computed a
+  /// year at a time and not retained
+  Iterable<CalendarExportDay> days({
+    required DateTime from,
+    required DateTime to,
+  }) sync* {
+    final first = DateTime.utc(from.year, from.month, from.day);
+    final last = DateTime.utc(to.year, to.month, to.day);
+    var wasAdhika = false;
+    var chunk = first;
+    while (!chunk.isAfter(last)) {
+      final remaining = last.difference(chunk).inDays + 1;
+      final days = remaining < _chunkDays ? remaining : _chunkDays;
+      final events = LunarCalendar.scan(
+        chunk.subtract(_margin),
+        chunk.add(Duration(days: days) + _margin),
+        ayanamsha: ayanamsha,
+        precision: precision,
+        kinds: SkyEventKind.values.toSet(),
+      );
+      final months = LunarCalendar.months(events, convention: convention);
+      // One day either side for the neighbouring sunrises
+      final table = Panchang.batch(
+        [location],
+        start: chunk.subtract(const Duration(days: 1)),
+        days: days + 2,
+        ayanamsha: ayanamsha,
+        precision: precision,
+        events: events,
+      );
+      DateTime sunrise(int d) {
+        final day = table.day(0, d + 1);
+        return day.sunrise ?? day.date.add(const Duration(hours: 12));
+      }
+
+      var month = 0;
+      var previous = julianDayUt(sunrise(-1));
+      for (var d = 0; d < days; d++) {
+        final day = table.day(0, d + 1);
+        final at = sunrise(d);
+        final jd = julianDayUt(at);
+        final next = julianDayUt(sunrise(d + 1));
+        while (month < months.length - 1 && !at.isBefore(months[month].end)) {
+          month++;
+        }
+        final lunar = month < months.length && months[month].contains(at)
+            ? months[month]
+            : null;
+
+        final observances = <(String, String)>[];
+        void observe(String key, String name) => observances.add((key, name));
+        for (final tithi in _observedTithis(events, previous, jd, next)) {
+          switch (tithi) {
+            case 10 || 25:
+              observe('ekadashi', names(PanchangLimb.tithi, tithi + 1));
+            case 14:
+              observe('purnima', names(PanchangLimb.tithi, 15));
+            case 29:
+              observe('amavasya', names(PanchangLimb.tithi, 30));
+          }
+        }
+        // A sankranti is kept on the first sunrise after it
+        final sankranti = events.nextAfter(SkyEventKind.sankranti, previous);
+        if (sankranti <= jd) {
+          final rashi = events.valueAt(SkyEventKind.sankranti, sankranti);
+          observe('sankranti', '${_rashis[rashi]} Sankranti');
+        }
+        final adhika = lunar?.adhika ?? false;
+        if (adhika && !wasAdhika) observe('adhika', '${lunar!.name} begins');
+        wasAdhika = adhika;
+        previous = jd;
+
+        yield CalendarExportDay._(this, day, lunar, observances);
+      }
+      chunk = chunk.add(Duration(days: days));
+    }
+  }
+
+  /// Tithis observed on the day from sunrise [jd] to sunrise [next]: the
+  /// one current at [jd] unless the [previous] sunrise already saw it, and
+  /// any that begin and end before [next]
+  static Iterable<int> _observedTithis(
+      SkyEvents events, double previous, double jd, double next) sync* {
+    if (events.nextAfter(SkyEventKind.tithi, previous) <= jd) {
+      yield events.valueAt(SkyEventKind.tithi, jd);
+    }
+    var start = events.nextAfter(SkyEventKind.tithi, jd);
+    while (start <= next) {
+      final end = events.nextAfter(SkyEventKind.tithi, start);
+      // Current at the next sunrise, so that day's
+      if (!(end <= next)) break;
+      yield events.valueAt(SkyEventKind.tithi, start);
+      start = end;
+    }
+  }
+
+  /// Write [days] to [sink]; returns the number of days written. [stamp]
+  /// is the iCalendar DTSTAMP.
+  int export(
+    StringSink sink, {
+    required DateTime from,
+    required DateTime to,
+    ExportFormat format = ExportFormat.ndjson,
+    DateTime? stamp,
+  }) {
+    final ics = format == ExportFormat.ics;
+    final dtStamp = _icsTime((stamp ?? DateTime.now()).toUtc());
+    if (ics) {
+      _icsLine(sink, 'BEGIN:VCALENDAR');
+      _icsLine(sink, 'VERSION:2.0');
+      _icsLine(sink, '-//SKVK//Panchang Export//EN', 'PRODID:');
+      _icsLine(sink, 'CALSCALE:GREGORIAN');
+      _icsLine(sink, _icsText(timeZone), 'X-WR-TIMEZONE:');
+    }
+
+    var written = 0;
+    for (final day in days(from: from, to: to)) {
+      if (ics) {
+        _writeIcsDay(sink, day, dtStamp);
+      } else {
+        sink.writeln(jsonEncode(day.toJson()));
+      }
+      written++;
+    }
+
+    if (ics) _icsLine(sink, 'END:VCALENDAR');
+    return written;
+  }
+
+  /// [export] to a file at [path], written through a small buffer
+  int exportToFile(
+    String path, {
+    required DateTime from,
+    required DateTime to,
+    ExportFormat format = ExportFormat.ndjson,
+    DateTime? stamp,
+  }) {
+    final file = File(path).openSync(mode: FileMode.write);
+    final sink = _FileSink(file);
+    try {
+      return export(sink, from: from, to: to, format: format, stamp: stamp);
+    } finally {
+      sink.flush();
+      file.closeSync();
+    }
+  }
+
+  void _writeIcsDay(StringSink sink, CalendarExportDay export, String dtStamp) {
+    final day = export.panchang;
+    final lunar = export.month;
+    final date = _icsDate(day.date);
+    final next = _icsDate(day.date.add(const Duration(days: 1)));
+    final tithi = names(PanchangLimb.tithi, day.tithi + 1);
+    final nakshatra = names(PanchangLimb.nakshatra, day.nakshatra + 1);
+    final summary = [
+      if (lunar != null) lunar.name,
+      names(PanchangLimb.paksha, export.paksha),
+      tithi,
+    ].join(' · ');
+    final description = [
+      '$tithi until ${_clock(day.tithiEnd)}',
+      '$nakshatra until ${_clock(day.nakshatraEnd)}',
+      '${names(PanchangLimb.yoga, day.yoga + 1)} until '
+          '${_clock(day.yogaEnd)}',
+      names(PanchangLimb.karana, day.karana.index + 1),
+      if (day.sunrise != null) 'Sunrise ${_clock(day.sunrise)}',
+      if (day.sunset != null) 'Sunset ${_clock(day.sunset)}',
+      'Times in $timeZone',
+    ].join('\n');
+
+    void event(String key, String title) {
+      _icsLine(sink, 'BEGIN:VEVENT');
+      _icsLine(sink, '$date-$key@skvk', 'UID:');
+      _icsLine(sink, dtStamp, 'DTSTAMP:');
+      _icsLine(sink, date, 'DTSTART;VALUE=DATE:');
+      _icsLine(sink, next, 'DTEND;VALUE=DATE:');
+      _icsLine(sink, _icsText(title), 'SUMMARY:');
+      _icsLine(sink, _icsText(description), 'DESCRIPTION:');
+      _icsLine(sink, 'TRANSP:TRANSPARENT');
+      _icsLine(sink, 'END:VEVENT');
+    }
+
+    for (final (key, name) in export.observances) {
+      event(key, name);
+    }
+    if (dailyPanchang) event('panchang', summary);
+  }
+
+  static String _two(int n) => n.toString().padLeft(2, '0');
+
+  /// "2024-01-21 19:26" in [timeZone]
+  String _clock(DateTime? utc) {
+    if (utc == null) return '-';
+    final local = localTime(utc);
+    return '${_isoDate(local)} ${_two(local.hour)}:${_two(local.minute)}';
+  }
+
+  static String _isoDate(DateTime d) =>
+      '${d.year.toString().padLeft(4, '0')}-${_two(d.month)}-${_two(d.day)}';
+
+  static String _icsDate(DateTime d) =>
+      '${d.year.toString().padLeft(4, '0')}${_two(d.month)}${_two(d.day)}';
+
+  static String _icsTime(DateTime t) =>
+      '${_icsDate(t)}T${_two(t.hour)}${_two(t.minute)}${_two(t.second)}Z';
+
+  /// TEXT value escaping (RFC 5545 3.3.11)
+  static String _icsText(String value) => value
+      .replaceAll('\\', '\\\\')
+      .replaceAll(';', '\\;')
+      .replaceAll(',', '\\,')
+      .replaceAll('\n', '\\n');
+
+  /// One content line, [name] then [value], folded at 75 octets without
+  /// splitting a UTF-8 sequence, ended by CRLF
+  static void _icsLine(StringSink sink, String value, [String name = '']) {
+    final line = '$name$value';
+    var octets = 0, start = 0;
+    for (var i = 0; i < line.length; i++) {
+      final unit = line.codeUnitAt(i);
+      // Low surrogates were counted with their high surrogate
+      if (unit >= 0xDC00 && unit < 0xE000) continue;
+      final size = unit < 0x80
+          ? 1
+          : unit < 0x800
+              ? 2
+              : unit >= 0xD800 && unit < 0xDC00
+                  ? 4
+                  : 3;
+      // Continuation lines start with a space, which counts
+      if (octets + size > 75) {
+        sink
+          ..write(line.substring(start, i))
+          ..write('\r\n ');
+        start = i;
+        octets = 1;
+      }
+      octets += size;
+    }
+    sink
+      ..write(line.substring(start))
+      ..write('\r\n');
+  }
+}
+
+/// One exported date
+class CalendarExportDay {
+  final CalendarExporter _exporter;
+
+  final PanchangDay panchang;
+
+  /// Lunar month at sunrise; null only at the edges of the sky data
+  final LunarMonth? month;
+
+  /// (key, display name) of the date's observances; the key is one of
+  /// `ekadashi`, `purnima`, `amavasya`, `sankranti` and `adhika`
+  final List<(String, String)> observances;
+
+  const CalendarExportDay._(
+      this._exporter, this.panchang, this.month, this.observances);
+
+  /// Paksha, 1 (Shukla) or 2 (Krishna)
+  int get paksha => panchang.tithi < 15 ? 1 : 2;
+
+  /// Day map in the shape of the calendar month API's `days` entries,
+  /// with UTC times; the NDJSON record
+  Map<String, Object?> toJson() {
+    final names = _exporter.names;
+    final day = panchang;
+    Map<String, Object?> limb(PanchangLimb kind, int id, DateTime? end) => {
+          'id': id,
+          'name': names(kind, id),
+          if (end != null) 'end': end.toIso8601String(),
+        };
+    return {
+      'date': CalendarExporter._isoDate(day.date),
+      'vaara': day.vaara,
+      'sunrise': day.sunrise?.toIso8601String(),
+      'sunset': day.sunset?.toIso8601String(),
+      'month': month?.name,
+      'adhika': month?.adhika ?? false,
+      'paksha': limb(PanchangLimb.paksha, paksha, null),
+      'tithi': limb(PanchangLimb.tithi, day.tithi + 1, day.tithiEnd),
+      'nakshatra':
+          limb(PanchangLimb.nakshatra, day.nakshatra + 1, day.nakshatraEnd),
+      'yoga': limb(PanchangLimb.yoga, day.yoga + 1, day.yogaEnd),
+      'karana': limb(PanchangLimb.karana, day.karana.index + 1, null),
+      'observances': [for (final (_, name) in observances) name],
+    };
+  }
+}
+
+/// [StringSink] over a file that writes in 64 KB blocks
+class _FileSink implements StringSink {
+  final RandomAccessFile _file;
+  final StringBuffer _buffer = StringBuffer();
+
+  _FileSink(this._file);
+
+  static const int _blockSize = 1 << 16;
+
+  void _maybeFlush() {
+    if (_buffer.length >= _blockSize) flush();
+  }
+
+  void flush() {
+    if (_buffer.isEmpty) return;
+    _file.writeStringSync(_buffer.toString());
+    _buffer.clear();
+  }
+
+  @override
+  void write(Object? object) {
+    _buffer.write(object);
+    _maybeFlush();
+  }
+
+  @override
+  void writeAll(Iterable<dynamic> objects, [String separator = '']) {
+    _buffer.writeAll(objects, separator);
+    _maybeFlush();
+  }
+
+  @override
+  void writeCharCode(int charCode) {
+    _buffer.writeCharCode(charCode);
+    _maybeFlush();
+  }
+
+  @override
+  void writeln([Object? object = '']) {
+    _buffer.writeln(object);
+    _maybeFlush();
+  }
+}
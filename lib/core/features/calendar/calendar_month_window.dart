@@ -0,0 +1,244 @@
+/// Calendar Month Window
+///
+/// Keeps a window of months around the visible month materialized for the
+/// scrolling month timeline. Months are fetched in priority order (visible,
+/// then adjacent, then far) and work for months that leave the window is
+/// dropped.
+library;
+
+import 'dart:collection';
+import 'package:flutter/foundation.dart';
+import '../../logging/logging_helper.dart';
+import '../../services/astrology/astrology_service_bridge.dart';
+import '../../services/startup/startup_snapshot_service.dart';
+import 'calendar_day_record_store.dart';
+import 'calendar_session_context.dart';
+
+/// Fetch priority of a month relative to the visible one
+enum CalendarMonthPriority {
+  visible,
+  adjacent,
+  far,
+}
+
+/// A materialized month
+class CalendarMonthSlot {
+  final DateTime month;
+  final Map<String, dynamic> data;
+
+  /// Day maps indexed by day of month, for O(1) cell lookups
+  final Map<int, Map<String, dynamic>> daysByNumber;
+
+  CalendarMonthSlot(this.month, this.data)
+      : daysByNumber = _indexDays(month, data);
+
+  static Map<int, Map<String, dynamic>> _indexDays(
+      DateTime month, Map<String, dynamic> data) {
+    final index = <int, Map<String, dynamic>>{};
+    final days = data['days'];
+    if (days is! List) return index;
+    for (final day in days) {
+      if (day is! Map<String, dynamic>) continue;
+      final rawDate = day['date'];
+      final date = rawDate is DateTime
+          ? rawDate
+          : rawDate is String
+              ? DateTime.tryParse(rawDate)
+              : null;
+      if (date != null &&
+          date.year == month.year &&
+          date.month == month.month) {
+        index[date.day] = day;
+      }
+    }
+    return index;
+  }
+}
+
+/// Calendar Month Window
+///
+/// Data window manager behind the month timeline:
+/// - keeps ±[radius] months around the focus materialized
+/// - fetches at most [maxConcurrent] months at a time, highest priority first
+/// - drops queued work for months scrolled out of the window and discards
+///   late results for them
+/// - resolves location/timezone once via [CalendarSessionContext]
+class CalendarMonthWindow extends ChangeNotifier {
+  final String region;
+  final String ayanamsha;
+  final int radius;
+  final int maxConcurrent;
+
+  CalendarMonthWindow({
+    required this.region,
+    required this.ayanamsha,
+    this.radius = 3,
+    this.maxConcurrent = 2,
+  });
+
+  final Map<int, CalendarMonthSlot> _slots = {};
+  final SplayTreeMap<int, CalendarMonthPriority> _queue = SplayTreeMap();
+  final Set<int> _inFlight = {};
+  final Map<int, Object> _errors = {};
+  int _focusKey = 0;
+  bool _disposed = false;
+
+  /// Months whose fetch was dropped or discarded (for diagnostics)
+  int cancelledCount = 0;
+
+  static int _keyOf(DateTime month) => month.year * 12 + (month.month - 1);
+
+  static DateTime _monthOf(int key) => DateTime(key ~/ 12, key % 12 + 1);
+
+  /// Materialized month, or null if not loaded yet
+  CalendarMonthSlot? slotFor(DateTime month) => _slots[_keyOf(month)];
+
+  /// Whether the month is being (or about to be) fetched
+  bool isPending(DateTime month) {
+    final key = _keyOf(month);
+    return _queue.containsKey(key) || _inFlight.contains(key);
+  }
+
+  /// Last error for a month, if its fetch failed
+  Object? errorFor(DateTime month) => _errors[_keyOf(month)];
+
+  CalendarMonthPriority _priorityFor(int key) {
+    final distance = (key - _focusKey).abs();
+    if (distance == 0) return CalendarMonthPriority.visible;
+    if (distance == 1) return CalendarMonthPriority.adjacent;
+    return CalendarMonthPriority.far;
+  }
+
+  /// Move the window so [month] is the visible month
+  void setFocus(DateTime month) {
+    if (_disposed) return;
+    _focusKey = _keyOf(month);
+    final first = _focusKey - radius;
+    final last = _focusKey + radius;
+
+    // Drop work and data outside the window
+    final dropped = _queue.keys.where((k) => k < first || k > last).toList();
+    for (final key in dropped) {
+      _queue.remove(key);
+      cancelledCount++;
+    }
+    _slots.removeWhere((key, _) => key < first || key > last);
+    _errors.removeWhere((key, _) => key < first || key > last);
+
+    // (Re)queue everything missing inside the window with fresh priorities
+    for (var key = first; key <= last; key++) {
+      if (_slots.containsKey(key) || _inFlight.contains(key)) continue;
+      _queue[key] = _priorityFor(key);
+    }
+
+    _pump();
+  }
+
+  /// Re-fetch a month (e.g. after an error)
+  void retry(DateTime month) {
+    final key = _keyOf(month);
+    _errors.remove(key);
+    _slots.remove(key);
+    if (!_inFlight.contains(key)) {
+      _queue[key] = _priorityFor(key);
+    }
+    _pump();
+  }
+
+  int? _nextKey() {
+    int? best;
+    CalendarMonthPriority? bestPriority;
+    for (final entry in _queue.entries) {
+      if (bestPriority == null || entry.value.index < bestPriority.index) {
+        best = entry.key;
+        bestPriority = entry.value;
+        if (bestPriority == CalendarMonthPriority.visible) break;
+      }
+    }
+    return best;
+  }
+
+  void _pump() {
+    while (!_disposed && _inFlight.length < maxConcurrent) {
+      final key = _nextKey();
+      if (key == null) return;
+      _queue.remove(key);
+      _inFlight.add(key);
+      _fetch(key);
+    }
+  }
+
+  Future<void> _fetch(int key) async {
+    final month = _monthOf(key);
+    try {
+      final session = await CalendarSessionContext.resolve();
+
+      final data = await AstrologyServiceBridge.instance.getCalendarMonth(
+        year: month.year,
+        month: month.month,
+        region: region,
+        latitude: session.latitude,
+        longitude: session.longitude,
+        timezoneId: session.timezoneId,
+        ayanamsha: ayanamsha,
+      );
+
+      if (_disposed) return;
+      if ((key - _focusKey).abs() > radius) {
+        // Scrolled away while in flight - discard
+        cancelledCount++;
+        return;
+      }
+
+      final slot = CalendarMonthSlot(month, data);
+      _slots[key] = slot;
+      _errors.remove(key);
+      CalendarDayRecordStore.instance.ingestMonth(region, month.year, data);
+      _recordToday(slot);
+      notifyListeners();
+    } catch (e) {
+      if (_disposed) return;
+      _errors[key] = e;
+      LoggingHelper.logError('Failed to load calendar month $month',
+          source: 'CalendarMonthWindow', error: e);
+      notifyListeners();
+    } finally {
+      _inFlight.remove(key);
+      _pump();
+    }
+  }
+
+  /// Keep today's panchang summary in the startup snapshot
+  void _recordToday(CalendarMonthSlot slot) {
+    final today = DateTime.now();
+    if (slot.month.year != today.year || slot.month.month != today.month) {
+      return;
+    }
+    final day = slot.daysByNumber[today.day];
+    if (day == null) return;
+
+    String nameOf(dynamic value) =>
+        value is Map ? value['name'] as String? ?? '' : value?.toString() ?? '';
+    final tithi = nameOf(day['tithi'] ?? day['tithiName']);
+    final nakshatra = nameOf(day['nakshatra'] ?? day['nakshatraName']);
+    if (tithi.isEmpty && nakshatra.isEmpty) return;
+
+    final festivals = day['festivals'];
+    StartupSnapshotService.instance.recordPanchang(
+      date: today,
+      tithi: tithi,
+      nakshatra: nakshatra,
+      festival: festivals is List && festivals.isNotEmpty
+          ? nameOf(festivals.first)
+          : null,
+    );
+  }
+
+  @override
+  void dispose() {
+    _disposed = true;
+    _queue.clear();
+    _slots.clear();
+    super.dispose();
+  }
+}
@@ -0,0 +1,86 @@
+/// Calendar Session Context
+///
+/// Location and timezone used by the calendar views, resolved once per app
+/// session instead of on every month/year change.
+library;
+
+import '../../services/location/simple_location_service.dart';
+import '../../utils/astrology/timezone_util.dart';
+
+/// Resolved location and timezone for calendar calculations
+class CalendarSessionContext {
+  final double latitude;
+  final double longitude;
+  final String timezoneId;
+
+  const CalendarSessionContext({
+    required this.latitude,
+    required this.longitude,
+    required this.timezoneId,
+  });
+
+  static Future<CalendarSessionContext>? _pending;
+
+  /// Resolve location and timezone once; later calls share the result
+  ///
+  /// A failed resolution is not cached, so the next call retries.
+  static Future<CalendarSessionContext> resolve() {
+    return _pending ??= _resolve().catchError((Object e) {
+      _pending = null;
+      throw e;
+    });
+  }
+
+  /// Forget the resolved context (e.g. after the user moves)
+  static void invalidate() {
+    _pending = null;
+  }
+
+  static Future<CalendarSessionContext> _resolve() async {
+    // Get device location with fallback to country-level location
+    final locationResult =
+        await SimpleLocationService().getDeviceLocationWithFallback();
+
+    if (!locationResult.isSuccess ||
+        locationResult.latitude == null ||
+        locationResult.longitude == null) {
+      throw Exception('Failed to get location: ${locationResult.error}');
+    }
+
+    final latitude = locationResult.latitude!;
+    final longitude = locationResult.longitude!;
+
+    await TimezoneUtil.initialize();
+
+    return CalendarSessionContext(
+      latitude: latitude,
+      longitude: longitude,
+      timezoneId: timezoneIdFor(latitude, longitude),
+    );
+  }
+
+  /// Get timezone ID from coordinates or use default
+  static String timezoneIdFor(double latitude, double longitude) {
+    // For simplicity, use a default timezone based on longitude
+    // In production, you might want to use a timezone lookup service
+    final offsetHours = (longitude / 15.0).round();
+
+    // Map common timezones (simplified)
+    if (offsetHours >= 5 && offsetHours <= 6) {
+      return 'Asia/Kolkata'; // India
+    } else if (offsetHours >= -5 && offsetHours <= -4) {
+      return 'America/New_York'; // US East
+    } else if (offsetHours >= -8 && offsetHours <= -7) {
+      return 'America/Los_Angeles'; // US West
+    } else if (offsetHours >= 0 && offsetHours <= 1) {
+      return 'Europe/London'; // UK
+    } else if (offsetHours >= 8 && offsetHours <= 9) {
+      return 'Asia/Shanghai'; // China
+    } else if (offsetHours >= 9 && offsetHours <= 10) {
+      return 'Asia/Tokyo'; // Japan
+    }
+
+    // Default to India timezone
+    return 'Asia/Kolkata';
+  }
+}
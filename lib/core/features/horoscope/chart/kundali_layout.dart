@@ -0,0 +1,605 @@
+/// Kundali Layout
+///
+/// Converts a birth chart map into a compact display list for drawing a
+/// kundali diagram: house polygons, collision-free planet glyph placements
+/// and graha drishti (aspect) links. Coordinates are in a unit square.
+///
+/// Building a display list is pure Dart and done once per (chart, style);
+/// results are cached by [KundaliLayoutCache].
+library;
+
+import 'dart:collection';
+import 'dart:math' as math;
+import 'dart:typed_data';
+
+/// Regional kundali drawing styles
+enum KundaliChartStyle {
+  /// Diamond layout, houses fixed, signs rotate with the ascendant
+  northIndian,
+
+  /// 4x4 ring, signs fixed (Pisces top-left), ascendant marked
+  southIndian,
+
+  /// 3x3 grid with split corners, signs fixed (Aries top-centre)
+  eastIndian,
+}
+
+/// What a glyph represents
+enum KundaliGlyphKind {
+  planet,
+  signNumber,
+  ascendant,
+}
+
+/// A positioned text glyph (centre point, unit coordinates)
+class KundaliGlyph {
+  final String label;
+  final double x;
+  final double y;
+  final KundaliGlyphKind kind;
+
+  /// Scale relative to the default glyph size (shrunk when a house is full)
+  final double scale;
+
+  const KundaliGlyph({
+    required this.label,
+    required this.x,
+    required this.y,
+    required this.kind,
+    this.scale = 1.0,
+  });
+}
+
+/// A drishti link from one cell to another (cell indices into polygons)
+class KundaliAspect {
+  final String planet;
+  final int fromCell;
+  final int toCell;
+
+  const KundaliAspect(this.planet, this.fromCell, this.toCell);
+}
+
+/// Compact display list for one chart in one style
+class KundaliDisplayList {
+  final String key;
+  final KundaliChartStyle style;
+
+  /// Polygon vertices as x,y pairs, all cells back to back
+  final Float32List points;
+
+  /// Start offset (in points, not floats) of each cell's polygon, plus a
+  /// trailing end offset
+  final Int32List cellOffsets;
+
+  /// Cell index per zodiac sign (0 = Aries)
+  final List<int> cellForSign;
+
+  final List<KundaliGlyph> glyphs;
+  final List<KundaliAspect> aspects;
+
+  /// Outer frame lines (x1,y1,x2,y2 quads) that aren't cell edges
+  final Float32List frameLines;
+
+  const KundaliDisplayList({
+    required this.key,
+    required this.style,
+    required this.points,
+    required this.cellOffsets,
+    required this.cellForSign,
+    required this.glyphs,
+    required this.aspects,
+    required this.frameLines,
+  });
+
+  int get cellCount => cellOffsets.length - 1;
+
+  /// Centroid of a cell polygon
+  (double, double) cellCentroid(int cell) {
+    final start = cellOffsets[cell];
+    final end = cellOffsets[cell + 1];
+    var x = 0.0;
+    var y = 0.0;
+    for (var i = start; i < end; i++) {
+      x += points[i * 2];
+      y += points[i * 2 + 1];
+    }
+    final n = end - start;
+    return (x / n, y / n);
+  }
+}
+
+/// Planet placement extracted from the chart map
+class _PlanetPlacement {
+  final String name;
+  final int sign;
+  final double longitude;
+
+  const _PlanetPlacement(this.name, this.sign, this.longitude);
+}
+
+/// Kundali Layout builder
+class KundaliLayout {
+  KundaliLayout._();
+
+  static const List<String> signNames = [
+    'Aries',
+    'Taurus',
+    'Gemini',
+    'Cancer',
+    'Leo',
+    'Virgo',
+    'Libra',
+    'Scorpio',
+    'Sagittarius',
+    'Capricorn',
+    'Aquarius',
+    'Pisces',
+  ];
+
+  static const List<String> _planetOrder = [
+    'Sun',
+    'Moon',
+    'Mars',
+    'Mercury',
+    'Jupiter',
+    'Venus',
+    'Saturn',
+    'Rahu',
+    'Ketu',
+  ];
+
+  static const Map<String, String> planetAbbreviations = {
+    'Sun': 'Su',
+    'Moon': 'Mo',
+    'Mars': 'Ma',
+    'Mercury': 'Me',
+    'Jupiter': 'Ju',
+    'Venus': 'Ve',
+    'Saturn': 'Sa',
+    'Rahu': 'Ra',
+    'Ketu': 'Ke',
+  };
+
+  /// Special graha drishti (counted from the planet's own house, 7th is common)
+  static const Map<String, List<int>> _specialAspects = {
+    'Mars': [4, 8],
+    'Jupiter': [5, 9],
+    'Saturn': [3, 10],
+  };
+
+  /// Default glyph box size in unit coordinates
+  static const double glyphWidth = 0.075;
+  static const double glyphHeight = 0.045;
+
+  /// Cache key for a chart; changes whenever a drawn placement changes
+  static String chartKey(Map<String, dynamic> birthChart) {
+    final buffer = StringBuffer();
+    buffer.write(_ascendantSign(birthChart));
+    for (final planet in _placements(birthChart)) {
+      buffer
+        ..write('|')
+        ..write(planet.name)
+        ..write(':')
+        ..write(planet.longitude.toStringAsFixed(2))
+        ..write('@')
+        ..write(planet.sign);
+    }
+    return buffer.toString();
+  }
+
+  /// Build the display list for [birthChart] in [style]
+  static KundaliDisplayList build(
+    Map<String, dynamic> birthChart,
+    KundaliChartStyle style, {
+    String? key,
+  }) {
+    final ascendant = _ascendantSign(birthChart);
+    final planets = _placements(birthChart);
+
+    final geometry = switch (style) {
+      KundaliChartStyle.northIndian => _northIndianGeometry(ascendant),
+      KundaliChartStyle.southIndian => _southIndianGeometry(),
+      KundaliChartStyle.eastIndian => _eastIndianGeometry(),
+    };
+
+    final points = Float32List(geometry.vertexCount * 2);
+    final offsets = Int32List(geometry.polygons.length + 1);
+    var cursor = 0;
+    for (var cell = 0; cell < geometry.polygons.length; cell++) {
+      offsets[cell] = cursor;
+      for (final (x, y) in geometry.polygons[cell]) {
+        points[cursor * 2] = x;
+        points[cursor * 2 + 1] = y;
+        cursor++;
+      }
+    }
+    offsets[geometry.polygons.length] = cursor;
+
+    final glyphs = <KundaliGlyph>[];
+    final occupied = <List<double>>[];
+
+    // Sign numbers (and ascendant marker) first, so planets avoid them
+    for (var sign = 0; sign < 12; sign++) {
+      final cell = geometry.cellForSign[sign];
+      final polygon = geometry.polygons[cell];
+      final anchor = geometry.labelAnchor(cell, polygon);
+      // Fixed-sign styles mark the ascendant's cell in place of its number
+      final isAscendant =
+          sign == ascendant && style != KundaliChartStyle.northIndian;
+      glyphs.add(KundaliGlyph(
+        label: isAscendant ? 'Asc' : '${sign + 1}',
+        x: anchor.$1,
+        y: anchor.$2,
+        kind: isAscendant
+            ? KundaliGlyphKind.ascendant
+            : KundaliGlyphKind.signNumber,
+        scale: 0.8,
+      ));
+      occupied.add(_rect(anchor.$1, anchor.$2, 0.8));
+    }
+    if (style == KundaliChartStyle.northIndian) {
+      // House 1 is always the top diamond; mark it
+      final (x, y) = _polygonCentroid(geometry.polygons[0]);
+      glyphs.add(KundaliGlyph(
+        label: 'Asc',
+        x: x,
+        y: y - 0.08,
+        kind: KundaliGlyphKind.ascendant,
+        scale: 0.8,
+      ));
+      occupied.add(_rect(x, y - 0.08, 0.8));
+    }
+
+    // Planets grouped per cell, placed with collision avoidance
+    final byCell = <int, List<_PlanetPlacement>>{};
+    for (final planet in planets) {
+      byCell
+          .putIfAbsent(geometry.cellForSign[planet.sign], () => [])
+          .add(planet);
+    }
+    for (final entry in byCell.entries) {
+      final polygon = geometry.polygons[entry.key];
+      final sorted = entry.value
+        ..sort((a, b) => a.longitude.compareTo(b.longitude));
+      for (final planet in sorted) {
+        glyphs.add(_placeGlyph(
+          planetAbbreviations[planet.name] ?? planet.name,
+          polygon,
+          occupied,
+        ));
+      }
+    }
+
+    // Graha drishti: every planet aspects the 7th sign from itself;
+    // Mars, Jupiter and Saturn have additional aspects
+    final aspects = <KundaliAspect>[];
+    for (final planet in planets) {
+      if (planet.name == 'Rahu' || planet.name == 'Ketu') continue;
+      final from = geometry.cellForSign[planet.sign];
+      for (final count in [7, ...?_specialAspects[planet.name]]) {
+        final target = (planet.sign + count - 1) % 12;
+        aspects.add(
+            KundaliAspect(planet.name, from, geometry.cellForSign[target]));
+      }
+    }
+
+    return KundaliDisplayList(
+      key: key ?? '${style.name}#${chartKey(birthChart)}',
+      style: style,
+      points: points,
+      cellOffsets: offsets,
+      cellForSign: geometry.cellForSign,
+      glyphs: glyphs,
+      aspects: aspects,
+      frameLines: Float32List.fromList(geometry.frameLines),
+    );
+  }
+
+  // ---------------------------------------------------------------------------
+  // Chart extraction
+  // ---------------------------------------------------------------------------
+
+  static int _signIndex(dynamic rashi, dynamic longitude) {
+    if (rashi is String) {
+      final index = signNames
+          .indexWhere((name) => name.toLowerCase() == rashi.toLowerCase());
+      if (index >= 0) return index;
+    }
+    if (rashi is Map) {
+      final number = rashi['number'];
+      if (number is int && number >= 1 && number <= 12) return number - 1;
+      return _signIndex(rashi['name'], longitude);
+    }
+    if (longitude is num) {
+      return (longitude.toDouble() % 360.0 ~/ 30.0) % 12;
+    }
+    return -1;
+  }
+
+  static int _ascendantSign(Map<String, dynamic> birthChart) {
+    final ascendant = birthChart['ascendant'];
+    if (ascendant is Map) {
+      final sign = _signIndex(ascendant['rashi'], ascendant['longitude']);
+      if (sign >= 0) return sign;
+    }
+    return 0;
+  }
+
+  static List<_PlanetPlacement> _placements(Map<String, dynamic> birthChart) {
+    final positions = birthChart['planetaryPositions'];
+    if (positions is! Map) return const [];
+    final placements = <_PlanetPlacement>[];
+    for (final name in _planetOrder) {
+      final data = positions[name];
+      if (data is! Map) continue;
+      final longitude = (data['longitude'] as num?)?.toDouble() ?? 0.0;
+      final sign = _signIndex(data['rashi'], data['longitude']);
+      if (sign < 0) continue;
+      placements.add(_PlanetPlacement(name, sign, longitude));
+    }
+    return placements;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Glyph placement
+  // ---------------------------------------------------------------------------
+
+  static List<double> _rect(double cx, double cy, double scale) {
+    final hw = glyphWidth * scale / 2;
+    final hh = glyphHeight * scale / 2;
+    return [cx - hw, cy - hh, cx + hw, cy + hh];
+  }
+
+  static bool _overlaps(List<double> a, List<double> b) {
+    return a[0] < b[2] && a[2] > b[0] && a[1] < b[3] && a[3] > b[1];
+  }
+
+  /// Place a glyph inside [polygon] without overlapping [occupied]
+  ///
+  /// Tries candidate points on a square spiral around the polygon centroid;
+  /// shrinks the glyph if a crowded house has no free slot.
+  static KundaliGlyph _placeGlyph(
+    String label,
+    List<(double, double)> polygon,
+    List<List<double>> occupied,
+  ) {
+    final (cx, cy) = _polygonCentroid(polygon);
+
+    for (final scale in const [1.0, 0.8, 0.65]) {
+      final stepX = glyphWidth * scale * 1.05;
+      final stepY = glyphHeight * scale * 1.1;
+      for (var ring = 0; ring <= 4; ring++) {
+        for (final (dx, dy) in _spiralRing(ring)) {
+          final x = cx + dx * stepX;
+          final y = cy + dy * stepY;
+          final rect = _rect(x, y, scale);
+          if (!_rectInside(rect, polygon)) continue;
+          if (occupied.any((other) => _overlaps(rect, other))) continue;
+          occupied.add(rect);
+          return KundaliGlyph(
+            label: label,
+            x: x,
+            y: y,
+            kind: KundaliGlyphKind.planet,
+            scale: scale,
+          );
+        }
+      }
+    }
+
+    // House is full - stack on the centroid at the smallest size
+    occupied.add(_rect(cx, cy, 0.65));
+    return KundaliGlyph(
+      label: label,
+      x: cx,
+      y: cy,
+      kind: KundaliGlyphKind.planet,
+      scale: 0.65,
+    );
+  }
+
+  /// Integer offsets on ring [n] of a square spiral, nearest row first
+  static Iterable<(int, int)> _spiralRing(int n) sync* {
+    if (n == 0) {
+      yield (0, 0);
+      return;
+    }
+    final offsets = <(int, int)>[];
+    for (var dy = -n; dy <= n; dy++) {
+      for (var dx = -n; dx <= n; dx++) {
+        if (math.max(dx.abs(), dy.abs()) == n) offsets.add((dx, dy));
+      }
+    }
+    // Prefer horizontal neighbours so glyphs read as a row
+    offsets.sort((a, b) {
+      final byRow = a.$2.abs().compareTo(b.$2.abs());
+      return byRow != 0 ? byRow : a.$1.abs().compareTo(b.$1.abs());
+    });
+    yield* offsets;
+  }
+
+  static bool _rectInside(List<double> rect, List<(double, double)> polygon) {
+    return _pointInPolygon(rect[0], rect[1], polygon) &&
+        _pointInPolygon(rect[2], rect[1], polygon) &&
+        _pointInPolygon(rect[0], rect[3], polygon) &&
+        _pointInPolygon(rect[2], rect[3], polygon);
+  }
+
+  static bool _pointInPolygon(
+      double x, double y, List<(double, double)> polygon) {
+    var inside = false;
+    for (var i = 0, j = polygon.length - 1; i < polygon.length; j = i++) {
+      final (xi, yi) = polygon[i];
+      final (xj, yj) = polygon[j];
+      if ((yi > y) != (yj > y) &&
+          x < (xj - xi) * (y - yi) / (yj - yi) + xi) {
+        inside = !inside;
+      }
+    }
+    return inside;
+  }
+
+  static (double, double) _polygonCentroid(List<(double, double)> polygon) {
+    var x = 0.0;
+    var y = 0.0;
+    for (final (px, py) in polygon) {
+      x += px;
+      y += py;
+    }
+    return (x / polygon.length, y / polygon.length);
+  }
+
+  // ---------------------------------------------------------------------------
+  // Style geometry
+  // ---------------------------------------------------------------------------
+
+  static _Geometry _northIndianGeometry(int ascendant) {
+    const a = (0.0, 0.0), b = (1.0, 0.0), c = (1.0, 1.0), d = (0.0, 1.0);
+    const t = (0.5, 0.0), r = (1.0, 0.5), bm = (0.5, 1.0), l = (0.0, 0.5);
+    const o = (0.5, 0.5);
+    const p1 = (0.25, 0.25), p2 = (0.75, 0.25);
+    const p3 = (0.75, 0.75), p4 = (0.25, 0.75);
+
+    // Houses 1..12, counter-clockwise from the top diamond
+    const polygons = [
+      [t, p2, o, p1],
+      [a, t, p1],
+      [a, p1, l],
+      [l, p1, o, p4],
+      [l, p4, d],
+      [d, p4, bm],
+      [bm, p4, o, p3],
+      [bm, p3, c],
+      [c, p3, r],
+      [r, p3, o, p2],
+      [r, p2, b],
+      [b, p2, t],
+    ];
+
+    // Sign in house h is (ascendant + h - 1) % 12
+    final cellForSign =
+        List<int>.generate(12, (sign) => (sign - ascendant) % 12);
+
+    return _Geometry(
+      polygons: polygons,
+      cellForSign: cellForSign,
+      frameLines: const [],
+      labelAnchor: (cell, polygon) {
+        // Sign number sits in the inner corner nearest the centre
+        final (x, y) = _polygonCentroid(polygon);
+        return (x + (0.5 - x) * 0.45, y + (0.5 - y) * 0.45);
+      },
+    );
+  }
+
+  static _Geometry _southIndianGeometry() {
+    // Ring cells clockwise from top-left, starting at Pisces
+    const ring = [
+      (0, 0), (1, 0), (2, 0), (3, 0),
+      (3, 1), (3, 2), (3, 3),
+      (2, 3), (1, 3), (0, 3),
+      (0, 2), (0, 1),
+    ];
+    final polygons = <List<(double, double)>>[];
+    final cellForSign = List<int>.filled(12, 0);
+    for (var i = 0; i < 12; i++) {
+      final (col, row) = ring[i];
+      final x0 = col * 0.25, y0 = row * 0.25;
+      polygons.add([
+        (x0, y0),
+        (x0 + 0.25, y0),
+        (x0 + 0.25, y0 + 0.25),
+        (x0, y0 + 0.25),
+      ]);
+      cellForSign[(i + 11) % 12] = i; // ring[0] is Pisces
+    }
+
+    return _Geometry(
+      polygons: polygons,
+      cellForSign: cellForSign,
+      frameLines: const [0, 0, 1, 0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0],
+      labelAnchor: (cell, polygon) {
+        final (x, y) = polygon[0];
+        return (x + 0.04, y + 0.03);
+      },
+    );
+  }
+
+  static _Geometry _eastIndianGeometry() {
+    const s = 1 / 3, e = 2 / 3;
+    // Signs counter-clockwise from Aries at top-centre
+    const polygons = [
+      [(s, 0.0), (e, 0.0), (e, s), (s, s)], // Aries
+      [(0.0, 0.0), (s, 0.0), (s, s)], // Taurus
+      [(0.0, 0.0), (s, s), (0.0, s)], // Gemini
+      [(0.0, s), (s, s), (s, e), (0.0, e)], // Cancer
+      [(0.0, e), (s, e), (0.0, 1.0)], // Leo
+      [(s, e), (s, 1.0), (0.0, 1.0)], // Virgo
+      [(s, e), (e, e), (e, 1.0), (s, 1.0)], // Libra
+      [(e, e), (1.0, 1.0), (e, 1.0)], // Scorpio
+      [(e, e), (1.0, e), (1.0, 1.0)], // Sagittarius
+      [(e, s), (1.0, s), (1.0, e), (e, e)], // Capricorn
+      [(1.0, 0.0), (1.0, s), (e, s)], // Aquarius
+      [(e, 0.0), (1.0, 0.0), (e, s)], // Pisces
+    ];
+
+    return _Geometry(
+      polygons: polygons,
+      cellForSign: List<int>.generate(12, (sign) => sign),
+      frameLines: const [],
+      labelAnchor: (cell, polygon) {
+        final (x, y) = _polygonCentroid(polygon);
+        return (x, y - 0.06);
+      },
+    );
+  }
+}
+
+class _Geometry {
+  final List<List<(double, double)>> polygons;
+  final List<int> cellForSign;
+  final List<double> frameLines;
+  final (double, double) Function(int cell, List<(double, double)> polygon)
+      labelAnchor;
+
+  const _Geometry({
+    required this.polygons,
+    required this.cellForSign,
+    required this.frameLines,
+    required this.labelAnchor,
+  });
+
+  int get vertexCount =>
+      polygons.fold(0, (count, polygon) => count + polygon.length);
+}
+
+/// LRU cache of display lists keyed by (chart, style)
+class KundaliLayoutCache {
+  static final KundaliLayoutCache instance = KundaliLayoutCache._();
+  KundaliLayoutCache._();
+
+  static const int _maxEntries = 24;
+  final LinkedHashMap<String, KundaliDisplayList> _entries = LinkedHashMap();
+
+  /// Get (or build once) the display list for [birthChart] in [style]
+  KundaliDisplayList get(
+    Map<String, dynamic> birthChart,
+    KundaliChartStyle style,
+  ) {
+    final key = '${style.name}#${KundaliLayout.chartKey(birthChart)}';
+    final cached = _entries.remove(key);
+    if (cached != null) {
+      _entries[key] = cached; // Mark most recently used
+      return cached;
+    }
+
+    final built = KundaliLayout.build(birthChart, style, key: key);
+    _entries[key] = built;
+    while (_entries.length > _maxEntries) {
+      _entries.remove(_entries.keys.first);
+    }
+    return built;
+  }
+
+  void clear() => _entries.clear();
+}
@@ -0,0 +1,492 @@
+/// Match History Store
+///
+/// Persistent history of compatibility results with secondary indexes on
+/// score, date, partner names, nakshatra, rashi and nadi dosha.
+///
+/// Records live in their own KV store. Every index is a sorted table whose
+/// keys end in `|<created at>|<id>`, so a query is a range scan over one
+/// index (newest first), with the remaining conditions checked against a
+/// small per-record summary. Full records are decoded only for the page
+/// being returned.
+library;
+
+import 'dart:convert';
+import 'dart:typed_data';
+import '../../../logging/logging_helper.dart';
+import '../../../services/storage/app_kv_store.dart';
+import '../../../services/storage/kv_store.dart';
+import '../repositories/matching_repository.dart';
+import 'match_record.dart';
+
+/// Filter for [MatchHistoryStore.query]; all given conditions must hold
+class MatchQuery {
+  final int? minScore;
+  final int? maxScore;
+  final DateTime? from;
+  final DateTime? to; // Exclusive
+
+  /// Prefix of either partner's name (case-insensitive)
+  final String? name;
+
+  /// Nakshatra / rashi of either partner
+  final String? nakshatra;
+  final String? rashi;
+  final NadiDosha? nadiDosha;
+
+  const MatchQuery({
+    this.minScore,
+    this.maxScore,
+    this.from,
+    this.to,
+    this.name,
+    this.nakshatra,
+    this.rashi,
+    this.nadiDosha,
+  });
+
+  static const MatchQuery all = MatchQuery();
+}
+
+/// One page of query results
+class MatchPage {
+  final List<MatchRecord> records;
+
+  /// Pass to the next [MatchHistoryStore.query] call; null on the last page
+  final String? cursor;
+
+  /// Index entries examined (for diagnostics)
+  final int scanned;
+
+  const MatchPage({
+    required this.records,
+    required this.cursor,
+    required this.scanned,
+  });
+}
+
+/// Filterable fields of a record, kept apart from the record body
+class _MatchSummary {
+  final int score;
+  final int createdAt;
+  final NadiDosha nadi;
+  final List<String> names;
+  final List<String> nakshatras;
+  final List<String> rashis;
+
+  const _MatchSummary({
+    required this.score,
+    required this.createdAt,
+    required this.nadi,
+    required this.names,
+    required this.nakshatras,
+    required this.rashis,
+  });
+
+  factory _MatchSummary.of(MatchRecord record) => _MatchSummary(
+        score: record.totalScore,
+        createdAt: record.createdAt.millisecondsSinceEpoch,
+        nadi: record.nadiDosha,
+        names: {
+          MatchHistoryStore._term(record.person1.name),
+          MatchHistoryStore._term(record.person2.name),
+        }.toList(),
+        nakshatras: {
+          for (final value in [
+            record.person1Nakshatra,
+            record.person2Nakshatra,
+          ])
+            if (value != null) MatchHistoryStore._term(value),
+        }.toList(),
+        rashis: {
+          for (final value in [record.person1Rashi, record.person2Rashi])
+            if (value != null) MatchHistoryStore._term(value),
+        }.toList(),
+      );
+
+  // Fields separated by \x1f, list items by \x1e
+  static final KvCodec<_MatchSummary> codec = KvCodec(
+    encode: (summary) => Uint8List.fromList(utf8.encode([
+      summary.score,
+      summary.createdAt,
+      summary.nadi.index,
+      summary.names.join('\x1e'),
+      summary.nakshatras.join('\x1e'),
+      summary.rashis.join('\x1e'),
+    ].join('\x1f'))),
+    decode: (bytes) {
+      final fields = utf8.decode(bytes).split('\x1f');
+      List<String> list(String field) =>
+          field.isEmpty ? const [] : field.split('\x1e');
+      return _MatchSummary(
+        score: int.parse(fields[0]),
+        createdAt: int.parse(fields[1]),
+        nadi: NadiDosha.values[int.parse(fields[2])],
+        names: list(fields[3]),
+        nakshatras: list(fields[4]),
+        rashis: list(fields[5]),
+      );
+    },
+  );
+}
+
+/// Match History Store
+class MatchHistoryStore {
+  static MatchHistoryStore? _instance;
+
+  static MatchHistoryStore get instance {
+    _instance ??=
+        MatchHistoryStore._(() => AppKvStore.open(name: _storeName));
+    return _instance!;
+  }
+
+  MatchHistoryStore._(this._openStore);
+
+  /// Store over an already opened [KvStore] (tests, tools)
+  MatchHistoryStore.withStore(KvStore store)
+      : _openStore = (() => Future.value(store));
+
+  static const String _storeName = 'match_history';
+
+  static const int defaultPageSize = 30;
+
+  final Future<KvStore> Function() _openStore;
+  Future<_Tables>? _tables;
+  int _lastId = 0;
+
+  Future<_Tables> _open() => _tables ??= _openStore().then(_Tables.new);
+
+  /// Save a result; the record and all its index entries are one batch
+  Future<MatchRecord> save({
+    required MatchPartner person1,
+    required MatchPartner person2,
+    required String ayanamsha,
+    required String houseSystem,
+    required MatchingResult result,
+    DateTime? createdAt,
+  }) async {
+    final tables = await _open();
+    final time = createdAt ?? DateTime.now();
+    final record = MatchRecord(
+      id: _nextId(time),
+      createdAt: time,
+      person1: person1,
+      person2: person2,
+      ayanamsha: ayanamsha,
+      houseSystem: houseSystem,
+      result: result,
+    );
+
+    final inputKey = record.inputKeyValue;
+    await tables.store.write((batch) {
+      // A repeat of the same inputs replaces the older entry
+      final previous = tables.byInput.get(inputKey);
+      if (previous != null) _deleteInBatch(tables, batch, previous);
+
+      final summary = _MatchSummary.of(record);
+      batch
+        ..put(tables.records, record.id, record.toJson())
+        ..put(tables.summaries, record.id, summary)
+        ..put(tables.byInput, inputKey, record.id);
+      for (final entry in _indexEntries(record.id, summary)) {
+        batch.put(entry.table(tables), entry.key, record.id);
+      }
+    });
+    return record;
+  }
+
+  /// Record by id, or null
+  Future<MatchRecord?> get(String id) async {
+    final tables = await _open();
+    final json = tables.records.get(id);
+    return json == null ? null : MatchRecord.fromJson(json);
+  }
+
+  /// Stored result for exactly these inputs, if any
+  Future<MatchRecord?> findByInputs({
+    required MatchPartner person1,
+    required MatchPartner person2,
+    required String ayanamsha,
+    required String houseSystem,
+  }) async {
+    final tables = await _open();
+    final id = tables.byInput.get(
+        MatchRecord.inputKey(person1, person2, ayanamsha, houseSystem));
+    return id == null ? null : get(id);
+  }
+
+  /// Number of stored matches
+  Future<int> count() async => (await _open()).records.length;
+
+  /// Delete one record and its index entries
+  Future<void> delete(String id) async {
+    final tables = await _open();
+    await tables.store.write((batch) => _deleteInBatch(tables, batch, id));
+  }
+
+  /// Delete the whole history
+  Future<void> clear() async {
+    final tables = await _open();
+    await tables.store.write((batch) {
+      for (final table in tables.all) {
+        batch.clear(table);
+      }
+    });
+  }
+
+  /// One page of matches satisfying [query]
+  ///
+  /// Results are newest first, except for score-bounded queries without a
+  /// name/nakshatra/rashi condition, which come highest score first.
+  Future<MatchPage> query(
+    MatchQuery query, {
+    int pageSize = defaultPageSize,
+    String? cursor,
+  }) async {
+    final tables = await _open();
+    final plan = _plan(tables, query);
+
+    final ids = <String>[];
+    final seen = <String>{};
+    final namePrefix = identical(plan.index, tables.byName)
+        ? _term(query.name!)
+        : null;
+    var scanned = 0;
+    String? lastKey;
+    var exhausted = true;
+    for (final entry in plan.index.scan(
+      start: plan.start,
+      end: cursor ?? plan.end,
+      descending: true,
+    )) {
+      scanned++;
+      lastKey = entry.key;
+      if (plan.needsCheck) {
+        final summary = tables.summaries.get(entry.value);
+        if (summary == null || !_matches(summary, query)) continue;
+        // Both partners' names may match the prefix; the record is taken
+        // at the entry the descending scan reaches first, on whichever
+        // page that was
+        if (namePrefix != null &&
+            _nameOf(entry.key) != _lastName(summary, namePrefix)) {
+          continue;
+        }
+      }
+      if (!seen.add(entry.value)) continue;
+      ids.add(entry.value);
+      if (ids.length == pageSize) {
+        exhausted = false;
+        break;
+      }
+    }
+
+    return MatchPage(
+      records: [
+        for (final id in ids)
+          if (tables.records.get(id) case final json?)
+            MatchRecord.fromJson(json),
+      ],
+      cursor: exhausted ? null : lastKey,
+      scanned: scanned,
+    );
+  }
+
+  // ---------------------------------------------------------------------------
+  // Indexes
+  // ---------------------------------------------------------------------------
+
+  /// Lowercase, without the key separator
+  static String _term(String value) =>
+      value.trim().toLowerCase().replaceAll('|', ' ');
+
+  static String _score(int score) =>
+      score.clamp(0, 99).toString().padLeft(2, '0');
+
+  static String _time(int millis) => millis.toString().padLeft(15, '0');
+
+  /// Name term of a `byName` key
+  static String _nameOf(String key) => key.substring(0, key.indexOf('|'));
+
+  /// Greatest of [summary]'s names starting with [prefix]
+  static String _lastName(_MatchSummary summary, String prefix) => summary
+      .names
+      .where((n) => n.startsWith(prefix))
+      .reduce((a, b) => a.compareTo(b) >= 0 ? a : b);
+
+  /// Upper bound (exclusive) of every key starting with [prefix]
+  static String _after(String prefix) => '$prefix\uffff';
+
+  static List<_IndexEntry> _indexEntries(String id, _MatchSummary summary) {
+    final suffix = '|${_time(summary.createdAt)}|$id';
+    final score = _score(summary.score);
+    return [
+      _IndexEntry((t) => t.byDate, '${_time(summary.createdAt)}|$id'),
+      _IndexEntry((t) => t.byScore, '$score$suffix'),
+      _IndexEntry((t) => t.byNadi, '${summary.nadi.index}|$score$suffix'),
+      for (final name in summary.names)
+        _IndexEntry((t) => t.byName, '$name$suffix'),
+      for (final nakshatra in summary.nakshatras)
+        _IndexEntry((t) => t.byNakshatra, '$nakshatra$suffix'),
+      for (final rashi in summary.rashis)
+        _IndexEntry((t) => t.byRashi, '$rashi$suffix'),
+    ];
+  }
+
+  void _deleteInBatch(_Tables tables, KvBatch batch, String id) {
+    final json = tables.records.get(id);
+    final summary = tables.summaries.get(id);
+    if (summary != null) {
+      for (final entry in _indexEntries(id, summary)) {
+        batch.delete(entry.table(tables), entry.key);
+      }
+    }
+    if (json != null) {
+      batch.delete(tables.byInput, MatchRecord.fromJson(json).inputKeyValue);
+    }
+    batch
+      ..delete(tables.records, id)
+      ..delete(tables.summaries, id);
+  }
+
+  /// Choose the index whose range covers the fewest entries
+  _QueryPlan _plan(_Tables tables, MatchQuery query) {
+    final minScore = _score(query.minScore ?? 0);
+    final maxScore = _score(query.maxScore ?? 99);
+    final scoreBounded = query.minScore != null || query.maxScore != null;
+
+    // Equality/prefix terms are the most selective
+    final name = query.name == null ? null : _term(query.name!);
+    if (name != null && name.isNotEmpty) {
+      return _QueryPlan(tables.byName, name, _after(name), true);
+    }
+    final nakshatra = query.nakshatra;
+    if (nakshatra != null) {
+      final term = '${_term(nakshatra)}|';
+      return _QueryPlan(tables.byNakshatra, term, _after(term), true);
+    }
+    final rashi = query.rashi;
+    if (rashi != null) {
+      final term = '${_term(rashi)}|';
+      return _QueryPlan(tables.byRashi, term, _after(term), true);
+    }
+
+    final dateBounded = query.from != null || query.to != null;
+    final nadi = query.nadiDosha;
+    if (nadi != null) {
+      final prefix = '${nadi.index}|';
+      return _QueryPlan(tables.byNadi, '$prefix$minScore',
+          _after('$prefix$maxScore'), dateBounded);
+    }
+    if (scoreBounded) {
+      return _QueryPlan(
+          tables.byScore, minScore, _after(maxScore), dateBounded);
+    }
+
+    final from = query.from;
+    final to = query.to;
+    return _QueryPlan(
+      tables.byDate,
+      from == null ? null : _time(from.millisecondsSinceEpoch),
+      to == null ? null : _time(to.millisecondsSinceEpoch),
+      false,
+    );
+  }
+
+  static bool _matches(_MatchSummary summary, MatchQuery query) {
+    if (query.minScore != null && summary.score < query.minScore!) {
+      return false;
+    }
+    if (query.maxScore != null && summary.score > query.maxScore!) {
+      return false;
+    }
+    if (query.from != null &&
+        summary.createdAt < query.from!.millisecondsSinceEpoch) {
+      return false;
+    }
+    if (query.to != null &&
+        summary.createdAt >= query.to!.millisecondsSinceEpoch) {
+      return false;
+    }
+    if (query.nadiDosha != null && summary.nadi != query.nadiDosha) {
+      return false;
+    }
+    if (query.name != null) {
+      final name = _term(query.name!);
+      if (!summary.names.any((n) => n.startsWith(name))) return false;
+    }
+    if (query.nakshatra != null &&
+        !summary.nakshatras.contains(_term(query.nakshatra!))) {
+      return false;
+    }
+    if (query.rashi != null && !summary.rashis.contains(_term(query.rashi!))) {
+      return false;
+    }
+    return true;
+  }
+
+  /// Time-ordered, unique per store instance
+  String _nextId(DateTime time) {
+    var id = time.microsecondsSinceEpoch;
+    if (id <= _lastId) id = _lastId + 1;
+    _lastId = id;
+    return id.toRadixString(36);
+  }
+
+  /// Log a failed history operation; history problems never fail a match
+  static void logFailure(String message, Object error) {
+    LoggingHelper.logError(message, source: 'MatchHistoryStore', error: error);
+  }
+}
+
+class _Tables {
+  final KvStore store;
+  final KvTable<Map<String, dynamic>> records;
+  final KvTable<_MatchSummary> summaries;
+  final KvTable<String> byInput;
+  final KvTable<String> byDate;
+  final KvTable<String> byScore;
+  final KvTable<String> byNadi;
+  final KvTable<String> byName;
+  final KvTable<String> byNakshatra;
+  final KvTable<String> byRashi;
+
+  _Tables(this.store)
+      : records = store.table('records', KvCodec.json),
+        summaries = store.table('summaries', _MatchSummary.codec),
+        byInput = store.table('idx_input', KvCodec.string),
+        byDate = store.table('idx_date', KvCodec.string),
+        byScore = store.table('idx_score', KvCodec.string),
+        byNadi = store.table('idx_nadi', KvCodec.string),
+        byName = store.table('idx_name', KvCodec.string),
+        byNakshatra = store.table('idx_nakshatra', KvCodec.string),
+        byRashi = store.table('idx_rashi', KvCodec.string);
+
+  List<KvTable<dynamic>> get all => [
+        records,
+        summaries,
+        byInput,
+        byDate,
+        byScore,
+        byNadi,
+        byName,
+        byNakshatra,
+        byRashi,
+      ];
+}
+
+class _IndexEntry {
+  final KvTable<String> Function(_Tables tables) table;
+  final String key;
+
+  const _IndexEntry(this.table, this.key);
+}
+
+class _QueryPlan {
+  final KvTable<String> index;
+  final String? start;
+  final String? end;
+
+  /// Whether entries must be checked against the summary
+  final bool needsCheck;
+
+  const _QueryPlan(this.index, this.start, this.end, this.needsCheck);
+}
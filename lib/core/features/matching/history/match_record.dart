@@ -0,0 +1,176 @@
+/// Match Record
+///
+/// One saved compatibility result with the inputs it was computed from, so
+/// it can be listed, filtered and reopened without calling the API again.
+library;
+
+import 'package:flutter/material.dart';
+import '../repositories/matching_repository.dart';
+
+/// Nadi koota outcome of a match
+enum NadiDosha {
+  /// Nadi koota scored in full
+  none,
+
+  /// Same nadi with no cancelling condition
+  present,
+
+  /// Same nadi, cancelled (same rashi with different nakshatras, or same
+  /// nakshatra with a different rashi or pada)
+  cancelled,
+}
+
+/// Birth details of one partner as entered
+class MatchPartner {
+  final String name;
+  final DateTime dateOfBirth; // Local birth date and time
+  final String placeOfBirth;
+  final double latitude;
+  final double longitude;
+
+  const MatchPartner({
+    required this.name,
+    required this.dateOfBirth,
+    required this.placeOfBirth,
+    required this.latitude,
+    required this.longitude,
+  });
+
+  factory MatchPartner.fromPartnerData(PartnerData data) => MatchPartner(
+        name: data.name,
+        dateOfBirth: data.dateOfBirth,
+        placeOfBirth: data.placeOfBirth,
+        latitude: data.latitude,
+        longitude: data.longitude,
+      );
+
+  TimeOfDay get timeOfBirth => TimeOfDay.fromDateTime(dateOfBirth);
+
+  Map<String, dynamic> toJson() => {
+        'name': name,
+        'dateOfBirth': dateOfBirth.toIso8601String(),
+        'placeOfBirth': placeOfBirth,
+        'latitude': latitude,
+        'longitude': longitude,
+      };
+
+  factory MatchPartner.fromJson(Map<String, dynamic> json) => MatchPartner(
+        name: json['name'] as String,
+        dateOfBirth: DateTime.parse(json['dateOfBirth'] as String),
+        placeOfBirth: json['placeOfBirth'] as String,
+        latitude: (json['latitude'] as num).toDouble(),
+        longitude: (json['longitude'] as num).toDouble(),
+      );
+
+  /// Identity of the birth data for result reuse (minute and ~1 km precision)
+  String get fingerprint => [
+        dateOfBirth.toIso8601String().substring(0, 16),
+        latitude.toStringAsFixed(2),
+        longitude.toStringAsFixed(2),
+      ].join(',');
+}
+
+/// Match Record
+class MatchRecord {
+  final String id;
+  final DateTime createdAt;
+  final MatchPartner person1; // Groom
+  final MatchPartner person2; // Bride
+  final String ayanamsha;
+  final String houseSystem;
+  final MatchingResult result;
+
+  const MatchRecord({
+    required this.id,
+    required this.createdAt,
+    required this.person1,
+    required this.person2,
+    required this.ayanamsha,
+    required this.houseSystem,
+    required this.result,
+  });
+
+  int get totalScore => result.totalScore;
+
+  String? get person1Nakshatra => result.kootaDetails['person1Nakshatram'];
+  String? get person2Nakshatra => result.kootaDetails['person2Nakshatram'];
+  String? get person1Rashi => result.kootaDetails['person1Raasi'];
+  String? get person2Rashi => result.kootaDetails['person2Raasi'];
+
+  NadiDosha get nadiDosha => nadiDoshaOf(result.kootaDetails);
+
+  /// Nadi outcome from display koota details (see [MatchingResult])
+  static NadiDosha nadiDoshaOf(Map<String, String> details) {
+    final nadi = int.tryParse(details['Nadi'] ?? '');
+    if (nadi == null || nadi > 0) return NadiDosha.none;
+
+    final nakshatra1 = details['person1Nakshatram'];
+    final nakshatra2 = details['person2Nakshatram'];
+    final rashi1 = details['person1Raasi'];
+    final rashi2 = details['person2Raasi'];
+    final pada1 = details['person1Pada'];
+    final pada2 = details['person2Pada'];
+
+    final sameRashi = rashi1 != null && rashi1 == rashi2;
+    final sameNakshatra = nakshatra1 != null && nakshatra1 == nakshatra2;
+    if (sameRashi &&
+        nakshatra1 != null &&
+        nakshatra2 != null &&
+        !sameNakshatra) {
+      return NadiDosha.cancelled;
+    }
+    if (sameNakshatra &&
+        ((rashi1 != null && rashi2 != null && !sameRashi) ||
+            (pada1 != null && pada2 != null && pada1 != pada2))) {
+      return NadiDosha.cancelled;
+    }
+    return NadiDosha.present;
+  }
+
+  /// Key identifying the inputs, for reusing a stored result
+  static String inputKey(
+    MatchPartner person1,
+    MatchPartner person2,
+    String ayanamsha,
+    String houseSystem,
+  ) =>
+      [person1.fingerprint, person2.fingerprint, ayanamsha, houseSystem]
+          .join('|');
+
+  String get inputKeyValue =>
+      inputKey(person1, person2, ayanamsha, houseSystem);
+
+  Map<String, dynamic> toJson() => {
+        'id': id,
+        'createdAt': createdAt.millisecondsSinceEpoch,
+        'person1': person1.toJson(),
+        'person2': person2.toJson(),
+        'ayanamsha': ayanamsha,
+        'houseSystem': houseSystem,
+        'compatibilityScore': result.compatibilityScore,
+        'kootaDetails': result.kootaDetails,
+        'level': result.level,
+        'recommendation': result.recommendation,
+        'totalScore': result.totalScore,
+      };
+
+  factory MatchRecord.fromJson(Map<String, dynamic> json) => MatchRecord(
+        id: json['id'] as String,
+        createdAt:
+            DateTime.fromMillisecondsSinceEpoch(json['createdAt'] as int),
+        person1:
+            MatchPartner.fromJson(json['person1'] as Map<String, dynamic>),
+        person2:
+            MatchPartner.fromJson(json['person2'] as Map<String, dynamic>),
+        ayanamsha: json['ayanamsha'] as String,
+        houseSystem: json['houseSystem'] as String,
+        result: MatchingResult(
+          compatibilityScore: (json['compatibilityScore'] as num).toDouble(),
+          kootaDetails: Map<String, String>.from(
+              json['kootaDetails'] as Map<String, dynamic>),
+          level: json['level'] as String,
+          recommendation: json['recommendation'] as String,
+          totalScore: json['totalScore'] as int,
+        ),
+      );
+}
@@ -7,6 +7,8 @@ import 'package:flutter_riverpod/flutter_riverpod.dart';
 import '../repositories/matching_repository.dart';
 import '../../../di/injection_container.dart';
 import '../usecases/perform_matching_usecase.dart';
+import '../history/match_history_store.dart';
+import '../history/match_record.dart';
 import '../../../utils/either.dart';
 import '../../../utils/validation/error_message_helper.dart';
 
@@ -84,6 +86,28 @@ class MatchingNotifier extends Notifier<MatchingState> {
     state = state.copyWith(
         isLoading: true, errorMessage: null, successMessage: null);
 
+    final person1 = MatchPartner.fromPartnerData(person1Data);
+    final person2 = MatchPartner.fromPartnerData(person2Data);
+    final selectedAyanamsha = ayanamsha ?? 'lahiri';
+    final selectedHouseSystem = houseSystem ?? 'placidus';
+
+    // Same inputs as a saved match - reopen it without calling the API
+    final history = ref.read(matchHistoryStoreProvider);
+    try {
+      final saved = await history.findByInputs(
+        person1: person1,
+        person2: person2,
+        ayanamsha: selectedAyanamsha,
+        houseSystem: selectedHouseSystem,
+      );
+      if (saved != null) {
+        openRecord(saved);
+        return;
+      }
+    } catch (e) {
+      MatchHistoryStore.logFailure('Failed to look up match history', e);
+    }
+
     try {
       print('🔍 DEBUG: Calling _performMatchingUseCase');
       final result = await _performMatchingUseCase(person1Data, person2Data,
@@ -103,6 +127,9 @@ class MatchingNotifier extends Notifier<MatchingState> {
           successMessage: 'Matching completed successfully!',
         );
 
+        _saveToHistory(person1, person2, selectedAyanamsha,
+            selectedHouseSystem, matchingResult);
+
         // Clear success message after 3 seconds
         Future.delayed(const Duration(seconds: 3), () {
           state = state.copyWith(successMessage: null);
@@ -127,6 +154,43 @@ class MatchingNotifier extends Notifier<MatchingState> {
     }
   }
 
+  /// Add a computed match to the history (failures are only logged)
+  Future<void> _saveToHistory(
+    MatchPartner person1,
+    MatchPartner person2,
+    String ayanamsha,
+    String houseSystem,
+    MatchingResult result,
+  ) async {
+    try {
+      await ref.read(matchHistoryStoreProvider).save(
+            person1: person1,
+            person2: person2,
+            ayanamsha: ayanamsha,
+            houseSystem: houseSystem,
+            result: result,
+          );
+    } catch (e) {
+      MatchHistoryStore.logFailure('Failed to save match history', e);
+    }
+  }
+
+  /// Show a saved match without recomputing it
+  void openRecord(MatchRecord record) {
+    final result = record.result;
+    state = state.copyWith(
+      isLoading: false,
+      showResults: true,
+      compatibilityScore: result.compatibilityScore,
+      kootaDetails: result.kootaDetails,
+      level: result.level,
+      recommendation: result.recommendation,
+      totalScore: result.totalScore,
+      errorMessage: null,
+      successMessage: null,
+    );
+  }
+
   /// Edit partner details (go back to input screen)
   void editPartnerDetails() {
     state = state.copyWith(
@@ -157,6 +221,11 @@ final matchingProvider = NotifierProvider<MatchingNotifier, MatchingState>(() {
   return MatchingNotifier();
 });
 
+/// Match history store provider
+final matchHistoryStoreProvider = Provider<MatchHistoryStore>((ref) {
+  return MatchHistoryStore.instance;
+});
+
 /// Convenience providers for specific state parts
 final matchingIsLoadingProvider = Provider<bool>((ref) {
   return ref.watch(matchingProvider).isLoading;
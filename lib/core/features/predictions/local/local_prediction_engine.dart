@@ -0,0 +1,204 @@
+/// Local Prediction Engine
+///
+/// Builds the daily prediction payload on the device from today's lunar
+/// transit over the natal moon: moon sign and nakshatra, tara bala, chandra
+/// bala and the running Vimshottari dasha. These become [PredictionFacts]
+/// for the text engine; the payload uses the same keys as the `/predictions`
+/// response. Pure Dart; one call costs well under a millisecond.
+library;
+
+import '../../astrology/engine/astro_time.dart';
+import '../../astrology/engine/ayanamsha.dart';
+import '../../astrology/engine/ephemeris_cache.dart';
+import '../../astrology/engine/fingerprint.dart';
+import '../../astrology/engine/lunar_ephemeris.dart';
+import '../../astrology/engine/planetary_ephemeris.dart';
+import '../../astrology/engine/vimshottari.dart';
+import '../text/prediction_text_engine.dart';
+import '../text/prediction_text_packs.dart';
+
+/// Sidereal position of the Moon at one instant
+class MoonPosition {
+  /// Sidereal longitude in degrees
+  final double longitude;
+
+  const MoonPosition(this.longitude);
+
+  /// Compute for a UTC instant and ayanamsha type
+  factory MoonPosition.at(DateTime utc, String ayanamsha) {
+    final jd = julianDayTt(utc);
+    return MoonPosition(
+        Ayanamsha.sidereal(moonApparentLongitude(jd), ayanamsha, jd));
+  }
+
+  /// As [MoonPosition.at], interpolated from the [EphemerisCache] day;
+  /// for many instants of the same day (hourly views, "now")
+  factory MoonPosition.cached(DateTime utc, String ayanamsha) {
+    final jd = julianDayTt(utc);
+    return MoonPosition(Ayanamsha.sidereal(
+        EphemerisCache.instance.longitude(Graha.moon, jd), ayanamsha, jd));
+  }
+
+  /// 0-based sign index (0 = Mesha)
+  int get rashi => (longitude / 30).floor() % 12;
+
+  /// 0-based nakshatra index (0 = Ashwini)
+  int get nakshatra => (longitude / nakshatraSpan).floor() % 27;
+
+  /// 1-based pada within the nakshatra
+  int get pada =>
+      ((longitude % nakshatraSpan) / (nakshatraSpan / 4)).floor() + 1;
+
+  static CompiledLanguage get _english => PredictionTextEngine.instance
+      .language(PredictionTextEngine.fallbackLanguage);
+
+  /// `rashi`/`nakshatra`/`pada` maps in the shape of the API's birth data
+  Map<String, dynamic> toMap() => {
+        'longitude': longitude,
+        'rashi': {
+          'number': rashi + 1,
+          'name': _english.word(Vocabulary.rashi, rashi),
+        },
+        'nakshatra': {
+          'number': nakshatra + 1,
+          'name': _english.word(Vocabulary.nakshatra, nakshatra),
+        },
+        'pada': {'number': pada},
+      };
+}
+
+/// Local Prediction Engine
+class LocalPredictionEngine {
+  LocalPredictionEngine._();
+
+  /// Favourable taras (Sampat, Kshema, Sadhana, Mitra, Parama Mitra)
+  static const Set<int> _goodTaras = {2, 4, 6, 8, 9};
+
+  /// Chandra bala: houses from the natal moon that are good or bad
+  static const Set<int> _goodHouses = {1, 3, 6, 7, 10, 11};
+  static const Set<int> _badHouses = {4, 8, 12};
+
+  /// Sections of the daily payload's `predictions` map
+  static const List<String> areas = ['career', 'finance', 'health', 'love'];
+
+  /// Transit facts for [targetUtc]
+  ///
+  /// [natal] is the birth moon, computed once and reused across days;
+  /// [transit], when given, is the moon at [targetUtc].
+  static PredictionFacts facts({
+    required MoonPosition natal,
+    required DateTime birthUtc,
+    required DateTime targetUtc,
+    required String ayanamsha,
+    MoonPosition? transit,
+  }) {
+    transit ??= MoonPosition.at(targetUtc, ayanamsha);
+
+    // Tara: count from the birth star to today's star, in cycles of nine
+    final tara = (transit.nakshatra - natal.nakshatra) % 27 % 9 + 1;
+    final taraGood = _goodTaras.contains(tara);
+
+    // Chandra bala: house of today's moon counted from the natal moon
+    final house = (transit.rashi - natal.rashi) % 12 + 1;
+    final chandra = _goodHouses.contains(house)
+        ? TransitQuality.good
+        : _badHouses.contains(house)
+            ? TransitQuality.bad
+            : TransitQuality.mixed;
+
+    // The day is good when both agree, bad when both are against
+    final points = (taraGood ? 1 : -1) +
+        (chandra == TransitQuality.good
+            ? 1
+            : chandra == TransitQuality.bad
+                ? -1
+                : 0);
+    final day = points > 0
+        ? TransitQuality.good
+        : points < 0
+            ? TransitQuality.bad
+            : TransitQuality.mixed;
+
+    final dasha = Vimshottari.at(natal.longitude, birthUtc, targetUtc);
+
+    return PredictionFacts()
+      ..[PredictionFact.tara] = tara
+      ..[PredictionFact.house] = house
+      ..[PredictionFact.chandraQuality] = chandra.index
+      ..[PredictionFact.dayQuality] = day.index
+      ..[PredictionFact.nakshatra] = transit.nakshatra
+      ..[PredictionFact.transitRashi] = transit.rashi
+      ..[PredictionFact.natalRashi] = natal.rashi
+      ..[PredictionFact.mahadasha] =
+          PredictionTextPacks.planets.indexOf(dasha.mahadasha.lord)
+      ..[PredictionFact.antardasha] =
+          PredictionTextPacks.planets.indexOf(dasha.antardasha.lord)
+      ..[PredictionFact.weekday] = targetUtc.toLocal().weekday - 1;
+  }
+
+  /// Daily prediction payload in the `/predictions` shape, with texts
+  /// rendered in [language] (a `SupportedLanguage` name)
+  static Map<String, dynamic> daily({
+    required MoonPosition natal,
+    required DateTime birthUtc,
+    required DateTime targetUtc,
+    required String ayanamsha,
+    String language = PredictionTextEngine.fallbackLanguage,
+  }) {
+    final facts = LocalPredictionEngine.facts(
+      natal: natal,
+      birthUtc: birthUtc,
+      targetUtc: targetUtc,
+      ayanamsha: ayanamsha,
+    );
+    return payload(facts, language);
+  }
+
+  /// Payload for already computed [facts]
+  static Map<String, dynamic> payload(PredictionFacts facts, String language) {
+    final engine = PredictionTextEngine.instance;
+    final words = engine.language(language);
+    String render(String section) => engine.render(language, section, facts);
+
+    final tara = facts[PredictionFact.tara];
+    return {
+      'source': 'local',
+      // Of the facts, so devices and the backend can compare days
+      'fingerprint': EngineFingerprint.of(facts.values),
+      'language': language,
+      'generalOutlook': render('outlook'),
+      'moon': {
+        'rashi': {
+          'number': facts[PredictionFact.transitRashi] + 1,
+          'name': words.word(
+              Vocabulary.rashi, facts[PredictionFact.transitRashi]),
+        },
+        'nakshatra': {
+          'number': facts[PredictionFact.nakshatra] + 1,
+          'name': words.word(
+              Vocabulary.nakshatra, facts[PredictionFact.nakshatra]),
+        },
+      },
+      'taraBala': {
+        'number': tara,
+        'name': words.word(Vocabulary.tara, tara),
+        'favorable': _goodTaras.contains(tara),
+      },
+      'chandraBala': {
+        'house': facts[PredictionFact.house],
+        'quality':
+            TransitQuality.values[facts[PredictionFact.chandraQuality]].name,
+      },
+      'dasha': {
+        'mahadasha':
+            PredictionTextPacks.planets[facts[PredictionFact.mahadasha]],
+        'antardasha':
+            PredictionTextPacks.planets[facts[PredictionFact.antardasha]],
+        'influence': render('dasha'),
+      },
+      'predictions': {
+        for (final area in areas) area: {'content': render(area)},
+      },
+    };
+  }
+}
@@ -5,11 +5,11 @@ library;
 
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 import '../../../utils/validation/error_message_helper.dart';
-import '../../../services/astrology/astrology_service_bridge.dart';
+import '../../../services/predictions/prediction_batch_service.dart';
 import '../../../services/user/user_service.dart';
 import '../../../utils/validation/profile_completion_checker.dart';
-import '../../../utils/astrology/timezone_util.dart';
 import '../../../utils/either.dart';
+import '../../../services/startup/startup_snapshot_service.dart';
 
 /// Daily predictions state
 class DailyPredictionsState {
@@ -45,7 +45,7 @@ class DailyPredictionsNotifier extends StateNotifier<DailyPredictionsState> {
 
   DailyPredictionsNotifier(this._ref) : super(const DailyPredictionsState());
 
-  /// Get daily predictions using AstrologyServiceBridge.getPredictions directly
+  /// Get daily predictions, served from the stored batch when available
   Future<void> getDailyPredictions({
     required Map<String, dynamic> birthData,
     required DateTime date,
@@ -68,27 +68,8 @@ class DailyPredictionsNotifier extends StateNotifier<DailyPredictionsState> {
         return;
       }
 
-      // Get timezone from user's location
-      await TimezoneUtil.initialize();
-      final timezoneId = AstrologyServiceBridge.getTimezoneFromLocation(
-        user.latitude,
-        user.longitude,
-      );
-
-      // Use AstrologyServiceBridge for predictions
-      final bridge = AstrologyServiceBridge.instance;
-      final predictions = await bridge.getPredictions(
-        localBirthDateTime: user.localBirthDateTime,
-        birthTimezoneId: timezoneId,
-        birthLatitude: user.latitude,
-        birthLongitude: user.longitude,
-        localTargetDateTime: date,
-        targetTimezoneId: timezoneId,
-        currentLatitude: user.latitude,
-        currentLongitude: user.longitude,
-        predictionType: 'daily',
-        ayanamsha: user.ayanamsha,
-      );
+      final predictions = await PredictionBatchService.instance
+          .getOrFetch(user, PredictionKind.daily, date);
 
       // Extract prediction data from API response
       final predictionData = <String, String>{};
@@ -101,6 +82,13 @@ class DailyPredictionsNotifier extends StateNotifier<DailyPredictionsState> {
         }
       }
 
+      if (predictionData.isNotEmpty) {
+        StartupSnapshotService.instance.recordPrediction(
+          date: date,
+          headline: predictionData['career'] ?? predictionData.values.first,
+        );
+      }
+
       state = state.copyWith(
         isLoading: false,
         predictions: predictionData.isNotEmpty ? predictionData : null,
@@ -0,0 +1,365 @@
+/// Prediction Text Engine
+///
+/// Renders prediction paragraphs on the device from integer facts (tara,
+/// house, dasha lords, …) in the user's language. Each language pack's
+/// templates are compiled once into a flat opcode list; grammatical forms of
+/// every vocabulary word (e.g. the locative "रोहिणी में", "மேஷத்தில்") are
+/// precomputed at the same time, so rendering is rule selection by bitmask
+/// plus a few buffer writes.
+library;
+
+import 'dart:typed_data';
+import 'prediction_text_packs.dart';
+
+/// Word lists a fact's value indexes into
+enum Vocabulary { tara, nakshatra, rashi, planet, weekday, number }
+
+/// Facts a template can test and interpolate
+enum PredictionFact {
+  /// Tara from the birth star, 1 (Janma) … 9 (Parama Mitra)
+  tara(Vocabulary.tara),
+
+  /// House of the transit moon from the natal moon, 1 … 12
+  house(Vocabulary.number),
+
+  /// Chandra bala, a [TransitQuality] index
+  chandraQuality(null),
+
+  /// Transit moon's nakshatra, 0-based
+  nakshatra(Vocabulary.nakshatra),
+
+  /// Transit moon's sign, 0-based
+  transitRashi(Vocabulary.rashi),
+
+  /// Natal moon's sign, 0-based
+  natalRashi(Vocabulary.rashi),
+
+  /// Maha and antar dasha lords, 0-based in [PredictionTextPacks.planets]
+  mahadasha(Vocabulary.planet),
+  antardasha(Vocabulary.planet),
+
+  /// Overall quality of the day, a [TransitQuality] index
+  dayQuality(null),
+
+  /// 0 = Monday … 6 = Sunday
+  weekday(Vocabulary.weekday),
+
+  /// Good days in the week, 0 … 7
+  goodDays(Vocabulary.number),
+
+  /// 1 when a `{name}` text value is supplied
+  named(null);
+
+  final Vocabulary? vocabulary;
+
+  const PredictionFact(this.vocabulary);
+}
+
+/// Favourability of a transit factor
+enum TransitQuality { good, mixed, bad }
+
+/// Fact values for one rendering
+class PredictionFacts {
+  final Int32List values = Int32List(PredictionFact.values.length);
+
+  PredictionFacts();
+
+  int operator [](PredictionFact fact) => values[fact.index];
+
+  void operator []=(PredictionFact fact, int value) =>
+      values[fact.index] = value;
+}
+
+/// A template source with the facts it applies to
+///
+/// Every entry of [when] must hold (its value among the listed ones); the
+/// first matching rule of a section is rendered. Fact values are below 32.
+class TemplateRule {
+  final Map<PredictionFact, List<int>> when;
+  final String text;
+
+  const TemplateRule(this.text, {this.when = const {}});
+}
+
+/// Vocabulary, grammatical forms and templates of one language
+class PredictionLanguagePack {
+  final Map<Vocabulary, List<String>> words;
+
+  /// Named forms; the nominative (no suffix in the slot) is implicit
+  final Map<String, String Function(String word)> forms;
+
+  /// Forms of numbers, when they differ from forms of words (e.g. ordinals)
+  final Map<String, String Function(int number)> numberForms;
+
+  final Map<String, List<TemplateRule>> sections;
+
+  const PredictionLanguagePack({
+    required this.words,
+    required this.sections,
+    this.forms = const {},
+    this.numberForms = const {},
+  });
+}
+
+// Opcodes: literal <pool index>; word <fact> <form>; text <key index>
+const int _opLiteral = 0;
+const int _opWord = 1;
+const int _opText = 2;
+
+/// Largest number precomputed per number form
+const int _maxNumber = 31;
+
+/// A compiled template
+class TemplateProgram {
+  final Int32List code;
+  final List<String> literals;
+  final List<String> textKeys;
+
+  const TemplateProgram._(this.code, this.literals, this.textKeys);
+}
+
+class _CompiledRule {
+  /// (fact index, accepted values bitmask) pairs
+  final Int32List conditions;
+  final TemplateProgram program;
+
+  const _CompiledRule(this.conditions, this.program);
+
+  bool matches(Int32List facts) {
+    for (var i = 0; i < conditions.length; i += 2) {
+      if ((conditions[i + 1] >> facts[conditions[i]]) & 1 == 0) return false;
+    }
+    return true;
+  }
+}
+
+/// A language pack ready to render
+class CompiledLanguage {
+  final Map<String, List<_CompiledRule>> _sections;
+
+  /// `_formed[vocabulary][form][value]`; form 0 is the nominative
+  final List<List<List<String>>> _formed;
+
+  final Map<String, int> _formIndex;
+
+  CompiledLanguage._(this._sections, this._formed, this._formIndex);
+
+  /// Compile every template of [pack]; throws [FormatException] on a bad
+  /// template, unknown slot or unknown form
+  factory CompiledLanguage.compile(PredictionLanguagePack pack) {
+    final formNames = <String>{...pack.forms.keys, ...pack.numberForms.keys};
+    final formIndex = <String, int>{'': 0};
+    for (final name in formNames) {
+      formIndex[name] = formIndex.length;
+    }
+
+    final formed = <List<List<String>>>[
+      for (final vocabulary in Vocabulary.values)
+        _formsOf(pack, vocabulary, formIndex),
+    ];
+
+    final sections = <String, List<_CompiledRule>>{
+      for (final entry in pack.sections.entries)
+        entry.key: [
+          for (final rule in entry.value)
+            _CompiledRule(
+              _compileConditions(rule.when),
+              compileTemplate(rule.text, formIndex),
+            ),
+        ],
+    };
+    return CompiledLanguage._(sections, formed, formIndex);
+  }
+
+  static List<List<String>> _formsOf(PredictionLanguagePack pack,
+      Vocabulary vocabulary, Map<String, int> formIndex) {
+    final base = vocabulary == Vocabulary.number
+        ? [for (var n = 0; n <= _maxNumber; n++) '$n']
+        : pack.words[vocabulary] ?? const <String>[];
+    final byForm = List<List<String>>.filled(formIndex.length, base);
+    for (final entry in formIndex.entries) {
+      if (entry.value == 0) continue;
+      final numberForm = pack.numberForms[entry.key];
+      final wordForm = pack.forms[entry.key];
+      if (vocabulary == Vocabulary.number && numberForm != null) {
+        byForm[entry.value] = [
+          for (var n = 0; n <= _maxNumber; n++) numberForm(n),
+        ];
+      } else if (wordForm != null) {
+        byForm[entry.value] = [for (final word in base) wordForm(word)];
+      }
+    }
+    return byForm;
+  }
+
+  static Int32List _compileConditions(Map<PredictionFact, List<int>> when) {
+    final conditions = Int32List(when.length * 2);
+    var i = 0;
+    for (final entry in when.entries) {
+      var mask = 0;
+      for (final value in entry.value) {
+        if (value < 0 || value > 31) {
+          throw FormatException('Fact value out of range', value);
+        }
+        mask |= 1 << value;
+      }
+      conditions[i++] = entry.key.index;
+      conditions[i++] = mask;
+    }
+    return conditions;
+  }
+
+  /// Compile `{fact}`, `{fact:form}` and `{text}` slots; `{{`/`}}` escape
+  static TemplateProgram compileTemplate(
+      String source, Map<String, int> formIndex) {
+    final code = <int>[];
+    final literals = <String>[];
+    final textKeys = <String>[];
+    final literal = StringBuffer();
+
+    void flush() {
+      if (literal.isEmpty) return;
+      code
+        ..add(_opLiteral)
+        ..add(literals.length);
+      literals.add(literal.toString());
+      literal.clear();
+    }
+
+    var i = 0;
+    while (i < source.length) {
+      final char = source[i];
+      if ((char == '{' || char == '}') &&
+          i + 1 < source.length &&
+          source[i + 1] == char) {
+        literal.write(char);
+        i += 2;
+        continue;
+      }
+      if (char == '}') {
+        throw FormatException('Unmatched }', source, i);
+      }
+      if (char != '{') {
+        literal.write(char);
+        i++;
+        continue;
+      }
+
+      final close = source.indexOf('}', i);
+      if (close < 0) throw FormatException('Unclosed slot', source, i);
+      flush();
+      final slot = source.substring(i + 1, close).split(':');
+      final name = slot[0].trim();
+      final form = slot.length > 1 ? slot[1].trim() : '';
+      final fact = _factByName[name];
+      if (fact != null && fact.vocabulary != null) {
+        final index = formIndex[form];
+        if (index == null) {
+          throw FormatException('Unknown form "$form"', source, i);
+        }
+        code
+          ..add(_opWord)
+          ..add(fact.index)
+          ..add(index);
+      } else if (fact == null && form.isEmpty) {
+        code
+          ..add(_opText)
+          ..add(textKeys.length);
+        textKeys.add(name);
+      } else {
+        throw FormatException('Slot "$name" cannot be rendered', source, i);
+      }
+      i = close + 1;
+    }
+    flush();
+    return TemplateProgram._(Int32List.fromList(code), literals, textKeys);
+  }
+
+  static final Map<String, PredictionFact> _factByName = {
+    for (final fact in PredictionFact.values) fact.name: fact,
+  };
+
+  bool hasSection(String section) => _sections.containsKey(section);
+
+  /// Form names this language defines
+  Iterable<String> get forms => _formIndex.keys.where((f) => f.isNotEmpty);
+
+  /// A vocabulary word in the nominative
+  String word(Vocabulary vocabulary, int value) {
+    final words = _formed[vocabulary.index][0];
+    return value >= 0 && value < words.length ? words[value] : '';
+  }
+
+  /// Render the first rule of [section] matching [facts]; null if none does
+  String? render(String section, PredictionFacts facts,
+      [Map<String, String> text = const {}]) {
+    final rules = _sections[section];
+    if (rules == null) return null;
+    final values = facts.values;
+    for (final rule in rules) {
+      if (rule.matches(values)) return _run(rule.program, values, text);
+    }
+    return null;
+  }
+
+  String _run(TemplateProgram program, Int32List facts,
+      Map<String, String> text) {
+    final code = program.code;
+    final out = StringBuffer();
+    var pc = 0;
+    while (pc < code.length) {
+      switch (code[pc]) {
+        case _opLiteral:
+          out.write(program.literals[code[pc + 1]]);
+          pc += 2;
+        case _opWord:
+          final fact = PredictionFact.values[code[pc + 1]];
+          final words = _formed[fact.vocabulary!.index][code[pc + 2]];
+          final value = facts[code[pc + 1]];
+          if (value >= 0 && value < words.length) out.write(words[value]);
+          pc += 3;
+        default:
+          out.write(text[program.textKeys[code[pc + 1]]] ?? '');
+          pc += 2;
+      }
+    }
+    return out.toString();
+  }
+}
+
+/// Prediction Text Engine - compiled packs by language
+class PredictionTextEngine {
+  static PredictionTextEngine? _instance;
+
+  static PredictionTextEngine get instance {
+    _instance ??= PredictionTextEngine._();
+    return _instance!;
+  }
+
+  PredictionTextEngine._();
+
+  static const String fallbackLanguage = 'english';
+
+  final Map<String, CompiledLanguage> _compiled = {};
+
+  /// Compiled pack for a `SupportedLanguage` name; languages without a pack
+  /// use English
+  CompiledLanguage language(String name) {
+    final pack = PredictionTextPacks.packs.containsKey(name)
+        ? name
+        : fallbackLanguage;
+    return _compiled[pack] ??=
+        CompiledLanguage.compile(PredictionTextPacks.packs[pack]!);
+  }
+
+  /// Render [section] in [languageName], falling back to English when the
+  /// pack lacks the section
+  String render(String languageName, String section, PredictionFacts facts,
+      [Map<String, String> text = const {}]) {
+    final compiled = language(languageName);
+    if (compiled.hasSection(section)) {
+      return compiled.render(section, facts, text) ?? '';
+    }
+    return language(fallbackLanguage).render(section, facts, text) ?? '';
+  }
+}
@@ -0,0 +1,542 @@
+/// Prediction Text Packs
+///
+/// Vocabulary, grammatical forms and rule-selected templates per language,
+/// keyed by `SupportedLanguage` name. Languages without a pack render in
+/// English, as elsewhere in the app.
+///
+/// Sections: outlook, career, finance, health, love, dasha,
+/// notification_title, notification_body, week_overview, week_day.
+library;
+
+import 'prediction_text_engine.dart';
+
+const _good = [0]; // TransitQuality.good
+const _mixed = [1];
+const _bad = [2];
+const _goodTaras = [2, 4, 6, 8, 9];
+const _badTaras = [3, 5, 7];
+
+/// Prediction Text Packs
+class PredictionTextPacks {
+  PredictionTextPacks._();
+
+  /// Planet order of [PredictionFact.mahadasha]/[PredictionFact.antardasha]
+  static const List<String> planets = [
+    'Sun', 'Moon', 'Mars', 'Mercury', 'Jupiter', //
+    'Venus', 'Saturn', 'Rahu', 'Ketu',
+  ];
+
+  static final Map<String, PredictionLanguagePack> packs = {
+    'english': _english,
+    'hindi': _hindi,
+    'telugu': _telugu,
+    'tamil': _tamil,
+  };
+
+  static List<TemplateRule> _byQuality(
+          String good, String mixed, String bad) =>
+      [
+        TemplateRule(good, when: const {PredictionFact.chandraQuality: _good}),
+        TemplateRule(mixed,
+            when: const {PredictionFact.chandraQuality: _mixed}),
+        TemplateRule(bad),
+      ];
+
+  static List<TemplateRule> _byDay(String good, String mixed, String bad) => [
+        TemplateRule(good, when: const {PredictionFact.dayQuality: _good}),
+        TemplateRule(mixed, when: const {PredictionFact.dayQuality: _mixed}),
+        TemplateRule(bad),
+      ];
+
+  static List<TemplateRule> _byWeek(String good, String mixed, String bad) =>
+      [
+        TemplateRule(good,
+            when: const {PredictionFact.goodDays: [5, 6, 7]}),
+        TemplateRule(mixed, when: const {PredictionFact.goodDays: [3, 4]}),
+        TemplateRule(bad),
+      ];
+
+  static List<TemplateRule> _byName(String named, String unnamed) => [
+        TemplateRule(named, when: const {PredictionFact.named: [1]}),
+        TemplateRule(unnamed),
+      ];
+
+  // English
+
+  static String _englishOrdinal(int n) {
+    final teen = n % 100 >= 11 && n % 100 <= 13;
+    final suffix = teen
+        ? 'th'
+        : switch (n % 10) { 1 => 'st', 2 => 'nd', 3 => 'rd', _ => 'th' };
+    return '$n$suffix';
+  }
+
+  static final PredictionLanguagePack _english = PredictionLanguagePack(
+    words: const {
+      Vocabulary.tara: [
+        '', 'Janma', 'Sampat', 'Vipat', 'Kshema', 'Pratyak', //
+        'Sadhana', 'Naidhana', 'Mitra', 'Parama Mitra',
+      ],
+      Vocabulary.nakshatra: [
+        'Ashwini', 'Bharani', 'Krittika', 'Rohini', 'Mrigashira', //
+        'Ardra', 'Punarvasu', 'Pushya', 'Ashlesha', 'Magha',
+        'Purva Phalguni', 'Uttara Phalguni', 'Hasta', 'Chitra', 'Swati',
+        'Vishakha', 'Anuradha', 'Jyeshtha', 'Mula', 'Purva Ashadha',
+        'Uttara Ashadha', 'Shravana', 'Dhanishtha', 'Shatabhisha',
+        'Purva Bhadrapada', 'Uttara Bhadrapada', 'Revati',
+      ],
+      Vocabulary.rashi: [
+        'Aries', 'Taurus', 'Gemini', 'Cancer', 'Leo', 'Virgo', //
+        'Libra', 'Scorpio', 'Sagittarius', 'Capricorn', 'Aquarius',
+        'Pisces',
+      ],
+      Vocabulary.planet: planets,
+      Vocabulary.weekday: [
+        'Monday', 'Tuesday', 'Wednesday', 'Thursday', 'Friday', //
+        'Saturday', 'Sunday',
+      ],
+    },
+    numberForms: const {'ord': _englishOrdinal},
+    sections: {
+      'outlook': const [
+        TemplateRule(
+            'The Moon returns to your birth star {nakshatra}; keep the day '
+            'simple and avoid fresh commitments.',
+            when: {PredictionFact.tara: [1]}),
+        TemplateRule(
+            'Sampat tara in {nakshatra} favours gains and steady progress '
+            'today.',
+            when: {PredictionFact.tara: [2]}),
+        TemplateRule(
+            'Vipat tara in {nakshatra} brings obstacles; move carefully and '
+            'double check plans.',
+            when: {PredictionFact.tara: [3]}),
+        TemplateRule(
+            'Kshema tara in {nakshatra} supports well-being and a settled '
+            'mood.',
+            when: {PredictionFact.tara: [4]}),
+        TemplateRule(
+            'Pratyak tara in {nakshatra} may stir opposition; choose '
+            'patience over confrontation.',
+            when: {PredictionFact.tara: [5]}),
+        TemplateRule(
+            'Sadhana tara in {nakshatra} rewards effort; a good day to '
+            'pursue goals.',
+            when: {PredictionFact.tara: [6]}),
+        TemplateRule(
+            'Naidhana tara in {nakshatra} is the weakest of the nine; '
+            'postpone risky decisions.',
+            when: {PredictionFact.tara: [7]}),
+        TemplateRule(
+            'Mitra tara in {nakshatra} brings friendly support and '
+            'cooperation.',
+            when: {PredictionFact.tara: [8]}),
+        TemplateRule(
+            'Parama Mitra tara in {nakshatra} is highly favourable; help '
+            'comes easily today.'),
+      ],
+      'career': _byQuality(
+        'With the Moon in your {house:ord} house from {natalRashi}, work '
+            'moves ahead and initiatives find support.',
+        'The Moon in your {house:ord} house gives a mixed day at work; '
+            'finish pending tasks before starting new ones.',
+        'The Moon in your {house:ord} house can slow work; avoid disputes '
+            'with colleagues.',
+      ),
+      'finance': _byQuality(
+        'Finances look steady; a sensible day for planned spending.',
+        'Keep spending measured; returns may arrive later than expected.',
+        'Avoid lending or large purchases while the Moon transits your '
+            '{house:ord} house.',
+      ),
+      'health': _byQuality(
+        'Energy is good; maintain your routine.',
+        'Pace yourself and rest well to keep energy balanced.',
+        'Energy may dip; eat light and avoid overexertion.',
+      ),
+      'love': _byQuality(
+        'Relationships feel warm and supportive.',
+        'Small misunderstandings clear with open conversation.',
+        'Be patient with loved ones; avoid reacting in haste.',
+      ),
+      'dasha': const [
+        TemplateRule(
+            'Ketu maha dasha ({antardasha} antar dasha) turns attention '
+            'inward; favour reflection over expansion.',
+            when: {PredictionFact.mahadasha: [8]}),
+        TemplateRule(
+            'Venus maha dasha ({antardasha} antar dasha) supports comfort, '
+            'art and relationships.',
+            when: {PredictionFact.mahadasha: [5]}),
+        TemplateRule(
+            'Sun maha dasha ({antardasha} antar dasha) highlights '
+            'authority and recognition.',
+            when: {PredictionFact.mahadasha: [0]}),
+        TemplateRule(
+            'Moon maha dasha ({antardasha} antar dasha) makes emotions and '
+            'family central.',
+            when: {PredictionFact.mahadasha: [1]}),
+        TemplateRule(
+            'Mars maha dasha ({antardasha} antar dasha) gives drive; '
+            'channel it into decisive action.',
+            when: {PredictionFact.mahadasha: [2]}),
+        TemplateRule(
+            'Rahu maha dasha ({antardasha} antar dasha) brings ambition '
+            'and sudden changes.',
+            when: {PredictionFact.mahadasha: [7]}),
+        TemplateRule(
+            'Jupiter maha dasha ({antardasha} antar dasha) favours growth, '
+            'learning and guidance.',
+            when: {PredictionFact.mahadasha: [4]}),
+        TemplateRule(
+            'Saturn maha dasha ({antardasha} antar dasha) rewards '
+            'discipline and steady effort.',
+            when: {PredictionFact.mahadasha: [6]}),
+        TemplateRule(
+            'Mercury maha dasha ({antardasha} antar dasha) favours '
+            'communication, study and trade.'),
+      ],
+      'notification_title': _byName(
+          '🌟 Daily Prediction for {name}', '🌟 Your Daily Prediction'),
+      'notification_body': const [
+        TemplateRule('{outlook}\nRashi: {transitRashi}\n'
+            'Nakshatra: {nakshatra}\n\nTap to view full prediction'),
+      ],
+      'week_overview': _byWeek(
+        'A favourable week: {goodDays} of 7 days are supportive.',
+        'A mixed week: {goodDays} of 7 days are supportive; plan key work '
+            'for them.',
+        'A challenging week: only {goodDays} of 7 days are supportive; '
+            'keep plans flexible.',
+      ),
+      'week_day': _byDay(
+        '{weekday}: Moon in {nakshatra} ({tara} tara), {house:ord} house '
+            'from your moon sign. A good day.',
+        '{weekday}: Moon in {nakshatra} ({tara} tara), {house:ord} house '
+            'from your moon sign. A mixed day.',
+        '{weekday}: Moon in {nakshatra} ({tara} tara), {house:ord} house '
+            'from your moon sign. Go carefully.',
+      ),
+    },
+  );
+
+  // Hindi: postpositions follow the noun unchanged; ordinals are oblique
+
+  static const List<String> _hindiOrdinals = [
+    '', 'पहले', 'दूसरे', 'तीसरे', 'चौथे', 'पाँचवें', 'छठे', //
+    'सातवें', 'आठवें', 'नौवें', 'दसवें', 'ग्यारहवें', 'बारहवें',
+  ];
+
+  static String _hindiOrdinal(int n) =>
+      n < _hindiOrdinals.length ? _hindiOrdinals[n] : '$nवें';
+
+  static String _hindiLocative(String word) => '$word में';
+
+  static final PredictionLanguagePack _hindi = PredictionLanguagePack(
+    words: const {
+      Vocabulary.tara: [
+        '', 'जन्म', 'संपत', 'विपत', 'क्षेम', 'प्रत्यक', //
+        'साधना', 'नैधन', 'मित्र', 'परम मित्र',
+      ],
+      Vocabulary.nakshatra: [
+        'अश्विनी', 'भरणी', 'कृत्तिका', 'रोहिणी', 'मृगशिरा', 'आर्द्रा', //
+        'पुनर्वसु', 'पुष्य', 'आश्लेषा', 'मघा', 'पूर्व फाल्गुनी',
+        'उत्तर फाल्गुनी', 'हस्त', 'चित्रा', 'स्वाति', 'विशाखा', 'अनुराधा',
+        'ज्येष्ठा', 'मूल', 'पूर्वाषाढ़ा', 'उत्तराषाढ़ा', 'श्रवण', 'धनिष्ठा',
+        'शतभिषा', 'पूर्व भाद्रपद', 'उत्तर भाद्रपद', 'रेवती',
+      ],
+      Vocabulary.rashi: [
+        'मेष', 'वृषभ', 'मिथुन', 'कर्क', 'सिंह', 'कन्या', //
+        'तुला', 'वृश्चिक', 'धनु', 'मकर', 'कुंभ', 'मीन',
+      ],
+      Vocabulary.planet: [
+        'सूर्य', 'चंद्र', 'मंगल', 'बुध', 'गुरु', //
+        'शुक्र', 'शनि', 'राहु', 'केतु',
+      ],
+      Vocabulary.weekday: [
+        'सोमवार', 'मंगलवार', 'बुधवार', 'गुरुवार', 'शुक्रवार', //
+        'शनिवार', 'रविवार',
+      ],
+    },
+    forms: const {'loc': _hindiLocative},
+    numberForms: const {'ord': _hindiOrdinal},
+    sections: {
+      'outlook': const [
+        TemplateRule(
+            'चंद्रमा आपके जन्म नक्षत्र {nakshatra:loc} है; दिन सरल रखें और '
+            'नए वादों से बचें।',
+            when: {PredictionFact.tara: [1]}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} तारा शुभ है; प्रयासों का अच्छा फल मिलेगा।',
+            when: {PredictionFact.tara: _goodTaras}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} तारा प्रतिकूल है; सावधानी से आगे बढ़ें।'),
+      ],
+      'career': _byQuality(
+        'चंद्रमा {natalRashi} से {house:ord} भाव में है; काम आगे बढ़ेगा और '
+            'नई पहल को समर्थन मिलेगा।',
+        'चंद्रमा {house:ord} भाव में है; काम में मिला-जुला दिन, नया शुरू '
+            'करने से पहले बाकी काम पूरे करें।',
+        'चंद्रमा {house:ord} भाव में काम की गति धीमी कर सकता है; '
+            'सहकर्मियों से विवाद टालें।',
+      ),
+      'finance': _byQuality(
+        'आर्थिक स्थिति स्थिर है; योजनाबद्ध खर्च के लिए अच्छा दिन।',
+        'खर्च संतुलित रखें; लाभ देर से मिल सकता है।',
+        'चंद्रमा के {house:ord} भाव में रहते उधार देने या बड़ी खरीद से '
+            'बचें।',
+      ),
+      'health': _byQuality(
+        'ऊर्जा अच्छी है; अपनी दिनचर्या बनाए रखें।',
+        'संतुलन के लिए आराम करें और गति धीमी रखें।',
+        'ऊर्जा कम हो सकती है; हल्का भोजन करें और अधिक श्रम से बचें।',
+      ),
+      'love': _byQuality(
+        'संबंधों में गर्मजोशी और सहयोग रहेगा।',
+        'खुली बातचीत से छोटी गलतफहमियाँ दूर होंगी।',
+        'प्रियजनों के साथ धैर्य रखें; जल्दबाज़ी में प्रतिक्रिया न दें।',
+      ),
+      'dasha': const [
+        TemplateRule('{mahadasha} महादशा में {antardasha} अंतर्दशा चल रही '
+            'है; इसका प्रभाव आज के निर्णयों पर रहेगा।'),
+      ],
+      'notification_title':
+          _byName('🌟 {name} का दैनिक भविष्यफल', '🌟 आपका दैनिक भविष्यफल'),
+      'notification_body': const [
+        TemplateRule('{outlook}\nराशि: {transitRashi}\n'
+            'नक्षत्र: {nakshatra}\n\nपूरा भविष्यफल देखने के लिए टैप करें'),
+      ],
+      'week_overview': _byWeek(
+        'शुभ सप्ताह: 7 में से {goodDays} दिन अनुकूल हैं।',
+        'मिला-जुला सप्ताह: 7 में से {goodDays} दिन अनुकूल हैं; मुख्य काम '
+            'उन्हीं दिनों में रखें।',
+        'चुनौतीपूर्ण सप्ताह: 7 में से केवल {goodDays} दिन अनुकूल हैं।',
+      ),
+      'week_day': _byDay(
+        '{weekday}: चंद्रमा {nakshatra:loc} ({tara} तारा), {house:ord} '
+            'भाव में। शुभ दिन।',
+        '{weekday}: चंद्रमा {nakshatra:loc} ({tara} तारा), {house:ord} '
+            'भाव में। मिला-जुला दिन।',
+        '{weekday}: चंद्रमा {nakshatra:loc} ({tara} तारा), {house:ord} '
+            'भाव में। सावधानी रखें।',
+      ),
+    },
+  );
+
+  // Telugu: the locative is the agglutinated suffix -లో
+
+  static String _teluguLocative(String word) => '$wordలో';
+
+  static String _teluguOrdinal(int n) => '$nవ';
+
+  static final PredictionLanguagePack _telugu = PredictionLanguagePack(
+    words: const {
+      Vocabulary.tara: [
+        '', 'జన్మ', 'సంపత్', 'విపత్', 'క్షేమ', 'ప్రత్యక్', //
+        'సాధన', 'నైధన', 'మిత్ర', 'పరమ మిత్ర',
+      ],
+      Vocabulary.nakshatra: [
+        'అశ్విని', 'భరణి', 'కృత్తిక', 'రోహిణి', 'మృగశిర', 'ఆర్ద్ర', //
+        'పునర్వసు', 'పుష్యమి', 'ఆశ్లేష', 'మఖ', 'పూర్వ ఫల్గుణి',
+        'ఉత్తర ఫల్గుణి', 'హస్త', 'చిత్ర', 'స్వాతి', 'విశాఖ', 'అనూరాధ',
+        'జ్యేష్ఠ', 'మూల', 'పూర్వాషాఢ', 'ఉత్తరాషాఢ', 'శ్రవణం', 'ధనిష్ఠ',
+        'శతభిషం', 'పూర్వాభాద్ర', 'ఉత్తరాభాద్ర', 'రేవతి',
+      ],
+      Vocabulary.rashi: [
+        'మేషం', 'వృషభం', 'మిథునం', 'కర్కాటకం', 'సింహం', 'కన్య', //
+        'తుల', 'వృశ్చికం', 'ధనుస్సు', 'మకరం', 'కుంభం', 'మీనం',
+      ],
+      // Stems, as used in compounds such as "శని మహాదశ"
+      Vocabulary.planet: [
+        'సూర్య', 'చంద్ర', 'కుజ', 'బుధ', 'గురు', //
+        'శుక్ర', 'శని', 'రాహు', 'కేతు',
+      ],
+      Vocabulary.weekday: [
+        'సోమవారం', 'మంగళవారం', 'బుధవారం', 'గురువారం', 'శుక్రవారం', //
+        'శనివారం', 'ఆదివారం',
+      ],
+    },
+    forms: const {'loc': _teluguLocative},
+    numberForms: const {'ord': _teluguOrdinal},
+    sections: {
+      'outlook': const [
+        TemplateRule(
+            'చంద్రుడు మీ జన్మ నక్షత్రం {nakshatra:loc} ఉన్నాడు; రోజును '
+            'సరళంగా ఉంచండి, కొత్త బాధ్యతలు వద్దు.',
+            when: {PredictionFact.tara: [1]}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} తార అనుకూలం; ప్రయత్నాలకు మంచి ఫలితాలు '
+            'వస్తాయి.',
+            when: {PredictionFact.tara: _goodTaras}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} తార ప్రతికూలం; జాగ్రత్తగా ముందుకు '
+            'సాగండి.'),
+      ],
+      'career': _byQuality(
+        '{natalRashi} నుండి {house:ord} ఇంట్లో చంద్రుడు; పనిలో పురోగతి, '
+            'కొత్త ప్రయత్నాలకు మద్దతు.',
+        '{house:ord} ఇంట్లో చంద్రుడు; పనిలో మిశ్రమ ఫలితాలు, కొత్తవి '
+            'మొదలుపెట్టే ముందు పెండింగ్ పనులు పూర్తి చేయండి.',
+        '{house:ord} ఇంట్లో చంద్రుడు పనిని నెమ్మదించవచ్చు; సహోద్యోగులతో '
+            'వాదనలు నివారించండి.',
+      ),
+      'finance': _byQuality(
+        'ఆర్థిక స్థితి స్థిరంగా ఉంది; ప్రణాళికాబద్ధ ఖర్చులకు మంచి రోజు.',
+        'ఖర్చులను నియంత్రించండి; లాభాలు ఆలస్యంగా రావచ్చు.',
+        'చంద్రుడు {house:ord} ఇంట్లో ఉన్నప్పుడు అప్పులు ఇవ్వడం, పెద్ద '
+            'కొనుగోళ్లు నివారించండి.',
+      ),
+      'health': _byQuality(
+        'శక్తి బాగుంది; దినచర్యను కొనసాగించండి.',
+        'విశ్రాంతి తీసుకుని శక్తిని సమతుల్యంగా ఉంచండి.',
+        'శక్తి తగ్గవచ్చు; తేలికపాటి ఆహారం తీసుకోండి.',
+      ),
+      'love': _byQuality(
+        'సంబంధాలు ఆప్యాయంగా, సహాయకంగా ఉంటాయి.',
+        'బహిరంగ సంభాషణతో చిన్న అపార్థాలు తొలగుతాయి.',
+        'ఆత్మీయులతో ఓర్పుగా ఉండండి; తొందరపాటు వద్దు.',
+      ),
+      'dasha': const [
+        TemplateRule('{mahadasha} మహాదశలో {antardasha} అంతర్దశ '
+            'నడుస్తోంది; దాని ప్రభావం నేటి నిర్ణయాలపై ఉంటుంది.'),
+      ],
+      'notification_title':
+          _byName('🌟 {name} గారికి నేటి ఫలితాలు', '🌟 మీ నేటి ఫలితాలు'),
+      'notification_body': const [
+        TemplateRule('{outlook}\nరాశి: {transitRashi}\n'
+            'నక్షత్రం: {nakshatra}\n\nపూర్తి ఫలితాల కోసం నొక్కండి'),
+      ],
+      'week_overview': _byWeek(
+        'శుభప్రదమైన వారం: 7 లో {goodDays} రోజులు అనుకూలం.',
+        'మిశ్రమ వారం: 7 లో {goodDays} రోజులు అనుకూలం; ముఖ్యమైన పనులు ఆ '
+            'రోజులకు ఉంచండి.',
+        'సవాళ్ల వారం: 7 లో {goodDays} రోజులు మాత్రమే అనుకూలం.',
+      ),
+      'week_day': _byDay(
+        '{weekday}: {nakshatra:loc} చంద్రుడు ({tara} తార), {house:ord} '
+            'ఇంట్లో. అనుకూలమైన రోజు.',
+        '{weekday}: {nakshatra:loc} చంద్రుడు ({tara} తార), {house:ord} '
+            'ఇంట్లో. మిశ్రమ రోజు.',
+        '{weekday}: {nakshatra:loc} చంద్రుడు ({tara} తార), {house:ord} '
+            'ఇంట్లో. జాగ్రత్త అవసరం.',
+      ),
+    },
+  );
+
+  // Tamil: the locative inflects the stem (மேஷம் → மேஷத்தில்,
+  // அஸ்வினி → அஸ்வினியில், குரு → குருவில், சூரியன் → சூரியனில்)
+
+  static const String _pulli = '்';
+
+  static String _tamilLocative(String word) {
+    if (word.endsWith('ம$_pulli')) {
+      return '${word.substring(0, word.length - 2)}த்தில்';
+    }
+    if (word.endsWith(_pulli)) {
+      return '${word.substring(0, word.length - 1)}ில்';
+    }
+    if (word.endsWith('ு')) return '$wordவில்';
+    return '$wordயில்';
+  }
+
+  /// Ablative: the locative's final ல் joins இருந்து (மேஷத்திலிருந்து)
+  static String _tamilAblative(String word) {
+    final locative = _tamilLocative(word);
+    return '${locative.substring(0, locative.length - 1)}ிருந்து';
+  }
+
+  static String _tamilOrdinal(int n) => '$n-ஆம்';
+
+  static final PredictionLanguagePack _tamil = PredictionLanguagePack(
+    words: const {
+      Vocabulary.tara: [
+        '', 'ஜன்ம', 'சம்பத்', 'விபத்', 'க்ஷேம', 'பிரத்யக்', //
+        'சாதக', 'வத', 'மித்ர', 'பரம மித்ர',
+      ],
+      Vocabulary.nakshatra: [
+        'அஸ்வினி', 'பரணி', 'கிருத்திகை', 'ரோகிணி', 'மிருகசீரிடம்', //
+        'திருவாதிரை', 'புனர்பூசம்', 'பூசம்', 'ஆயில்யம்', 'மகம்', 'பூரம்',
+        'உத்திரம்', 'அஸ்தம்', 'சித்திரை', 'சுவாதி', 'விசாகம்', 'அனுஷம்',
+        'கேட்டை', 'மூலம்', 'பூராடம்', 'உத்திராடம்', 'திருவோணம்', 'அவிட்டம்',
+        'சதயம்', 'பூரட்டாதி', 'உத்திரட்டாதி', 'ரேவதி',
+      ],
+      Vocabulary.rashi: [
+        'மேஷம்', 'ரிஷபம்', 'மிதுனம்', 'கடகம்', 'சிம்மம்', 'கன்னி', //
+        'துலாம்', 'விருச்சிகம்', 'தனுசு', 'மகரம்', 'கும்பம்', 'மீனம்',
+      ],
+      Vocabulary.planet: [
+        'சூரிய', 'சந்திர', 'செவ்வாய்', 'புதன்', 'குரு', //
+        'சுக்கிர', 'சனி', 'ராகு', 'கேது',
+      ],
+      Vocabulary.weekday: [
+        'திங்கள்', 'செவ்வாய்', 'புதன்', 'வியாழன்', 'வெள்ளி', //
+        'சனி', 'ஞாயிறு',
+      ],
+    },
+    forms: const {'loc': _tamilLocative, 'abl': _tamilAblative},
+    numberForms: const {'ord': _tamilOrdinal},
+    sections: {
+      'outlook': const [
+        TemplateRule(
+            'சந்திரன் உங்கள் ஜென்ம நட்சத்திரமான {nakshatra:loc} உள்ளார்; '
+            'இன்று எளிமையாக இருங்கள், புதிய பொறுப்புகளைத் தவிர்க்கவும்.',
+            when: {PredictionFact.tara: [1]}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} தாரை சாதகம்; முயற்சிகளுக்கு நல்ல பலன் '
+            'கிடைக்கும்.',
+            when: {PredictionFact.tara: _goodTaras}),
+        TemplateRule(
+            '{nakshatra:loc} {tara} தாரை பாதகம்; கவனமாக செயல்படுங்கள்.',
+            when: {PredictionFact.tara: _badTaras}),
+      ],
+      'career': _byQuality(
+        '{natalRashi:abl} {house:ord} வீட்டில் சந்திரன்; பணியில் முன்னேற்றம், '
+            'புதிய முயற்சிகளுக்கு ஆதரவு.',
+        '{house:ord} வீட்டில் சந்திரன்; பணியில் கலவையான நாள், புதியதைத் '
+            'தொடங்கும் முன் நிலுவைப் பணிகளை முடிக்கவும்.',
+        '{house:ord} வீட்டில் சந்திரன் பணியை மெதுவாக்கலாம்; சக '
+            'ஊழியர்களுடன் வாக்குவாதத்தைத் தவிர்க்கவும்.',
+      ),
+      'finance': _byQuality(
+        'நிதி நிலை சீராக உள்ளது; திட்டமிட்ட செலவுகளுக்கு நல்ல நாள்.',
+        'செலவுகளைக் கட்டுப்படுத்துங்கள்; வருமானம் தாமதமாகலாம்.',
+        'சந்திரன் {house:ord} வீட்டில் இருக்கும்போது கடன் கொடுப்பதையும் '
+            'பெரிய கொள்முதலையும் தவிர்க்கவும்.',
+      ),
+      'health': _byQuality(
+        'ஆற்றல் நன்றாக உள்ளது; வழக்கத்தைத் தொடருங்கள்.',
+        'ஓய்வெடுத்து ஆற்றலைச் சமநிலையில் வைத்திருங்கள்.',
+        'ஆற்றல் குறையலாம்; எளிய உணவு உண்ணுங்கள்.',
+      ),
+      'love': _byQuality(
+        'உறவுகள் அன்பாகவும் ஆதரவாகவும் இருக்கும்.',
+        'வெளிப்படையான பேச்சால் சிறு தவறான புரிதல்கள் தீரும்.',
+        'அன்புக்குரியவர்களிடம் பொறுமையாக இருங்கள்.',
+      ),
+      'dasha': const [
+        TemplateRule('{mahadasha} மகா தசையில் {antardasha} புக்தி '
+            'நடக்கிறது; அதன் தாக்கம் இன்றைய முடிவுகளில் இருக்கும்.'),
+      ],
+      'notification_title': _byName(
+          '🌟 {name} அவர்களுக்கான இன்றைய பலன்', '🌟 உங்கள் இன்றைய பலன்'),
+      'notification_body': const [
+        TemplateRule('{outlook}\nராசி: {transitRashi}\n'
+            'நட்சத்திரம்: {nakshatra}\n\nமுழு பலனைக் காண தட்டவும்'),
+      ],
+      'week_overview': _byWeek(
+        'சாதகமான வாரம்: 7 நாட்களில் {goodDays} நாட்கள் நல்லவை.',
+        'கலவையான வாரம்: 7 நாட்களில் {goodDays} நாட்கள் நல்லவை; முக்கிய '
+            'பணிகளை அந்நாட்களில் வையுங்கள்.',
+        'சவாலான வாரம்: 7 நாட்களில் {goodDays} நாட்கள் மட்டுமே நல்லவை.',
+      ),
+      'week_day': _byDay(
+        '{weekday}: {nakshatra:loc} சந்திரன் ({tara} தாரை), {house:ord} '
+            'வீட்டில். நல்ல நாள்.',
+        '{weekday}: {nakshatra:loc} சந்திரன் ({tara} தாரை), {house:ord} '
+            'வீட்டில். கலவையான நாள்.',
+        '{weekday}: {nakshatra:loc} சந்திரன் ({tara} தாரை), {house:ord} '
+            'வீட்டில். கவனம் தேவை.',
+      ),
+    },
+  );
+}
@@ -2,12 +2,23 @@
 ///
 /// Central facade for all astrology API calls.
 /// Ensures proper UTC-local datetime conversions and no direct API calls.
+/// Converted responses are cached per request and timezone, and reused
+/// for as long as the API service returns the same cached response.
 library;
 
 import 'dart:developer' as developer;
 import 'astrology_api_service.dart';
+import 'local_time_converter.dart';
 import '../../utils/astrology/timezone_util.dart';
 
+/// A converted response and the API response it was converted from
+class _LocalResult {
+  final Map<String, dynamic> source;
+  final Map<String, dynamic> result;
+
+  const _LocalResult(this.source, this.result);
+}
+
 /// Astrology Service Bridge
 ///
 /// Single entry point for all astrology API calls.
@@ -16,6 +27,12 @@ class AstrologyServiceBridge {
   static AstrologyServiceBridge? _instance;
   final AstrologyApiService _apiService;
 
+  /// Converted results by request and timezone, most recently used last
+  final Map<String, _LocalResult> _localResults = {};
+
+  /// Converted results kept; a calendar year is the largest
+  static const int _localResultCapacity = 32;
+
   AstrologyServiceBridge._(this._apiService);
 
   /// Factory constructor
@@ -70,7 +87,13 @@ class AstrologyServiceBridge {
       );
 
       // Convert UTC timestamps in response to local
-      return _convertResponseToLocal(response, timezoneId);
+      return _local(
+        'birth|${utcBirthDateTime.toIso8601String()}|$latitude|$longitude|'
+        '$ayanamsha|$houseSystem|$timezoneId',
+        response,
+        () => LocalTimeConverter(timezoneId)
+            .convert(response, TimeFieldSchema.birthData),
+      );
     } catch (e) {
       developer.log('Error in getBirthData: $e',
           name: 'AstrologyServiceBridge');
@@ -142,8 +165,16 @@ class AstrologyServiceBridge {
 
       // Convert UTC timestamps in response to local
       // Groom birth data should use groom's timezone, bride birth data should use bride's timezone
-      return _convertCompatibilityResponseToLocal(
-          response, person1TimezoneId, person2TimezoneId);
+      return _local(
+        'compatibility|${utcPerson1BirthDateTime.toIso8601String()}|'
+        '$person1Latitude|$person1Longitude|$person1TimezoneId|'
+        '${utcPerson2BirthDateTime.toIso8601String()}|'
+        '$person2Latitude|$person2Longitude|$person2TimezoneId|'
+        '$ayanamsha|$houseSystem',
+        response,
+        () => _convertCompatibilityResponseToLocal(
+            response, person1TimezoneId, person2TimezoneId),
+      );
     } catch (e) {
       developer.log('Error in calculateCompatibility: $e',
           name: 'AstrologyServiceBridge');
@@ -205,7 +236,14 @@ class AstrologyServiceBridge {
       );
 
       // Convert UTC timestamps in response to local
-      return _convertResponseToLocal(response, targetTimezoneId);
+      return _local(
+        'predictions|$birthDateTime|$birthLatitude|$birthLongitude|'
+        '$currentLatitude|$currentLongitude|$predictionType|$targetDate|'
+        '$ayanamsha|$houseSystem|$targetTimezoneId',
+        response,
+        () => LocalTimeConverter(targetTimezoneId)
+            .convert(response, TimeFieldSchema.predictions),
+      );
     } catch (e) {
       developer.log('Error in getPredictions: $e',
           name: 'AstrologyServiceBridge');
@@ -243,7 +281,12 @@ class AstrologyServiceBridge {
       );
 
       // Convert UTC timestamps in response to local
-      return _convertResponseToLocal(response, timezoneId);
+      return _local(
+        'year|$year|$region|$latitude|$longitude|$ayanamsha|$timezoneId',
+        response,
+        () => LocalTimeConverter(timezoneId)
+            .convert(response, TimeFieldSchema.calendarYear),
+      );
     } catch (e) {
       developer.log('Error in getCalendarYear: $e',
           name: 'AstrologyServiceBridge');
@@ -283,7 +326,13 @@ class AstrologyServiceBridge {
       );
 
       // Convert UTC timestamps in response to local
-      return _convertResponseToLocal(response, timezoneId);
+      return _local(
+        'month|$year|$month|$region|$latitude|$longitude|$ayanamsha|'
+        '$timezoneId',
+        response,
+        () => LocalTimeConverter(timezoneId)
+            .convert(response, TimeFieldSchema.calendarMonth),
+      );
     } catch (e) {
       developer.log('Error in getCalendarMonth: $e',
           name: 'AstrologyServiceBridge');
@@ -296,155 +345,44 @@ class AstrologyServiceBridge {
     return TimezoneUtil.getTimezoneFromLocation(latitude, longitude);
   }
 
-  /// Convert compatibility response timestamps from UTC to local timezones
-  /// Groom birth data uses groom's timezone, bride birth data uses bride's timezone
-  Map<String, dynamic> _convertCompatibilityResponseToLocal(
+  /// Converted [response] of the request [key] (which names the
+  /// timezone), reused while the API service returns the same response
+  /// object from its cache; [convert] runs on first use and after the
+  /// API cache refetches
+  Map<String, dynamic> _local(
+    String key,
     Map<String, dynamic> response,
-    String groomTimezoneId,
-    String brideTimezoneId,
+    Map<String, dynamic> Function() convert,
   ) {
-    final converted = Map<String, dynamic>.from(response);
-
-    // Convert groom birth data to groom's timezone
-    if (converted.containsKey('groomBirthData')) {
-      final groomBirthData =
-          converted['groomBirthData'] as Map<String, dynamic>?;
-      if (groomBirthData != null) {
-        converted['groomBirthData'] =
-            _convertResponseToLocal(groomBirthData, groomTimezoneId);
-      }
-    }
-
-    // Convert bride birth data to bride's timezone
-    if (converted.containsKey('brideBirthData')) {
-      final brideBirthData =
-          converted['brideBirthData'] as Map<String, dynamic>?;
-      if (brideBirthData != null) {
-        converted['brideBirthData'] =
-            _convertResponseToLocal(brideBirthData, brideTimezoneId);
-      }
+    final cached = _localResults.remove(key);
+    if (cached != null && identical(cached.source, response)) {
+      _localResults[key] = cached; // Re-insert to keep most recent last
+      return cached.result;
     }
 
-    // Convert other timestamps (calculatedAt, etc.) to groom's timezone (default)
-    if (converted.containsKey('calculatedAt')) {
-      final utcString = converted['calculatedAt'] as String?;
-      if (utcString != null) {
-        try {
-          final utcDateTime = DateTime.parse(utcString);
-          final localDateTime =
-              TimezoneUtil.convertUTCToLocal(utcDateTime, groomTimezoneId);
-          converted['calculatedAt'] = localDateTime.toIso8601String();
-        } catch (e) {
-          developer.log('Error converting calculatedAt: $e',
-              name: 'AstrologyServiceBridge');
-        }
-      }
+    final result = convert();
+    _localResults[key] = _LocalResult(response, result);
+    while (_localResults.length > _localResultCapacity) {
+      _localResults.remove(_localResults.keys.first);
     }
-
-    return converted;
+    return result;
   }
 
-  /// Convert API response timestamps from UTC to local timezone
-  Map<String, dynamic> _convertResponseToLocal(
+  /// Convert compatibility response timestamps from UTC to local timezones
+  /// Groom birth data uses groom's timezone, bride birth data uses bride's timezone
+  Map<String, dynamic> _convertCompatibilityResponseToLocal(
     Map<String, dynamic> response,
-    String timezoneId,
+    String groomTimezoneId,
+    String brideTimezoneId,
   ) {
-    final converted = Map<String, dynamic>.from(response);
-
-    // Convert birthDateTime if present
-    if (converted.containsKey('birthDateTime')) {
-      final utcString = converted['birthDateTime'] as String;
-      try {
-        final utcDateTime = DateTime.parse(utcString);
-        final localDateTime =
-            TimezoneUtil.convertUTCToLocal(utcDateTime, timezoneId);
-        converted['birthDateTime'] = localDateTime.toIso8601String();
-      } catch (e) {
-        developer.log('Error converting birthDateTime: $e',
-            name: 'AstrologyServiceBridge');
-      }
-    }
-
-    // Convert calculatedAt if present
-    if (converted.containsKey('calculatedAt')) {
-      final utcString = converted['calculatedAt'] as String?;
-      if (utcString != null) {
-        try {
-          final utcDateTime = DateTime.parse(utcString);
-          final localDateTime =
-              TimezoneUtil.convertUTCToLocal(utcDateTime, timezoneId);
-          converted['calculatedAt'] = localDateTime.toIso8601String();
-        } catch (e) {
-          developer.log('Error converting calculatedAt: $e',
-              name: 'AstrologyServiceBridge');
-        }
-      }
-    }
-
-    // Convert calendar-specific date/time fields
-    _convertCalendarDateFields(converted, timezoneId);
-
-    // Recursively convert nested objects
-    converted.forEach((key, value) {
-      if (value is Map<String, dynamic>) {
-        converted[key] = _convertResponseToLocal(value, timezoneId);
-      } else if (value is List) {
-        converted[key] = value.map((item) {
-          if (item is Map<String, dynamic>) {
-            return _convertResponseToLocal(item, timezoneId);
-          }
-          return item;
-        }).toList();
-      }
+    final converted = LocalTimeConverter(groomTimezoneId)
+        .convert(response, TimeFieldSchema.compatibility);
+    final brideBirthData = response['brideBirthData'];
+    if (brideBirthData is! Map<String, dynamic>) return converted;
+    return Map.unmodifiable({
+      ...converted,
+      'brideBirthData': LocalTimeConverter(brideTimezoneId)
+          .convert(brideBirthData, TimeFieldSchema.birthData),
     });
-
-    return converted;
-  }
-
-  /// Convert calendar-specific date fields from UTC to local timezone
-  /// Handles: date, sunrise, sunset, moonrise, moonset, and other time fields
-  void _convertCalendarDateFields(
-      Map<String, dynamic> data, String timezoneId) {
-    // List of calendar date/time fields that need conversion
-    final dateTimeFields = [
-      'date',
-      'sunrise',
-      'sunset',
-      'moonrise',
-      'moonset',
-      'sunriseTime',
-      'sunsetTime',
-      'moonriseTime',
-      'moonsetTime',
-      'startTime',
-      'endTime',
-      'time',
-    ];
-
-    for (final field in dateTimeFields) {
-      if (data.containsKey(field)) {
-        final value = data[field];
-        if (value is String && value.isNotEmpty) {
-          try {
-            final utcDateTime = DateTime.parse(value);
-            final localDateTime =
-                TimezoneUtil.convertUTCToLocal(utcDateTime, timezoneId);
-            data[field] = localDateTime.toIso8601String();
-          } catch (e) {
-            // If parsing fails, it might not be a datetime field - skip silently
-            // (could be a date string like "2024-01-15" which doesn't need conversion)
-          }
-        } else if (value is DateTime) {
-          try {
-            final localDateTime =
-                TimezoneUtil.convertUTCToLocal(value, timezoneId);
-            data[field] = localDateTime.toIso8601String();
-          } catch (e) {
-            developer.log('Error converting $field DateTime: $e',
-                name: 'AstrologyServiceBridge');
-          }
-        }
-      }
-    }
   }
 }
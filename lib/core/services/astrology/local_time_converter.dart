@@ -0,0 +1,173 @@
+/// Local Time Converter
+///
+/// Converts the UTC instants of an API response to a timezone's local
+/// time, guided by a [TimeFieldSchema] of where each response type keeps
+/// its times. Only fields the schema names are parsed; everything else is
+/// copied as is. Results are deeply unmodifiable so they can be cached and
+/// shared between callers.
+library;
+
+import 'dart:developer' as developer;
+import '../../utils/astrology/timezone_util.dart';
+
+/// Where a response keeps its UTC instants
+class TimeFieldSchema {
+  /// Keys whose string values are UTC instants
+  final Set<String> fields;
+
+  /// Schemas of nested maps (or lists of maps) by key
+  final Map<String, TimeFieldSchema> children;
+
+  /// Schema of list elements and of map values under keys not in
+  /// [children]: the entries of `days` lists and `months` maps
+  final TimeFieldSchema? items;
+
+  /// Apply this schema at every depth, for responses whose nesting is not
+  /// pinned down
+  final bool deep;
+
+  const TimeFieldSchema({
+    this.fields = const {},
+    this.children = const {},
+    this.items,
+    this.deep = false,
+  });
+
+  static const Set<String> _calendarFields = {
+    'date',
+    'sunrise',
+    'sunset',
+    'moonrise',
+    'moonset',
+    'sunriseTime',
+    'sunsetTime',
+    'moonriseTime',
+    'moonsetTime',
+    'startTime',
+    'endTime',
+    'time',
+  };
+
+  /// `{time}`, `{startTime, endTime}` maps: sunrise, tithi, festival
+  static const TimeFieldSchema _span = TimeFieldSchema(
+    fields: {'time', 'startTime', 'endTime'},
+  );
+
+  /// One calendar day
+  static const TimeFieldSchema calendarDay = TimeFieldSchema(
+    fields: _calendarFields,
+    children: {
+      'sunrise': _span,
+      'sunset': _span,
+      'moonrise': _span,
+      'moonset': _span,
+      'tithi': _span,
+      'nakshatra': _span,
+      'yoga': _span,
+      'karana': _span,
+      'festivals': TimeFieldSchema(items: _span),
+    },
+  );
+
+  static const TimeFieldSchema calendarMonth = TimeFieldSchema(
+    fields: {'calculatedAt'},
+    children: {'days': TimeFieldSchema(items: calendarDay)},
+  );
+
+  static const TimeFieldSchema calendarYear = TimeFieldSchema(
+    fields: {'calculatedAt'},
+    children: {
+      'months': TimeFieldSchema(items: calendarMonth),
+      'days': TimeFieldSchema(items: calendarDay),
+    },
+  );
+
+  /// Birth data and predictions: small, so every level is searched
+  static const TimeFieldSchema birthData = TimeFieldSchema(
+    fields: {'birthDateTime', 'calculatedAt', ..._calendarFields},
+    deep: true,
+  );
+
+  static const TimeFieldSchema predictions = birthData;
+
+  /// The compatibility envelope; the bride's birth data is converted
+  /// separately, in the bride's timezone
+  static const TimeFieldSchema compatibility = TimeFieldSchema(
+    fields: {'calculatedAt'},
+    children: {'groomBirthData': birthData},
+  );
+}
+
+/// Local Time Converter
+class LocalTimeConverter {
+  final String timezoneId;
+
+  /// Converted strings of this conversion, as responses repeat instants
+  final Map<String, String> _memo = {};
+
+  LocalTimeConverter(this.timezoneId);
+
+  /// Unmodifiable copy of [response] with [schema]'s instants in local time
+  Map<String, dynamic> convert(
+      Map<String, dynamic> response, TimeFieldSchema schema) {
+    return _map(response, schema);
+  }
+
+  Map<String, dynamic> _map(
+      Map<dynamic, dynamic> map, TimeFieldSchema? schema) {
+    final out = <String, dynamic>{};
+    map.forEach((key, value) {
+      final name = '$key';
+      if (schema != null && schema.fields.contains(name)) {
+        final local = _instant(name, value);
+        if (local != null) {
+          out[name] = local;
+          return;
+        }
+      }
+      final child = schema == null
+          ? null
+          : schema.deep
+              ? schema
+              : schema.children[name] ?? schema.items;
+      out[name] = _value(value, child);
+    });
+    return Map.unmodifiable(out);
+  }
+
+  dynamic _value(dynamic value, TimeFieldSchema? schema) {
+    if (value is Map) return _map(value, schema);
+    if (value is List) {
+      final items = schema == null || schema.deep ? schema : schema.items;
+      return List<dynamic>.unmodifiable(
+          value.map((item) => _value(item, items)));
+    }
+    return value;
+  }
+
+  /// Local ISO string of a UTC instant [value], or null when it is not one
+  /// (date-only strings, clock times, other types)
+  String? _instant(String field, dynamic value) {
+    if (value is DateTime) return _local(field, value);
+    // A calendar date carries no instant; converting it would shift the
+    // day west of UTC
+    if (value is! String || value.length <= 10) return null;
+    final memo = _memo[value];
+    if (memo != null) return memo;
+    final parsed = DateTime.tryParse(value);
+    if (parsed == null) return null;
+    final local = _local(field, parsed);
+    if (local != null) _memo[value] = local;
+    return local;
+  }
+
+  String? _local(String field, DateTime utc) {
+    try {
+      return TimezoneUtil.convertUTCToLocal(utc, timezoneId).toIso8601String();
+    } catch (e) {
+      developer.log('Error converting $field: $e',
+          name: 'LocalTimeConverter');
+      return null;
+    }
+  }
+}
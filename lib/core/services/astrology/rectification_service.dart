@@ -0,0 +1,98 @@
+/// Rectification Service
+///
+/// Runs a [RectificationSweep] for a guessed local birth time. The window is
+/// cut into more ranges than workers and each worker takes the next range
+/// from a shared queue when it finishes one, so a slow range never leaves
+/// the other workers idle. Ranges run on background isolates ([compute];
+/// inline on the web).
+library;
+
+import 'package:flutter/foundation.dart';
+import '../../features/astrology/engine/rectification.dart';
+import '../../logging/logging_helper.dart';
+import '../../utils/astrology/timezone_util.dart';
+
+/// A candidate birth time in the birth place's local time
+class RectifiedBirthTime {
+  final RectificationCandidate candidate;
+  final DateTime localStart;
+  final DateTime localEnd;
+
+  const RectifiedBirthTime(this.candidate, this.localStart, this.localEnd);
+
+  /// The middle of the run, the time to suggest
+  DateTime get local =>
+      localStart.add(localEnd.difference(localStart) ~/ 2);
+}
+
+RectificationChunk _evaluate((RectificationSweep, int, int) range) =>
+    range.$1.evaluate(range.$2, range.$3);
+
+/// Rectification Service
+class RectificationService {
+  static RectificationService? _instance;
+
+  static RectificationService get instance {
+    _instance ??= RectificationService._();
+    return _instance!;
+  }
+
+  RectificationService._();
+
+  static const int _workers = 4;
+  static const int _ranges = 16;
+
+  /// Candidates within ±[radius] of the local birth time [guess], best
+  /// first
+  Future<List<RectifiedBirthTime>> rectify({
+    required DateTime guess,
+    required double latitude,
+    required double longitude,
+    required String ayanamsha,
+    required List<LifeEvent> events,
+    Duration radius = const Duration(hours: 2),
+    int stepSeconds = 10,
+  }) async {
+    final stopwatch = Stopwatch()..start();
+    await TimezoneUtil.initialize();
+    final timezoneId =
+        TimezoneUtil.getTimezoneFromLocation(latitude, longitude);
+    final sweep = RectificationSweep.around(
+      guessUtc: TimezoneUtil.convertLocalToUTC(guess, timezoneId),
+      latitude: latitude,
+      longitude: longitude,
+      ayanamsha: ayanamsha,
+      events: events,
+      radius: radius,
+      stepSeconds: stepSeconds,
+    );
+
+    final bounds = [
+      for (var r = 0; r <= _ranges; r++) sweep.instants * r ~/ _ranges,
+    ];
+    final chunks = <RectificationChunk>[];
+    var next = 0;
+    Future<void> worker() async {
+      while (next < _ranges) {
+        final r = next++;
+        chunks.add(await compute(_evaluate, (sweep, bounds[r], bounds[r + 1])));
+      }
+    }
+
+    await Future.wait([for (var w = 0; w < _workers; w++) worker()]);
+    final candidates = sweep.candidates(chunks);
+    LoggingHelper.logInfo(
+        '${sweep.instants} instants, ${candidates.length} candidates in '
+        '${stopwatch.elapsedMilliseconds} ms',
+        source: 'RectificationService');
+
+    return [
+      for (final candidate in candidates)
+        RectifiedBirthTime(
+          candidate,
+          TimezoneUtil.convertUTCToLocal(candidate.startUtc, timezoneId),
+          TimezoneUtil.convertUTCToLocal(candidate.endUtc, timezoneId),
+        ),
+    ];
+  }
+}
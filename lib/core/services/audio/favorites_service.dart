@@ -6,39 +6,63 @@ library;
 import 'dart:async';
 import 'dart:convert';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
-import 'package:shared_preferences/shared_preferences.dart';
 import '../../../core/logging/logging_helper.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
 
 /// Favorites Service - Manages favorites with persistence
+///
+/// One KV entry per favorite track, so a toggle writes a single record.
 class FavoritesService extends StateNotifier<Set<String>> {
   static const String _favoritesKey = 'audio_favorites';
 
+  Future<KvTable<bool>>? _table;
+
   FavoritesService() : super({}) {
     _loadFavorites();
   }
 
+  Future<KvTable<bool>> _favorites() => _table ??= _openTable();
+
+  Future<KvTable<bool>> _openTable() async {
+    final store = await AppKvStore.open();
+    final table = store.table(_favoritesKey, KvCodec.boolean);
+    await AppKvStore.migrateFromPreferences(
+      store,
+      marker: _favoritesKey,
+      keys: const [_favoritesKey],
+      fill: (batch, prefs) {
+        final favoritesJson = prefs.getString(_favoritesKey);
+        if (favoritesJson == null) return;
+        final List<dynamic> decoded = jsonDecode(favoritesJson);
+        for (final id in decoded) {
+          batch.put(table, id as String, true);
+        }
+      },
+    );
+    return table;
+  }
+
   /// Load favorites from storage
   Future<void> _loadFavorites() async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      final favoritesJson = prefs.getString(_favoritesKey);
-      
-      if (favoritesJson != null) {
-        final List<dynamic> decoded = jsonDecode(favoritesJson);
-        state = decoded.map((id) => id as String).toSet();
-      }
+      final table = await _favorites();
+      state = table.keys.toSet();
     } catch (e) {
+      _table = null;
       LoggingHelper.logError('Failed to load favorites', source: 'FavoritesService', error: e);
-      state = {};
     }
   }
 
-  /// Save favorites to storage
-  Future<void> _saveFavorites() async {
+  /// Persist one favorite change
+  Future<void> _saveFavorite(String trackId, bool isFavorite) async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      final favoritesJson = jsonEncode(state.toList());
-      await prefs.setString(_favoritesKey, favoritesJson);
+      final table = await _favorites();
+      if (isFavorite) {
+        await table.put(trackId, true);
+      } else {
+        await table.delete(trackId);
+      }
     } catch (e) {
       LoggingHelper.logError('Failed to save favorites', source: 'FavoritesService', error: e);
     }
@@ -52,13 +76,12 @@ class FavoritesService extends StateNotifier<Set<String>> {
   /// Toggle favorite
   Future<void> toggleFavorite(String trackId) async {
     final newState = Set<String>.from(state);
-    if (newState.contains(trackId)) {
-      newState.remove(trackId);
-    } else {
+    final isFavorite = !newState.remove(trackId);
+    if (isFavorite) {
       newState.add(trackId);
     }
     state = newState;
-    await _saveFavorites();
+    await _saveFavorite(trackId, isFavorite);
   }
 
   /// Add to favorites
@@ -66,7 +89,7 @@ class FavoritesService extends StateNotifier<Set<String>> {
     if (!state.contains(trackId)) {
       final newState = Set<String>.from(state)..add(trackId);
       state = newState;
-      await _saveFavorites();
+      await _saveFavorite(trackId, true);
     }
   }
 
@@ -75,7 +98,7 @@ class FavoritesService extends StateNotifier<Set<String>> {
     if (state.contains(trackId)) {
       final newState = Set<String>.from(state)..remove(trackId);
       state = newState;
-      await _saveFavorites();
+      await _saveFavorite(trackId, false);
     }
   }
 
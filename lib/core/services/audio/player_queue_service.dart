@@ -7,11 +7,13 @@ import 'dart:async';
 import 'dart:convert';
 import 'dart:math';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
-import 'package:shared_preferences/shared_preferences.dart';
 import 'models/track.dart';
 import 'models/queue_state.dart';
 import 'global_audio_player_controller.dart';
 import '../../../core/logging/logging_helper.dart';
+import '../startup/startup_snapshot_service.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
 
 /// Player Queue Service - Manages queue state and operations
 class PlayerQueueService extends StateNotifier<QueueState> {
@@ -19,42 +21,97 @@ class PlayerQueueService extends StateNotifier<QueueState> {
   List<Track> _originalQueue = []; // Original queue order (for shuffle)
   List<int>? _shuffledIndices; // Shuffled index mapping
   
-  // Storage keys
+  // Legacy preference keys (migrated to the KV store)
   static const String _queueKey = 'audio_queue';
   static const String _queueIndexKey = 'audio_queue_index';
   static const String _shuffleKey = 'audio_queue_shuffle';
   static const String _repeatKey = 'audio_queue_repeat';
 
-  PlayerQueueService() : super(const QueueState(queue: [], currentIndex: 0)) {
+  // KV tables: index/shuffle/repeat, and one track per queue position
+  static const String _stateTable = 'audio_queue_state';
+  static const String _tracksTable = 'audio_queue_tracks';
+
+  KvTable<int>? _queueState;
+  KvTable<Map<String, dynamic>>? _queueTracks;
+
+  /// Encoded tracks as last persisted, per position (for diffing saves)
+  List<String> _persistedTracks = [];
+
+  PlayerQueueService() : super(_initialState()) {
+    // Keep the startup snapshot's mini-player track and queue head current
+    addListener(StartupSnapshotService.instance.recordPlayback,
+        fireImmediately: false);
     _loadPersistedState();
   }
+
+  /// Queue head from the startup snapshot, replaced once the full persisted
+  /// queue has loaded
+  static QueueState _initialState() {
+    final playback = StartupSnapshotService.instance.snapshot.playback;
+    if (playback == null || playback.queueHead.isEmpty) {
+      return const QueueState(queue: [], currentIndex: 0);
+    }
+    return QueueState(queue: playback.queueHead, currentIndex: 0);
+  }
   
+  /// Zero-padded so keys sort in queue order
+  static String _positionKey(int position) =>
+      position.toString().padLeft(6, '0');
+
+  Future<void> _openTables() async {
+    if (_queueTracks != null) return;
+    final store = await AppKvStore.open();
+    final queueState = store.table(_stateTable, KvCodec.int64);
+    final queueTracks = store.table(_tracksTable, KvCodec.json);
+    await AppKvStore.migrateFromPreferences(
+      store,
+      marker: _tracksTable,
+      keys: const [_queueKey, _queueIndexKey, _shuffleKey, _repeatKey],
+      fill: (batch, prefs) {
+        final queueJson = prefs.getString(_queueKey);
+        if (queueJson == null || queueJson.isEmpty) return;
+        final queueList = jsonDecode(queueJson) as List<dynamic>;
+        for (var i = 0; i < queueList.length; i++) {
+          batch.put(queueTracks, _positionKey(i),
+              queueList[i] as Map<String, dynamic>);
+        }
+        batch
+          ..put(queueState, 'index', prefs.getInt(_queueIndexKey) ?? 0)
+          ..put(queueState, 'shuffle',
+              (prefs.getBool(_shuffleKey) ?? false) ? 1 : 0)
+          ..put(queueState, 'repeat', prefs.getInt(_repeatKey) ?? 0);
+      },
+    );
+    _queueState = queueState;
+    _queueTracks = queueTracks;
+  }
+
   /// Load persisted queue state
   Future<void> _loadPersistedState() async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      final queueJson = prefs.getString(_queueKey);
-      final queueIndex = prefs.getInt(_queueIndexKey) ?? 0;
-      final shuffleEnabled = prefs.getBool(_shuffleKey) ?? false;
-      final repeatModeIndex = prefs.getInt(_repeatKey) ?? 0;
+      await _openTables();
+      final queueState = _queueState!;
+      final queueIndex = queueState.get('index') ?? 0;
+      final shuffleEnabled = (queueState.get('shuffle') ?? 0) != 0;
+      final repeatModeIndex = queueState.get('repeat') ?? 0;
       final repeatMode = RepeatMode.values[repeatModeIndex.clamp(0, RepeatMode.values.length - 1)];
       
-      if (queueJson != null && queueJson.isNotEmpty) {
-        final queueList = jsonDecode(queueJson) as List<dynamic>;
-        final tracks = queueList.map((json) => Track.fromJson(json as Map<String, dynamic>)).toList();
+      final tracks = [
+        for (final entry in _queueTracks!.scan()) Track.fromJson(entry.value),
+      ];
+      _persistedTracks = [for (final t in tracks) jsonEncode(t.toJson())];
         
-        if (tracks.isNotEmpty) {
-          _originalQueue = List.from(tracks);
-          _shuffledIndices = shuffleEnabled ? _generateShuffledIndices(tracks.length) : null;
-          
-          state = QueueState(
-            queue: tracks,
-            currentIndex: queueIndex.clamp(0, tracks.length - 1),
-            shuffleEnabled: shuffleEnabled,
-            repeatMode: repeatMode,
-            shuffledIndices: _shuffledIndices,
-          );
-        }
+      if (tracks.isNotEmpty) {
+        _originalQueue = List.from(tracks);
+        _shuffledIndices = shuffleEnabled ? _generateShuffledIndices(tracks.length) : null;
+        
+        state = QueueState(
+          queue: tracks,
+          currentIndex: queueIndex.clamp(0, tracks.length - 1),
+          shuffleEnabled: shuffleEnabled,
+          repeatMode: repeatMode,
+          shuffledIndices: _shuffledIndices,
+        );
       }
     } catch (e) {
       LoggingHelper.logError('Failed to load persisted queue state', source: 'PlayerQueueService', error: e);
@@ -62,28 +119,50 @@ class PlayerQueueService extends StateNotifier<QueueState> {
   }
   
   /// Save queue state to persistence
+  ///
+  /// Only queue positions whose track changed are rewritten; the whole
+  /// update is one atomic batch.
   Future<void> _savePersistedState() async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      
-      if (state.queue.isNotEmpty) {
-        final queueJson = jsonEncode(state.queue.map((t) => t.toJson()).toList());
-        await prefs.setString(_queueKey, queueJson);
-        await prefs.setInt(_queueIndexKey, state.currentIndex);
-        await prefs.setBool(_shuffleKey, state.shuffleEnabled);
-        await prefs.setInt(_repeatKey, state.repeatMode.index);
-      } else {
-        // Clear persisted state if queue is empty
-        await prefs.remove(_queueKey);
-        await prefs.remove(_queueIndexKey);
-        await prefs.remove(_shuffleKey);
-        await prefs.remove(_repeatKey);
-      }
+      await _openTables();
+      final queueState = _queueState!;
+      final queueTracks = _queueTracks!;
+      final encoded = [for (final t in state.queue) jsonEncode(t.toJson())];
+      final previous = _persistedTracks;
+
+      final written = queueState.store.write((batch) {
+        for (var i = 0; i < encoded.length; i++) {
+          if (i >= previous.length || previous[i] != encoded[i]) {
+            batch.put(queueTracks, _positionKey(i), state.queue[i].toJson());
+          }
+        }
+        for (var i = encoded.length; i < previous.length; i++) {
+          batch.delete(queueTracks, _positionKey(i));
+        }
+
+        if (state.queue.isNotEmpty) {
+          _putIfChanged(batch, 'index', state.currentIndex);
+          _putIfChanged(batch, 'shuffle', state.shuffleEnabled ? 1 : 0);
+          _putIfChanged(batch, 'repeat', state.repeatMode.index);
+        } else {
+          // Clear persisted state if queue is empty
+          batch.clear(queueState);
+        }
+      });
+      // The batch is already applied in memory; later diffs build on it
+      _persistedTracks = encoded;
+      await written;
     } catch (e) {
       LoggingHelper.logError('Failed to save persisted queue state', source: 'PlayerQueueService', error: e);
     }
   }
 
+  void _putIfChanged(KvBatch batch, String key, int value) {
+    if (_queueState!.get(key) != value) {
+      batch.put(_queueState!, key, value);
+    }
+  }
+
   /// Get current track
   Track? get currentTrack => state.currentTrack;
 
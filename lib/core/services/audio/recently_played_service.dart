@@ -6,42 +6,57 @@ library;
 import 'dart:async';
 import 'dart:convert';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
-import 'package:shared_preferences/shared_preferences.dart';
 import '../../../core/logging/logging_helper.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
 
 /// Recently Played Service - Tracks recently played with persistence
+///
+/// Stored as track id -> last played time (ms), so playing a track writes one
+/// record instead of the whole list.
 class RecentlyPlayedService extends StateNotifier<List<String>> {
   static const String _recentlyPlayedKey = 'audio_recently_played';
   static const int _maxRecentTracks = 50; // Keep last 50 tracks
 
+  Future<KvTable<int>>? _table;
+
   RecentlyPlayedService() : super([]) {
     _loadRecentlyPlayed();
   }
 
-  /// Load recently played from storage
-  Future<void> _loadRecentlyPlayed() async {
-    try {
-      final prefs = await SharedPreferences.getInstance();
-      final recentlyPlayedJson = prefs.getString(_recentlyPlayedKey);
-      
-      if (recentlyPlayedJson != null) {
+  Future<KvTable<int>> _recentlyPlayed() => _table ??= _openTable();
+
+  Future<KvTable<int>> _openTable() async {
+    final store = await AppKvStore.open();
+    final table = store.table(_recentlyPlayedKey, KvCodec.int64);
+    await AppKvStore.migrateFromPreferences(
+      store,
+      marker: _recentlyPlayedKey,
+      keys: const [_recentlyPlayedKey],
+      fill: (batch, prefs) {
+        final recentlyPlayedJson = prefs.getString(_recentlyPlayedKey);
+        if (recentlyPlayedJson == null) return;
         final List<dynamic> decoded = jsonDecode(recentlyPlayedJson);
-        state = decoded.map((id) => id as String).toList();
-      }
-    } catch (e) {
-      LoggingHelper.logError('Failed to load recently played', source: 'RecentlyPlayedService', error: e);
-      state = [];
-    }
+        // Newest first; synthesize descending timestamps to keep the order
+        final now = DateTime.now().millisecondsSinceEpoch;
+        for (var i = 0; i < decoded.length; i++) {
+          batch.put(table, decoded[i] as String, now - i);
+        }
+      },
+    );
+    return table;
   }
 
-  /// Save recently played to storage
-  Future<void> _saveRecentlyPlayed() async {
+  /// Load recently played from storage
+  Future<void> _loadRecentlyPlayed() async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      final recentlyPlayedJson = jsonEncode(state);
-      await prefs.setString(_recentlyPlayedKey, recentlyPlayedJson);
+      final table = await _recentlyPlayed();
+      final entries = table.scan().toList()
+        ..sort((a, b) => b.value.compareTo(a.value));
+      state = [for (final entry in entries) entry.key];
     } catch (e) {
-      LoggingHelper.logError('Failed to save recently played', source: 'RecentlyPlayedService', error: e);
+      _table = null;
+      LoggingHelper.logError('Failed to load recently played', source: 'RecentlyPlayedService', error: e);
     }
   }
 
@@ -56,12 +71,25 @@ class RecentlyPlayedService extends StateNotifier<List<String>> {
     newState.insert(0, trackId);
     
     // Keep only max tracks
+    final evicted = <String>[];
     if (newState.length > _maxRecentTracks) {
+      evicted.addAll(newState.sublist(_maxRecentTracks));
       newState.removeRange(_maxRecentTracks, newState.length);
     }
     
     state = newState;
-    await _saveRecentlyPlayed();
+
+    try {
+      final table = await _recentlyPlayed();
+      await table.store.write((batch) {
+        batch.put(table, trackId, DateTime.now().millisecondsSinceEpoch);
+        for (final id in evicted) {
+          batch.delete(table, id);
+        }
+      });
+    } catch (e) {
+      LoggingHelper.logError('Failed to save recently played', source: 'RecentlyPlayedService', error: e);
+    }
   }
 
   /// Get recently played tracks
@@ -70,7 +98,12 @@ class RecentlyPlayedService extends StateNotifier<List<String>> {
   /// Clear recently played
   Future<void> clear() async {
     state = [];
-    await _saveRecentlyPlayed();
+    try {
+      final table = await _recentlyPlayed();
+      await table.clear();
+    } catch (e) {
+      LoggingHelper.logError('Failed to clear recently played', source: 'RecentlyPlayedService', error: e);
+    }
   }
 
   /// Recently played stream
@@ -0,0 +1,146 @@
+/// Book Block Store Mobile Implementation
+///
+/// Uses dart:io for ranged book downloads and on-disk page blocks
+library;
+
+import 'dart:io'
+    show
+        Directory,
+        File,
+        FileMode,
+        HttpClient,
+        HttpClientResponse,
+        HttpHeaders,
+        HttpStatus;
+import 'package:path_provider/path_provider.dart';
+
+/// Root directory for locally stored books
+Future<String> getBookStoreRoot() async {
+  final supportDir = await getApplicationSupportDirectory();
+  final root = Directory('${supportDir.path}/books');
+  if (!await root.exists()) {
+    await root.create(recursive: true);
+  }
+  return root.path;
+}
+
+/// Ensure a directory exists
+Future<void> ensureBookDirectory(String path) async {
+  final dir = Directory(path);
+  if (!await dir.exists()) {
+    await dir.create(recursive: true);
+  }
+}
+
+/// Read a file as bytes, returns null if it doesn't exist
+Future<List<int>?> readBookFile(String path) async {
+  final file = File(path);
+  if (!await file.exists()) {
+    return null;
+  }
+  return file.readAsBytes();
+}
+
+/// Write bytes to a file atomically (write to temp, then rename)
+Future<void> writeBookFile(String path, List<int> bytes) async {
+  final temp = File('$path.tmp');
+  await temp.writeAsBytes(bytes, flush: true);
+  await temp.rename(path);
+}
+
+/// Get file length, 0 if the file doesn't exist
+Future<int> bookFileLength(String path) async {
+  final file = File(path);
+  if (!await file.exists()) {
+    return 0;
+  }
+  return file.length();
+}
+
+/// Delete a file or directory if it exists
+Future<void> deleteBookPath(String path) async {
+  final file = File(path);
+  if (await file.exists()) {
+    await file.delete();
+    return;
+  }
+  final dir = Directory(path);
+  if (await dir.exists()) {
+    await dir.delete(recursive: true);
+  }
+}
+
+/// Download bytes [start, end] of [url] and append them to [path]
+///
+/// Requests the raw (still compressed) representation so byte offsets stay
+/// stable across requests. Returns the total size of the remote file.
+/// If the server ignores the Range header, or answers it without the total
+/// size (`Content-Range: bytes a-b/*`), the whole file is written instead
+/// and its length is returned.
+Future<int> fetchBookRange(String url, String path, int start, int end) async {
+  final client = HttpClient();
+
+  try {
+    client.autoUncompress = false; // Byte ranges refer to the stored object
+
+    final file = File(path);
+    final response = await _getBook(client, url, 'bytes=$start-$end');
+
+    if (response.statusCode == HttpStatus.partialContent) {
+      // Content-Range: bytes start-end/total
+      final contentRange =
+          response.headers.value(HttpHeaders.contentRangeHeader);
+      final total = int.tryParse(contentRange?.split('/').last ?? '');
+      if (total != null) {
+        await _writeBody(response, file, FileMode.append);
+        return total;
+      }
+      // Without the total the download could never tell it is complete
+      await response.drain<void>();
+      final full = await _getBook(client, url, null);
+      if (full.statusCode == HttpStatus.ok) {
+        await _writeBody(full, file, FileMode.write);
+        return file.length();
+      }
+      await full.drain<void>();
+      throw Exception('API error: ${full.statusCode}');
+    }
+
+    if (response.statusCode == HttpStatus.ok) {
+      // Range not supported - store the full body in one go
+      await _writeBody(response, file, FileMode.write);
+      return file.length();
+    }
+
+    await response.drain<void>();
+    throw Exception('API error: ${response.statusCode}');
+  } finally {
+    client.close();
+  }
+}
+
+/// GET [url], for the byte [range] if given
+Future<HttpClientResponse> _getBook(
+    HttpClient client, String url, String? range) async {
+  final request = await client.getUrl(Uri.parse(url));
+  request.headers.set('Accept', 'application/json');
+  request.headers.set('Accept-Encoding', 'gzip');
+  if (range != null) request.headers.set(HttpHeaders.rangeHeader, range);
+
+  return request.close().timeout(
+    const Duration(seconds: 30),
+    onTimeout: () {
+      throw Exception('API request timeout');
+    },
+  );
+}
+
+Future<void> _writeBody(
+    HttpClientResponse response, File file, FileMode mode) async {
+  final sink = file.openWrite(mode: mode);
+  try {
+    await sink.addStream(response);
+  } finally {
+    await sink.close();
+  }
+}
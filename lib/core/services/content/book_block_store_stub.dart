@@ -0,0 +1,39 @@
+/// Book Block Store Stub
+///
+/// Stub implementation for web platform
+library;
+
+/// Root directory stub
+Future<String> getBookStoreRoot() {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Directory stub
+Future<void> ensureBookDirectory(String path) {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Read stub
+Future<List<int>?> readBookFile(String path) {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Write stub
+Future<void> writeBookFile(String path, List<int> bytes) {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Length stub
+Future<int> bookFileLength(String path) {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Delete stub
+Future<void> deleteBookPath(String path) {
+  throw UnsupportedError('This should not be called on web');
+}
+
+/// Range download stub
+Future<int> fetchBookRange(String url, String path, int start, int end) {
+  throw UnsupportedError('This should not be called on web');
+}
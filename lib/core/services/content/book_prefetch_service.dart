@@ -0,0 +1,569 @@
+/// Book Prefetch Service
+///
+/// Tracks reading position and velocity per book and keeps books available
+/// locally as compressed page blocks, so a book opens at the saved page
+/// without waiting for the whole file.
+library;
+
+import 'dart:async';
+import 'dart:convert';
+import 'package:archive/archive.dart';
+import 'package:connectivity_plus/connectivity_plus.dart';
+import 'package:flutter/foundation.dart' show kIsWeb;
+import 'package:shared_preferences/shared_preferences.dart';
+import '../../../core/logging/logging_helper.dart';
+import '../network/network_connectivity_service.dart';
+// Conditional import for file access (mobile only)
+import 'book_block_store_stub.dart'
+    if (dart.library.io) 'book_block_store_mobile.dart';
+
+/// Reading progress for a single book
+class BookReadingProgress {
+  final String bookUrl;
+  final int pageIndex;
+  final int totalPages;
+
+  /// Smoothed reading velocity in pages per minute
+  final double pagesPerMinute;
+  final DateTime updatedAt;
+
+  const BookReadingProgress({
+    required this.bookUrl,
+    required this.pageIndex,
+    required this.totalPages,
+    required this.pagesPerMinute,
+    required this.updatedAt,
+  });
+
+  BookReadingProgress copyWith({
+    int? pageIndex,
+    int? totalPages,
+    double? pagesPerMinute,
+    DateTime? updatedAt,
+  }) {
+    return BookReadingProgress(
+      bookUrl: bookUrl,
+      pageIndex: pageIndex ?? this.pageIndex,
+      totalPages: totalPages ?? this.totalPages,
+      pagesPerMinute: pagesPerMinute ?? this.pagesPerMinute,
+      updatedAt: updatedAt ?? this.updatedAt,
+    );
+  }
+
+  Map<String, dynamic> toJson() => {
+        'bookUrl': bookUrl,
+        'pageIndex': pageIndex,
+        'totalPages': totalPages,
+        'pagesPerMinute': pagesPerMinute,
+        'updatedAt': updatedAt.toIso8601String(),
+      };
+
+  factory BookReadingProgress.fromJson(Map<String, dynamic> json) {
+    return BookReadingProgress(
+      bookUrl: json['bookUrl'] as String,
+      pageIndex: json['pageIndex'] as int? ?? 0,
+      totalPages: json['totalPages'] as int? ?? 0,
+      pagesPerMinute: (json['pagesPerMinute'] as num?)?.toDouble() ?? 0.0,
+      updatedAt: DateTime.tryParse(json['updatedAt'] as String? ?? '') ??
+          DateTime.now(),
+    );
+  }
+}
+
+/// Locally stored book header (everything except page content)
+class LocalBookMeta {
+  final String title;
+  final String author;
+  final String language;
+  final int totalPages;
+  final int blockCount;
+
+  const LocalBookMeta({
+    required this.title,
+    required this.author,
+    required this.language,
+    required this.totalPages,
+    required this.blockCount,
+  });
+
+  Map<String, dynamic> toJson() => {
+        'title': title,
+        'author': author,
+        'language': language,
+        'totalPages': totalPages,
+        'blockCount': blockCount,
+      };
+
+  factory LocalBookMeta.fromJson(Map<String, dynamic> json) {
+    return LocalBookMeta(
+      title: json['title'] as String? ?? 'Untitled',
+      author: json['author'] as String? ?? 'Unknown Author',
+      language: json['language'] as String? ?? 'en',
+      totalPages: json['totalPages'] as int? ?? 0,
+      blockCount: json['blockCount'] as int? ?? 0,
+    );
+  }
+}
+
+/// Book Prefetch Service
+///
+/// - Records page turns and keeps an exponentially smoothed reading velocity
+/// - Stores downloaded books as gzip-compressed blocks of [pagesPerBlock] pages
+/// - Loads blocks ahead of the reader based on velocity
+/// - Downloads in-progress books in the background with HTTP range requests,
+///   one small chunk at a time, and pauses on metered (cellular) connections
+class BookPrefetchService {
+  static BookPrefetchService? _instance;
+  static BookPrefetchService get instance {
+    _instance ??= BookPrefetchService._();
+    return _instance!;
+  }
+
+  BookPrefetchService._();
+
+  static const String _progressKey = 'book_reading_progress';
+
+  /// Pages stored per compressed block
+  static const int pagesPerBlock = 16;
+
+  /// Size of each background range request
+  static const int rangeChunkBytes = 256 * 1024;
+
+  /// Pause between range requests so foreground traffic wins
+  static const Duration chunkSpacing = Duration(milliseconds: 400);
+
+  /// Longest a download waits for an unmetered connection before giving
+  /// up until the next [resumePendingDownloads]
+  static const Duration maxMeteredWait = Duration(hours: 1);
+
+  /// How many minutes of reading to keep loaded ahead of the reader
+  static const double lookaheadMinutes = 10;
+  static const int maxLookaheadBlocks = 8;
+
+  /// Page turns further apart than this are treated as a reading break
+  static const Duration _maxTurnInterval = Duration(minutes: 10);
+  static const double _velocitySmoothing = 0.3;
+
+  final Map<String, BookReadingProgress> _progress = {};
+  final Map<String, DateTime> _lastTurnAt = {};
+  final Map<String, Map<int, List<Map<String, dynamic>>>> _loadedBlocks = {};
+  final Map<String, Future<List<Map<String, dynamic>>?>> _pendingBlocks = {};
+
+  /// Background downloads in progress; completing a book's completer
+  /// cancels its download
+  final Map<String, Completer<void>> _activeDownloads = {};
+  bool _progressLoaded = false;
+  Timer? _saveTimer;
+
+  /// Whether on-device block storage is available on this platform
+  bool get isSupported => !kIsWeb;
+
+  // ---------------------------------------------------------------------------
+  // Reading position and velocity
+  // ---------------------------------------------------------------------------
+
+  Future<void> _ensureProgressLoaded() async {
+    if (_progressLoaded) return;
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      final progressJson = prefs.getString(_progressKey);
+      if (progressJson != null) {
+        final decoded = jsonDecode(progressJson) as Map<String, dynamic>;
+        for (final entry in decoded.entries) {
+          _progress[entry.key] = BookReadingProgress.fromJson(
+              entry.value as Map<String, dynamic>);
+        }
+      }
+    } catch (e) {
+      LoggingHelper.logError('Failed to load reading progress',
+          source: 'BookPrefetchService', error: e);
+    }
+    _progressLoaded = true;
+  }
+
+  void _scheduleSave() {
+    _saveTimer?.cancel();
+    _saveTimer = Timer(const Duration(seconds: 2), _saveProgress);
+  }
+
+  Future<void> _saveProgress() async {
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      final encoded = jsonEncode(
+          _progress.map((key, value) => MapEntry(key, value.toJson())));
+      await prefs.setString(_progressKey, encoded);
+    } catch (e) {
+      LoggingHelper.logError('Failed to save reading progress',
+          source: 'BookPrefetchService', error: e);
+    }
+  }
+
+  /// Get saved progress for a book
+  Future<BookReadingProgress?> getProgress(String bookUrl) async {
+    await _ensureProgressLoaded();
+    return _progress[bookUrl];
+  }
+
+  /// Record that the reader is now on [pageIndex]
+  ///
+  /// Updates the smoothed velocity that [prefetchAhead] sizes its window by.
+  Future<void> recordPageTurn(
+    String bookUrl,
+    int pageIndex,
+    int totalPages,
+  ) async {
+    await _ensureProgressLoaded();
+
+    final now = DateTime.now();
+    final previous = _progress[bookUrl];
+    final lastTurn = _lastTurnAt[bookUrl];
+    var velocity = previous?.pagesPerMinute ?? 0.0;
+
+    if (previous != null && lastTurn != null) {
+      final elapsed = now.difference(lastTurn);
+      final pagesMoved = pageIndex - previous.pageIndex;
+      // Only forward reading within a session says anything about velocity
+      if (pagesMoved > 0 &&
+          elapsed > Duration.zero &&
+          elapsed < _maxTurnInterval) {
+        final sample = pagesMoved / (elapsed.inMilliseconds / 60000.0);
+        velocity = velocity == 0
+            ? sample
+            : velocity + _velocitySmoothing * (sample - velocity);
+      }
+    }
+
+    _lastTurnAt[bookUrl] = now;
+    _progress[bookUrl] = BookReadingProgress(
+      bookUrl: bookUrl,
+      pageIndex: pageIndex,
+      totalPages: totalPages,
+      pagesPerMinute: velocity,
+      updatedAt: now,
+    );
+    _scheduleSave();
+  }
+
+  /// Number of blocks to keep loaded ahead of [progress]
+  int lookaheadBlocks(BookReadingProgress? progress) {
+    final velocity = progress?.pagesPerMinute ?? 0.0;
+    final pagesAhead = velocity * lookaheadMinutes;
+    final blocks = (pagesAhead / pagesPerBlock).ceil();
+    return blocks.clamp(1, maxLookaheadBlocks);
+  }
+
+  // ---------------------------------------------------------------------------
+  // Local page blocks
+  // ---------------------------------------------------------------------------
+
+  /// Stable directory name for a book URL (FNV-1a hash)
+  String _bookKey(String bookUrl) {
+    var hash = 0x811c9dc5;
+    for (final unit in bookUrl.codeUnits) {
+      hash ^= unit;
+      hash = (hash * 0x01000193) & 0xffffffff;
+    }
+    return hash.toRadixString(16).padLeft(8, '0');
+  }
+
+  Future<String> _bookDir(String bookUrl) async {
+    final root = await getBookStoreRoot();
+    return '$root/${_bookKey(bookUrl)}';
+  }
+
+  String _blockPath(String dir, int blockIndex) =>
+      '$dir/block_$blockIndex.json.gz';
+
+  /// Block index that contains [pageIndex]
+  static int blockForPage(int pageIndex) => pageIndex ~/ pagesPerBlock;
+
+  /// Load the header of a locally stored book, or null if not stored
+  Future<LocalBookMeta?> loadMeta(String bookUrl) async {
+    if (!isSupported) return null;
+    try {
+      final dir = await _bookDir(bookUrl);
+      final bytes = await readBookFile('$dir/meta.json');
+      if (bytes == null) return null;
+      return LocalBookMeta.fromJson(
+          jsonDecode(utf8.decode(bytes)) as Map<String, dynamic>);
+    } catch (e) {
+      LoggingHelper.logError('Failed to read local book meta',
+          source: 'BookPrefetchService', error: e);
+      return null;
+    }
+  }
+
+  /// Load one block of pages (decompressed), cached in memory per book
+  Future<List<Map<String, dynamic>>?> loadBlock(
+    String bookUrl,
+    int blockIndex,
+  ) {
+    final cached = _loadedBlocks[bookUrl]?[blockIndex];
+    if (cached != null) return Future.value(cached);
+
+    final pendingKey = '$bookUrl#$blockIndex';
+    return _pendingBlocks.putIfAbsent(pendingKey, () async {
+      try {
+        final dir = await _bookDir(bookUrl);
+        final bytes = await readBookFile(_blockPath(dir, blockIndex));
+        if (bytes == null) return null;
+        final decoded =
+            jsonDecode(utf8.decode(GZipDecoder().decodeBytes(bytes)))
+                as List<dynamic>;
+        final pages = decoded.cast<Map<String, dynamic>>();
+        _loadedBlocks.putIfAbsent(bookUrl, () => {})[blockIndex] = pages;
+        return pages;
+      } catch (e) {
+        LoggingHelper.logError('Failed to read page block $blockIndex',
+            source: 'BookPrefetchService', error: e);
+        return null;
+      } finally {
+        _pendingBlocks.remove(pendingKey);
+      }
+    });
+  }
+
+  /// Load the blocks the reader will reach soon from [pageIndex]: its own,
+  /// [lookaheadBlocks] ahead and the one behind, nearest first
+  ///
+  /// Returns the loaded blocks by index; empty if the book isn't stored.
+  Future<Map<int, List<Map<String, dynamic>>>> prefetchAhead(
+    String bookUrl,
+    int pageIndex,
+  ) async {
+    final meta = await loadMeta(bookUrl);
+    if (meta == null) return const {};
+
+    final progress = _progress[bookUrl];
+    final firstBlock = blockForPage(pageIndex);
+    final lastBlock = (firstBlock + lookaheadBlocks(progress))
+        .clamp(0, meta.blockCount - 1);
+
+    final loaded = <int, List<Map<String, dynamic>>>{};
+    for (final block in [
+      for (var b = firstBlock; b <= lastBlock; b++) b,
+      if (firstBlock > 0) firstBlock - 1,
+    ]) {
+      final pages = await loadBlock(bookUrl, block);
+      if (pages != null) loaded[block] = pages;
+    }
+
+    // Drop blocks the reader has left well behind
+    _loadedBlocks[bookUrl]?.removeWhere((block, _) => block < firstBlock - 1);
+    return loaded;
+  }
+
+  /// Store a fully decoded book as compressed page blocks
+  ///
+  /// [pages] are normalized page maps ({pageNumber, content, title}).
+  /// The meta file is written last so a partially written book is never read.
+  Future<void> storeBook(
+    String bookUrl, {
+    required String title,
+    required String author,
+    required String language,
+    required List<Map<String, dynamic>> pages,
+  }) async {
+    if (!isSupported || pages.isEmpty) return;
+    // The whole book is here; a background download of it is redundant
+    cancelPrefetch(bookUrl);
+    try {
+      final dir = await _bookDir(bookUrl);
+      await ensureBookDirectory(dir);
+
+      final encoder = GZipEncoder();
+      final blockCount = (pages.length / pagesPerBlock).ceil();
+      for (var block = 0; block < blockCount; block++) {
+        final start = block * pagesPerBlock;
+        final end = (start + pagesPerBlock).clamp(0, pages.length);
+        final bytes = encoder
+            .encode(utf8.encode(jsonEncode(pages.sublist(start, end))));
+        if (bytes != null) {
+          await writeBookFile(_blockPath(dir, block), bytes);
+        }
+      }
+
+      final meta = LocalBookMeta(
+        title: title,
+        author: author,
+        language: language,
+        totalPages: pages.length,
+        blockCount: blockCount,
+      );
+      await writeBookFile(
+          '$dir/meta.json', utf8.encode(jsonEncode(meta.toJson())));
+      await deleteBookPath('$dir/download.part');
+
+      LoggingHelper.logInfo(
+        'Stored book locally: ${pages.length} pages in $blockCount blocks',
+        source: 'BookPrefetchService',
+      );
+    } catch (e) {
+      LoggingHelper.logError('Failed to store book locally',
+          source: 'BookPrefetchService', error: e);
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Background range download
+  // ---------------------------------------------------------------------------
+
+  /// Cellular connections are treated as metered
+  Future<bool> _isMetered() async {
+    try {
+      final results = await Connectivity().checkConnectivity();
+      if (results.contains(ConnectivityResult.wifi) ||
+          results.contains(ConnectivityResult.ethernet)) {
+        return false;
+      }
+      return true;
+    } catch (e) {
+      return true;
+    }
+  }
+
+  /// Wait until an unmetered connection is available
+  ///
+  /// False when [cancelled] completes or [maxMeteredWait] passes first. The
+  /// connection is checked again after subscribing, so a change between
+  /// the caller's check and the subscription isn't missed.
+  Future<bool> _waitForUnmetered(Future<void> cancelled) async {
+    final unmetered = Completer<bool>();
+    final subscription =
+        NetworkConnectivityService.instance.onConnectivityChanged.listen(
+      (results) {
+        if ((results.contains(ConnectivityResult.wifi) ||
+                results.contains(ConnectivityResult.ethernet)) &&
+            !unmetered.isCompleted) {
+          unmetered.complete(true);
+        }
+      },
+    );
+    try {
+      if (!await _isMetered()) return true;
+      return await Future.any([
+        unmetered.future,
+        cancelled.then((_) => false),
+      ]).timeout(maxMeteredWait, onTimeout: () => false);
+    } finally {
+      await subscription.cancel();
+    }
+  }
+
+  /// Stop the background download of [bookUrl], if one is running; the
+  /// partial file is kept for the next attempt
+  void cancelPrefetch(String bookUrl) {
+    final cancel = _activeDownloads[bookUrl];
+    if (cancel != null && !cancel.isCompleted) cancel.complete();
+  }
+
+  /// Download books the user has started but which aren't stored locally
+  Future<void> resumePendingDownloads() async {
+    if (!isSupported) return;
+    await _ensureProgressLoaded();
+
+    final inProgress = _progress.values.toList()
+      ..sort((a, b) => b.updatedAt.compareTo(a.updatedAt));
+    for (final progress in inProgress) {
+      if (progress.totalPages > 0 &&
+          progress.pageIndex >= progress.totalPages - 1) {
+        continue; // Finished books don't need to be kept ready
+      }
+      unawaited(prefetchBook(progress.bookUrl));
+    }
+  }
+
+  /// Download a book in the background with range requests
+  ///
+  /// Resumes from any partial download left by a previous session. Pauses
+  /// while the connection is metered.
+  Future<void> prefetchBook(String bookUrl) async {
+    if (!isSupported || _activeDownloads.containsKey(bookUrl)) return;
+    if (await loadMeta(bookUrl) != null) return; // Already local
+
+    final cancel = Completer<void>();
+    _activeDownloads[bookUrl] = cancel;
+    try {
+      final dir = await _bookDir(bookUrl);
+      await ensureBookDirectory(dir);
+      final partPath = '$dir/download.part';
+
+      var received = await bookFileLength(partPath);
+      var total = -1;
+
+      while (total < 0 || received < total) {
+        if (cancel.isCompleted) return;
+        if (await _isMetered()) {
+          LoggingHelper.logInfo('Book prefetch paused on metered connection',
+              source: 'BookPrefetchService');
+          if (!await _waitForUnmetered(cancel.future)) return;
+        }
+
+        total = await fetchBookRange(
+          bookUrl,
+          partPath,
+          received,
+          received + rangeChunkBytes - 1,
+        );
+        received = await bookFileLength(partPath);
+
+        await Future.delayed(chunkSpacing);
+      }
+
+      final bytes = await readBookFile(partPath);
+      if (bytes == null || bytes.isEmpty) return;
+
+      final isCompressed =
+          bytes.length >= 2 && bytes[0] == 0x1f && bytes[1] == 0x8b;
+      final jsonString =
+          utf8.decode(isCompressed ? GZipDecoder().decodeBytes(bytes) : bytes);
+      final json = jsonDecode(jsonString) as Map<String, dynamic>;
+
+      await storeBook(
+        bookUrl,
+        title: json['title'] as String? ?? 'Untitled',
+        author: json['author'] as String? ?? 'Unknown Author',
+        language: json['language'] as String? ?? 'en',
+        pages: normalizePages(json),
+      );
+    } catch (e) {
+      LoggingHelper.logError('Background book download failed',
+          source: 'BookPrefetchService', error: e);
+    } finally {
+      _activeDownloads.remove(bookUrl);
+    }
+  }
+
+  /// Normalize a book JSON ('pages' or legacy 'chapters') into page maps
+  static List<Map<String, dynamic>> normalizePages(Map<String, dynamic> json) {
+    final pages = <Map<String, dynamic>>[];
+    final rawPages = json['pages'];
+    if (rawPages is List) {
+      for (final page in rawPages) {
+        if (page is Map<String, dynamic>) {
+          pages.add({
+            'pageNumber': page['pageNumber'] as int? ?? pages.length + 1,
+            'content': page['content'] as String? ?? '',
+            'title': page['title'] as String?,
+          });
+        }
+      }
+      return pages;
+    }
+
+    final chapters = json['chapters'];
+    if (chapters is List) {
+      for (final chapter in chapters) {
+        if (chapter is! Map<String, dynamic>) continue;
+        final content = chapter['content'] as String? ?? '';
+        if (content.isEmpty) continue;
+        pages.add({
+          'pageNumber': pages.length + 1,
+          'content': content,
+          'title': chapter['title'] as String?,
+        });
+      }
+    }
+    return pages;
+  }
+}
@@ -66,6 +66,21 @@ class LanguageService extends Notifier<LanguagePreferences> {
   static const String _headerLanguageKey = 'header_language';
   static const String _contentLanguageKey = 'content_language';
 
+  /// Stored content language, for code running outside the widget tree
+  /// (background tasks)
+  static Future<SupportedLanguage> loadContentLanguage() async {
+    try {
+      final prefs = await SharedPreferences.getInstance();
+      final index = prefs.getInt(_contentLanguageKey);
+      if (index != null && index < SupportedLanguage.values.length) {
+        return SupportedLanguage.values[index];
+      }
+    } catch (e) {
+      // Fall back to English
+    }
+    return SupportedLanguage.english;
+  }
+
   @override
   LanguagePreferences build() {
     _loadPreferences();
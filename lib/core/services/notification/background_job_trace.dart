@@ -0,0 +1,85 @@
+/// Background Job Trace
+///
+/// Per-phase timing for background jobs that run under an OS CPU budget.
+/// Synchronous phases are pure CPU and summed as compute time; the process
+/// CPU time (user + system, from the kernel where available) is compared
+/// against the budget when the job finishes.
+library;
+
+import '../../logging/logging_helper.dart';
+
+import 'process_cpu_time_stub.dart'
+    if (dart.library.io) 'process_cpu_time_mobile.dart';
+
+/// Background Job Trace
+class BackgroundJobTrace {
+  final String name;
+
+  /// CPU the whole job may use
+  final Duration budget;
+
+  final Stopwatch _wall = Stopwatch()..start();
+  final Duration? _cpuAtStart = readProcessCpuTime();
+  final Map<String, Duration> _phases = {};
+  Duration _compute = Duration.zero;
+
+  BackgroundJobTrace(this.name, {required this.budget});
+
+  /// Wall time of each phase so far, in order
+  Map<String, Duration> get phases => Map.unmodifiable(_phases);
+
+  /// Time spent in synchronous (pure CPU) phases
+  Duration get computeTime => _compute;
+
+  /// Run a synchronous phase; all of its time is CPU
+  T compute<T>(String phase, T Function() body) {
+    final stopwatch = Stopwatch()..start();
+    try {
+      return body();
+    } finally {
+      _compute += stopwatch.elapsed;
+      _record(phase, stopwatch.elapsed);
+    }
+  }
+
+  /// Run an asynchronous phase (storage, plugins, network)
+  Future<T> phase<T>(String phase, Future<T> Function() body) async {
+    final stopwatch = Stopwatch()..start();
+    try {
+      return await body();
+    } finally {
+      _record(phase, stopwatch.elapsed);
+    }
+  }
+
+  void _record(String phase, Duration elapsed) {
+    _phases[phase] = (_phases[phase] ?? Duration.zero) + elapsed;
+  }
+
+  /// Log the breakdown; returns the process CPU used, or null if unknown
+  Duration? finish() {
+    _wall.stop();
+    final cpuAtEnd = readProcessCpuTime();
+    final cpu = _cpuAtStart != null && cpuAtEnd != null
+        ? cpuAtEnd - _cpuAtStart
+        : null;
+
+    final breakdown = _phases.entries
+        .map((e) => '${e.key} ${e.value.inMicroseconds / 1000}ms')
+        .join(', ');
+    final summary = '$name: cpu ${cpu?.inMilliseconds ?? '?'}ms '
+        '(compute ${_compute.inMicroseconds / 1000}ms), '
+        'wall ${_wall.elapsedMilliseconds}ms, '
+        'budget ${budget.inMilliseconds}ms [$breakdown]';
+
+    // Without kernel accounting the synchronous phases are the lower bound
+    final used = cpu ?? _compute;
+    if (used > budget) {
+      LoggingHelper.logWarning('Over CPU budget - $summary',
+          source: 'BackgroundJobTrace');
+    } else {
+      LoggingHelper.logInfo(summary, source: 'BackgroundJobTrace');
+    }
+    return cpu;
+  }
+}
@@ -89,9 +89,14 @@ class DailyPredictionNotificationService {
   }
 
   /// Show daily prediction notification
+  ///
+  /// [title] and [body], when given, are already rendered (and localized)
+  /// and replace the English summary built from [predictions].
   Future<void> showDailyPredictionNotification({
     required Map<String, dynamic> predictions,
     String? userName,
+    String? title,
+    String? body,
   }) async {
     try {
       if (!_isInitialized || _notifications == null) {
@@ -124,16 +129,18 @@ class DailyPredictionNotificationService {
       nakshatra ??= predictions['nakshatra'] as String? ?? '';
 
       // Create notification title
-      final title = userName != null
-          ? '🌟 Daily Prediction for $userName'
-          : '🌟 Your Daily Prediction';
+      final notificationTitle = title ??
+          (userName != null
+              ? '🌟 Daily Prediction for $userName'
+              : '🌟 Your Daily Prediction');
 
       // Create notification body with summary
-      final body = _createNotificationBody(
-        generalOutlook: generalOutlook,
-        rashi: rashi,
-        nakshatra: nakshatra,
-      );
+      final notificationBody = body ??
+          _createNotificationBody(
+            generalOutlook: generalOutlook,
+            rashi: rashi,
+            nakshatra: nakshatra,
+          );
 
       // Get themed colors from design tokens
       final primaryColor = isDarkMode
@@ -154,8 +161,8 @@ class DailyPredictionNotificationService {
         color: primaryColor,
         colorized: true,
         styleInformation: BigTextStyleInformation(
-          body,
-          contentTitle: title,
+          notificationBody,
+          contentTitle: notificationTitle,
           summaryText: 'Tap to view full prediction',
         ),
       );
@@ -177,8 +184,8 @@ class DailyPredictionNotificationService {
       // Show notification with deep link to predictions screen
       await _notifications!.show(
         1001, // Unique notification ID for daily predictions
-        title,
-        body,
+        notificationTitle,
+        notificationBody,
         details,
         payload: 'predictions', // Deep link payload
       );
@@ -7,14 +7,21 @@ library;
 import 'dart:async';
 import 'package:flutter/foundation.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
-import 'package:shared_preferences/shared_preferences.dart';
 import 'package:connectivity_plus/connectivity_plus.dart';
 import 'package:workmanager/workmanager.dart';
 import '../../../core/utils/either.dart';
 import '../../../core/services/user/user_storage_service.dart';
-import '../../../core/services/astrology/astrology_service_bridge.dart';
+import '../../models/user/user_model.dart';
+import 'background_job_trace.dart';
 import 'daily_prediction_notification_service.dart';
 import '../../../core/services/shared/cache_service.dart';
+import '../../features/predictions/local/local_prediction_engine.dart';
+import '../../features/predictions/text/prediction_text_engine.dart';
+import '../language/language_service.dart';
+import '../predictions/local_prediction_service.dart';
+import '../predictions/prediction_batch_service.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
 
 /// Daily prediction scheduler service
 class DailyPredictionScheduler {
@@ -27,8 +34,12 @@ class DailyPredictionScheduler {
   DailyPredictionScheduler._();
 
   static const String _lastFetchDateKey = 'daily_prediction_last_fetch_date';
+  static const String _schedulerTable = 'daily_prediction_scheduler';
   static const String _backgroundTaskName = 'dailyPredictionTask';
 
+  /// CPU the morning background job may use
+  static const Duration cpuBudget = Duration(milliseconds: 200);
+
   Connectivity? _connectivity;
   StreamSubscription<List<ConnectivityResult>>? _connectivitySubscription;
   bool _isInitialized = false;
@@ -73,9 +84,7 @@ class DailyPredictionScheduler {
         _backgroundTaskName,
         frequency: const Duration(hours: 24),
         initialDelay: _getInitialDelay(),
-        constraints: Constraints(
-          networkType: NetworkType.connected,
-        ),
+        // No network constraint: the notification is served offline
       );
 
       debugPrint('Daily prediction task scheduled at 5:30 AM');
@@ -140,10 +149,19 @@ class DailyPredictionScheduler {
 
   /// Fetch and notify daily prediction
   /// Public method for background tasks
+  ///
+  /// Texts are rendered by the on-device engine in the content language, so
+  /// the notification never waits on the network; today's stored batch
+  /// entry, when an earlier online run left one, adds the server's lucky
+  /// numbers, timings and remedies to the payload. That path is traced
+  /// against [cpuBudget]. The prediction batch is topped up afterwards when
+  /// online.
   Future<void> fetchAndNotifyDailyPrediction() async {
+    final trace = BackgroundJobTrace('daily_prediction', budget: cpuBudget);
+    UserModel? user;
     try {
       // Check if already fetched today
-      final lastFetchDate = await _getLastFetchDate();
+      final lastFetchDate = await trace.phase('state', _getLastFetchDate);
       final today = DateTime.now();
       final todayDate = DateTime(today.year, today.month, today.day);
 
@@ -164,12 +182,14 @@ class DailyPredictionScheduler {
       }
 
       // Get user data from storage (for background tasks)
-      final userStorageService = UserStorageService.instance;
-      await userStorageService.initialize();
-      final userResult = await userStorageService.getCurrentUser();
-      final user = ResultHelper.isSuccess(userResult)
-          ? ResultHelper.getValue(userResult)
-          : null;
+      user = await trace.phase('user', () async {
+        final userStorageService = UserStorageService.instance;
+        await userStorageService.initialize();
+        final userResult = await userStorageService.getCurrentUser();
+        return ResultHelper.isSuccess(userResult)
+            ? ResultHelper.getValue(userResult)
+            : null;
+      });
 
       if (user == null) {
         debugPrint('No user data available for daily prediction');
@@ -179,47 +199,96 @@ class DailyPredictionScheduler {
         return;
       }
 
-      // Fetch daily prediction
-      final bridge = AstrologyServiceBridge.instance;
-      final timezoneId = AstrologyServiceBridge.getTimezoneFromLocation(
-        user.latitude,
-        user.longitude,
-      );
-
-      final predictions = await bridge.getPredictions(
-        localBirthDateTime: user.localBirthDateTime,
-        birthTimezoneId: timezoneId,
-        birthLatitude: user.latitude,
-        birthLongitude: user.longitude,
-        localTargetDateTime: DateTime.now(),
-        targetTimezoneId: timezoneId,
-        currentLatitude: user.latitude,
-        currentLongitude: user.longitude,
-        predictionType: 'daily',
-        ayanamsha: user.ayanamsha,
-      );
+      final profile = user;
+      final language = await trace.phase(
+          'language', LanguageService.loadContentLanguage);
+
+      // Server entry from an earlier online run, for the fields the device
+      // doesn't compute
+      final stored = await trace.phase(
+          'batch',
+          () => PredictionBatchService.instance
+              .cached(profile, PredictionKind.daily, today));
+
+      // Rendered on the device from today's transit, in the user's language
+      final local = LocalPredictionService.instance;
+      final natal = await trace.phase('natal', () => local.natal(profile));
+      final (predictions, title, body) = trace.compute('engine', () {
+        final facts = local.facts(natal, today);
+        facts[PredictionFact.named] = 1;
+        final text = PredictionTextEngine.instance;
+        final payload = LocalPredictionEngine.payload(facts, language.name);
+        return (
+          <String, dynamic>{...?stored, ...payload},
+          text.render(language.name, 'notification_title', facts,
+              {'name': profile.name}),
+          text.render(language.name, 'notification_body', facts,
+              {'outlook': payload['generalOutlook'] as String}),
+        );
+      });
 
       // Show notification
-      await DailyPredictionNotificationService.instance
-          .showDailyPredictionNotification(
-        predictions: predictions,
-        userName: user.name,
-      );
+      await trace.phase(
+          'notify',
+          () => DailyPredictionNotificationService.instance
+                  .showDailyPredictionNotification(
+                predictions: predictions,
+                userName: profile.name,
+                title: title,
+                body: body,
+              ));
 
       // Save fetch date
-      await _saveLastFetchDate(todayDate);
-
-      debugPrint('Daily prediction fetched and notification shown');
+      await trace.phase('state', () => _saveLastFetchDate(todayDate));
+      debugPrint('Daily prediction notification shown');
     } catch (e) {
       debugPrint('Error fetching daily prediction: $e');
+      user = null;
+    } finally {
+      trace.finish();
     }
+
+    if (user != null) await _topUpBatch(user);
+  }
+
+  /// Refresh the week of stored predictions when online; outside the
+  /// budgeted path since it is bound by the network, not the CPU
+  Future<void> _topUpBatch(UserModel user) async {
+    try {
+      final connectivity = await Connectivity().checkConnectivity();
+      if (connectivity.any((result) => result != ConnectivityResult.none)) {
+        await PredictionBatchService.instance.precompute(user);
+      }
+    } catch (e) {
+      debugPrint('Error refreshing prediction batch: $e');
+    }
+  }
+
+  Future<KvTable<int>> _schedulerState() async {
+    final store = await AppKvStore.open();
+    final table = store.table(_schedulerTable, KvCodec.int64);
+    await AppKvStore.migrateFromPreferences(
+      store,
+      marker: _schedulerTable,
+      keys: const [_lastFetchDateKey],
+      fill: (batch, prefs) {
+        final timestamp = prefs.getInt(_lastFetchDateKey);
+        if (timestamp != null) {
+          batch.put(table, _lastFetchDateKey, timestamp);
+        }
+      },
+    );
+    return table;
   }
 
   /// Get last fetch date
   Future<DateTime?> _getLastFetchDate() async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      final timestamp = prefs.getInt(_lastFetchDateKey);
+      final table = await _schedulerState();
+      // The app and the background task each hold the store open; pick up
+      // whatever the other one wrote
+      await table.store.refresh();
+      final timestamp = table.get(_lastFetchDateKey);
       if (timestamp != null) {
         return DateTime.fromMillisecondsSinceEpoch(timestamp);
       }
@@ -233,8 +302,8 @@ class DailyPredictionScheduler {
   /// Save last fetch date
   Future<void> _saveLastFetchDate(DateTime date) async {
     try {
-      final prefs = await SharedPreferences.getInstance();
-      await prefs.setInt(_lastFetchDateKey, date.millisecondsSinceEpoch);
+      final table = await _schedulerState();
+      await table.put(_lastFetchDateKey, date.millisecondsSinceEpoch);
     } catch (e) {
       debugPrint('Error saving last fetch date: $e');
     }
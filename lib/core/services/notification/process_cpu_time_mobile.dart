@@ -0,0 +1,23 @@
+/// Process CPU Time Mobile Implementation
+///
+/// Reads user + system CPU time of this process from `/proc/self/stat`
+/// (Android and Linux); other platforms report null.
+library;
+
+import 'dart:io' show File;
+
+/// Kernel clock ticks per second (USER_HZ), fixed at 100 on Android/Linux
+const int _clockTicksPerSecond = 100;
+
+/// CPU time used by the process so far, null where unavailable
+Duration? readProcessCpuTime() {
+  try {
+    final stat = File('/proc/self/stat').readAsStringSync();
+    // Fields after the parenthesised command name start at field 3 (state)
+    final fields = stat.substring(stat.lastIndexOf(')') + 2).split(' ');
+    final ticks = int.parse(fields[11]) + int.parse(fields[12]); // utime+stime
+    return Duration(microseconds: ticks * 1000000 ~/ _clockTicksPerSecond);
+  } catch (_) {
+    return null;
+  }
+}
@@ -0,0 +1,7 @@
+/// Process CPU Time Stub
+///
+/// Stub implementation for web platform (no process CPU accounting)
+library;
+
+/// CPU time stub
+Duration? readProcessCpuTime() => null;
@@ -0,0 +1,188 @@
+/// Local Prediction Service
+///
+/// Runs [LocalPredictionEngine] for the current profile. The birth instant
+/// in UTC and the natal chart are stored per profile, so later runs (the
+/// morning background job in particular) skip the timezone database. A
+/// stored chart is used only when its engine version and content
+/// fingerprint still match.
+library;
+
+import '../../features/astrology/engine/fingerprint.dart';
+import '../../features/astrology/engine/gochara.dart';
+import '../../features/astrology/engine/natal_chart.dart';
+import '../../features/astrology/engine/planetary_ephemeris.dart';
+import '../../features/predictions/local/local_prediction_engine.dart';
+import '../../features/predictions/text/prediction_text_engine.dart';
+import '../../models/user/user_model.dart';
+import '../../utils/astrology/timezone_util.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
+import 'prediction_batch_service.dart';
+
+/// Natal inputs of the local engine
+class LocalNatal {
+  final DateTime birthUtc;
+  final NatalChart chart;
+  final String ayanamsha;
+
+  /// The chart's moon, for the daily engine
+  final MoonPosition moon;
+
+  LocalNatal(this.birthUtc, this.chart, this.ayanamsha)
+      : moon = MoonPosition(chart.longitude(Graha.moon));
+}
+
+/// Local Prediction Service
+class LocalPredictionService {
+  static LocalPredictionService? _instance;
+
+  static LocalPredictionService get instance {
+    _instance ??= LocalPredictionService._();
+    return _instance!;
+  }
+
+  LocalPredictionService._();
+
+  static const String _tableName = 'prediction_local';
+
+  Future<KvTable<Map<String, dynamic>>>? _table;
+
+  Future<KvTable<Map<String, dynamic>>> _natalTable() =>
+      _table ??= AppKvStore.open().then(
+          (store) => store.table(_tableName, KvCodec.json));
+
+  String? _natalKey;
+  LocalNatal? _natal;
+
+  /// Natal inputs for [user], computed once per profile
+  Future<LocalNatal> natal(UserModel user) async {
+    final key = PredictionBatchService.profileKey(user);
+    final cached = _natal;
+    if (cached != null && _natalKey == key) return cached;
+
+    final table = await _natalTable();
+    final stored = table.get(key);
+    // Entries of an older chart layout or engine version are recomputed
+    final storedChart = stored?['chart'];
+    final fingerprint = stored?['fingerprint'] as String?;
+    if (stored != null &&
+        storedChart is List &&
+        storedChart.length == NatalChart.serializedLength &&
+        EngineFingerprint.isCurrent(fingerprint)) {
+      final chart = NatalChart.fromList(storedChart);
+      if (chart.fingerprint == fingerprint) {
+        return _remember(
+          key,
+          LocalNatal(
+            DateTime.fromMicrosecondsSinceEpoch(stored['birthUtc'] as int,
+                isUtc: true),
+            chart,
+            user.ayanamsha,
+          ),
+        );
+      }
+    }
+
+    await TimezoneUtil.initialize();
+    final timezoneId =
+        TimezoneUtil.getTimezoneFromLocation(user.latitude, user.longitude);
+    final birthUtc =
+        TimezoneUtil.convertLocalToUTC(user.localBirthDateTime, timezoneId);
+    final chart = NatalChart.compute(
+      birthUtc: birthUtc,
+      latitude: user.latitude,
+      longitude: user.longitude,
+      ayanamsha: user.ayanamsha,
+    );
+
+    // One profile at a time; entries of an edited profile are replaced
+    await table.store.write((batch) {
+      for (final old in table.keys) {
+        batch.delete(table, old);
+      }
+      batch.put(table, key, {
+        'birthUtc': birthUtc.microsecondsSinceEpoch,
+        'chart': chart.toList(),
+        'fingerprint': chart.fingerprint,
+      });
+    });
+    return _remember(key, LocalNatal(birthUtc, chart, user.ayanamsha));
+  }
+
+  LocalNatal _remember(String key, LocalNatal natal) {
+    _natalKey = key;
+    _natal = natal;
+    return natal;
+  }
+
+  /// Transit facts for [date] at 6 AM device time, the reference time of
+  /// the server batch; pure computation
+  PredictionFacts facts(LocalNatal natal, DateTime date) {
+    return LocalPredictionEngine.facts(
+      natal: natal.moon,
+      birthUtc: natal.birthUtc,
+      targetUtc: DateTime(date.year, date.month, date.day, 6).toUtc(),
+      ayanamsha: natal.ayanamsha,
+    );
+  }
+
+  /// Transit facts for each hour of [date] in device time, for hourly
+  /// predictions; the moon comes from the day's interpolated ephemeris
+  List<PredictionFacts> hourly(LocalNatal natal, DateTime date) => [
+        for (var hour = 0; hour < 24; hour++)
+          now(natal, DateTime(date.year, date.month, date.day, hour)),
+      ];
+
+  /// Transit facts at [instant], for live views refreshed within a day
+  PredictionFacts now(LocalNatal natal, DateTime instant) {
+    final targetUtc = instant.toUtc();
+    return LocalPredictionEngine.facts(
+      natal: natal.moon,
+      birthUtc: natal.birthUtc,
+      targetUtc: targetUtc,
+      ayanamsha: natal.ayanamsha,
+      transit: MoonPosition.cached(targetUtc, natal.ayanamsha),
+    );
+  }
+
+  /// Daily payload for [date] with texts in [language]
+  Map<String, dynamic> daily(
+    LocalNatal natal,
+    DateTime date, {
+    String language = PredictionTextEngine.fallbackLanguage,
+  }) =>
+      LocalPredictionEngine.payload(facts(natal, date), language);
+
+  /// Facts for the seven days from [start], with the week's good-day count
+  List<PredictionFacts> week(LocalNatal natal, DateTime start) {
+    final days = [
+      for (var i = 0; i < 7; i++)
+        facts(natal, DateTime(start.year, start.month, start.day + i)),
+    ];
+    final good = days
+        .where((day) =>
+            day[PredictionFact.dayQuality] == TransitQuality.good.index)
+        .length;
+    for (final day in days) {
+      day[PredictionFact.goodDays] = good;
+    }
+    return days;
+  }
+
+  final Map<int, GocharaMatrix> _years = {};
+  NatalChart? _yearsChart;
+
+  /// Transit matrix of a calendar [year] for the heatmap, kept for the
+  /// session; a year is a few milliseconds of computation
+  GocharaMatrix year(LocalNatal natal, int year) {
+    if (!identical(_yearsChart, natal.chart)) {
+      _years.clear();
+      _yearsChart = natal.chart;
+    }
+    return _years[year] ??= Gochara.year(natal.chart, year, natal.ayanamsha);
+  }
+
+  /// Birth data payload (moon rashi/nakshatra/pada)
+  Map<String, dynamic> birthData(LocalNatal natal) =>
+      {...natal.moon.toMap(), 'source': 'local'};
+}
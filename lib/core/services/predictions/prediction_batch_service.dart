@@ -0,0 +1,347 @@
+/// Prediction Batch Service
+///
+/// Precomputes the next days of daily, weekly and dasha predictions in one
+/// pass and keeps them in the KV store, so notifications and the predictions
+/// tab are served from local data for a week without connectivity.
+library;
+
+import 'dart:async';
+import 'dart:convert';
+import 'package:archive/archive.dart' show getCrc32;
+import '../../logging/logging_helper.dart';
+import '../../models/user/user_model.dart';
+import '../../utils/astrology/timezone_util.dart';
+import '../astrology/astrology_service_bridge.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
+import 'local_prediction_service.dart';
+
+/// Prediction kinds kept by the batch
+class PredictionKind {
+  static const String daily = 'daily';
+  static const String weekly = 'weekly';
+  static const String dasha = 'dasha';
+
+  /// Natal birth data (moon rashi/nakshatra), stored once per profile
+  static const String natal = 'natal';
+}
+
+/// Outcome of one batch run
+class PredictionBatchResult {
+  final int fetched;
+  final int reused;
+  final int failed;
+  final Duration elapsed;
+
+  const PredictionBatchResult({
+    required this.fetched,
+    required this.reused,
+    required this.failed,
+    required this.elapsed,
+  });
+
+  @override
+  String toString() => 'fetched $fetched, reused $reused, failed $failed '
+      'in ${elapsed.inMilliseconds}ms';
+}
+
+/// Prediction Batch Service
+class PredictionBatchService {
+  static PredictionBatchService? _instance;
+
+  static PredictionBatchService get instance {
+    _instance ??= PredictionBatchService._();
+    return _instance!;
+  }
+
+  PredictionBatchService._();
+
+  /// Days covered by a batch, starting today
+  static const int defaultDays = 7;
+
+  /// Requests in flight at once
+  static const int _concurrency = 3;
+
+  static const String _tableName = 'prediction_batch';
+
+  /// Profile keys whose entries are kept, most recent first
+  static const String _profilesKey = 'profiles';
+
+  /// Profiles whose entries survive a batch run
+  static const int _keptProfiles = 2;
+
+  Future<KvTable<Map<String, dynamic>>>? _table;
+  final Map<String, Future<Map<String, dynamic>?>> _inFlight = {};
+
+  Future<KvTable<Map<String, dynamic>>> _predictions() =>
+      _table ??= AppKvStore.open().then(
+          (store) => store.table(_tableName, KvCodec.json));
+
+  /// Identity of the inputs a prediction depends on; a profile edit starts
+  /// a fresh set of entries
+  static String profileKey(UserModel user) {
+    final inputs = [
+      user.localBirthDateTime.toIso8601String(),
+      user.latitude.toStringAsFixed(4),
+      user.longitude.toStringAsFixed(4),
+      user.ayanamsha,
+      user.houseSystem,
+    ].join('|');
+    return getCrc32(utf8.encode(inputs)).toRadixString(16).padLeft(8, '0');
+  }
+
+  static String _day(DateTime date) =>
+      '${date.year.toString().padLeft(4, '0')}-'
+      '${date.month.toString().padLeft(2, '0')}-'
+      '${date.day.toString().padLeft(2, '0')}';
+
+  /// Weekly predictions are keyed by the Monday of their week; dasha by month
+  static String _periodKey(String kind, DateTime date) {
+    switch (kind) {
+      case PredictionKind.weekly:
+        return _day(date.subtract(Duration(days: date.weekday - 1)));
+      case PredictionKind.dasha:
+        return _day(DateTime(date.year, date.month));
+      case PredictionKind.natal:
+        return '-';
+      default:
+        return _day(date);
+    }
+  }
+
+  static String _key(String profile, String kind, DateTime date) =>
+      '$profile|$kind|${_periodKey(kind, date)}';
+
+  /// Stored prediction, without touching the network
+  Future<Map<String, dynamic>?> cached(
+    UserModel user,
+    String kind,
+    DateTime date,
+  ) async {
+    final table = await _predictions();
+    final key = _key(profileKey(user), kind, date);
+    final hit = table.get(key);
+    if (hit != null) return hit;
+
+    // Another isolate (the background task) may have written it; reloads
+    // only if the store's files changed
+    await table.store.refreshIfChanged();
+    return table.get(key);
+  }
+
+  /// Stored prediction, fetched and stored first if missing
+  ///
+  /// When the fetch fails, daily and natal entries are computed on the
+  /// device instead; those are not stored, so the next online run replaces
+  /// them with the server's.
+  Future<Map<String, dynamic>> getOrFetch(
+    UserModel user,
+    String kind,
+    DateTime date,
+  ) async {
+    final stored = await cached(user, kind, date);
+    if (stored != null) return stored;
+
+    await TimezoneUtil.initialize();
+    final timezoneId = AstrologyServiceBridge.getTimezoneFromLocation(
+        user.latitude, user.longitude);
+    final fetched = await _fetchAndStore(user, kind, date, timezoneId);
+    if (fetched != null) return fetched;
+
+    final local = LocalPredictionService.instance;
+    switch (kind) {
+      case PredictionKind.daily:
+        return local.daily(await local.natal(user), date);
+      case PredictionKind.natal:
+        return local.birthData(await local.natal(user));
+      default:
+        throw StateError('No $kind prediction available for ${_day(date)}');
+    }
+  }
+
+  /// Fetch whatever is missing for the next [days] days in one pass
+  ///
+  /// Timezone setup and the timezone lookup happen once; stored entries are
+  /// reused, missing ones are fetched a few at a time. Entries for past days
+  /// and for superseded profiles are dropped. A failed request only skips
+  /// that entry.
+  Future<PredictionBatchResult> precompute(
+    UserModel user, {
+    int days = defaultDays,
+    DateTime? from,
+  }) async {
+    final stopwatch = Stopwatch()..start();
+    final table = await _predictions();
+    await table.store.refreshIfChanged();
+    await TimezoneUtil.initialize();
+    final timezoneId = AstrologyServiceBridge.getTimezoneFromLocation(
+        user.latitude, user.longitude);
+    // Natal inputs for the offline engine, while the timezone data is loaded
+    await LocalPredictionService.instance.natal(user);
+
+    final now = from ?? DateTime.now();
+    final start = DateTime(now.year, now.month, now.day);
+    final profile = profileKey(user);
+
+    // One request per distinct period across the window
+    final wanted = <String, _BatchItem>{};
+    void want(String kind, DateTime date) {
+      wanted.putIfAbsent(
+          _key(profile, kind, date), () => _BatchItem(kind, date));
+    }
+
+    want(PredictionKind.natal, start);
+    for (var i = 0; i < days; i++) {
+      final date = start.add(Duration(days: i));
+      want(PredictionKind.daily, date);
+      want(PredictionKind.weekly, date);
+      want(PredictionKind.dasha, date);
+    }
+
+    final missing = [
+      for (final entry in wanted.entries)
+        if (!table.containsKey(entry.key)) entry.value,
+    ];
+
+    var fetched = 0;
+    var failed = 0;
+    for (var i = 0; i < missing.length; i += _concurrency) {
+      final chunk = missing.skip(i).take(_concurrency);
+      final results = await Future.wait([
+        for (final item in chunk)
+          _fetchAndStore(user, item.kind, item.date, timezoneId),
+      ]);
+      for (final result in results) {
+        if (result == null) {
+          failed++;
+        } else {
+          fetched++;
+        }
+      }
+    }
+
+    await _dropBefore(table, profile, start);
+
+    final result = PredictionBatchResult(
+      fetched: fetched,
+      reused: wanted.length - missing.length,
+      failed: failed,
+      elapsed: stopwatch.elapsed,
+    );
+    LoggingHelper.logInfo('Prediction batch for $days days: $result',
+        source: 'PredictionBatchService');
+    return result;
+  }
+
+  /// Fetch one entry and store it; null on failure. Concurrent requests for
+  /// the same entry share one network call.
+  Future<Map<String, dynamic>?> _fetchAndStore(
+    UserModel user,
+    String kind,
+    DateTime date,
+    String timezoneId,
+  ) {
+    final key = _key(profileKey(user), kind, date);
+    final pending = _inFlight[key];
+    if (pending != null) return pending;
+
+    final request = () async {
+      try {
+        final bridge = AstrologyServiceBridge.instance;
+        final Map<String, dynamic> data;
+        if (kind == PredictionKind.natal) {
+          data = await bridge.getBirthData(
+            localBirthDateTime: user.localBirthDateTime,
+            timezoneId: timezoneId,
+            latitude: user.latitude,
+            longitude: user.longitude,
+            ayanamsha: user.ayanamsha,
+          );
+        } else {
+          data = await bridge.getPredictions(
+            localBirthDateTime: user.localBirthDateTime,
+            birthTimezoneId: timezoneId,
+            birthLatitude: user.latitude,
+            birthLongitude: user.longitude,
+            localTargetDateTime: DateTime(date.year, date.month, date.day, 6),
+            targetTimezoneId: timezoneId,
+            currentLatitude: user.latitude,
+            currentLongitude: user.longitude,
+            predictionType: kind,
+            ayanamsha: user.ayanamsha,
+          );
+        }
+        final table = await _predictions();
+        await table.put(key, data);
+        return data;
+      } catch (e) {
+        LoggingHelper.logWarning('Failed to fetch $kind prediction: $e',
+            source: 'PredictionBatchService');
+        return null;
+      }
+    }();
+    _inFlight[key] = request;
+    request.whenComplete(() => _inFlight.remove(key));
+    return request;
+  }
+
+  /// Remove entries for periods before [start], and every entry of profiles
+  /// older than the last [_keptProfiles]
+  ///
+  /// The app stores a single profile, so another profile key means an
+  /// earlier edit of it; the previous one is kept so that an edit which is
+  /// undone is served from the store again.
+  Future<void> _dropBefore(
+    KvTable<Map<String, dynamic>> table,
+    String profile,
+    DateTime start,
+  ) async {
+    final today = _day(start);
+    final week = _periodKey(PredictionKind.weekly, start);
+    final month = _periodKey(PredictionKind.dasha, start);
+    final known = (table.get(_profilesKey)?['keys'] as List?)?.cast<String>();
+    final kept = [
+      profile,
+      ...?known?.where((key) => key != profile),
+    ].take(_keptProfiles).toList();
+    final stale = <String>[
+      for (final key in table.keys)
+        if (key != _profilesKey &&
+            (!kept.contains(key.split('|').first) ||
+                _isStale(key, today, week, month)))
+          key,
+    ];
+    final profilesChanged =
+        known == null || known.join('|') != kept.join('|');
+    if (stale.isEmpty && !profilesChanged) return;
+    await table.store.write((batch) {
+      for (final key in stale) {
+        batch.delete(table, key);
+      }
+      if (profilesChanged) batch.put(table, _profilesKey, {'keys': kept});
+    });
+  }
+
+  static bool _isStale(String key, String today, String week, String month) {
+    final parts = key.split('|');
+    if (parts.length != 3) return true;
+    final period = parts[2];
+    switch (parts[1]) {
+      case PredictionKind.daily:
+        return period.compareTo(today) < 0;
+      case PredictionKind.weekly:
+        return period.compareTo(week) < 0;
+      case PredictionKind.dasha:
+        return period.compareTo(month) < 0;
+      default:
+        return false;
+    }
+  }
+}
+
+class _BatchItem {
+  final String kind;
+  final DateTime date;
+
+  const _BatchItem(this.kind, this.date);
+}
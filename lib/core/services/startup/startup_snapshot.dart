@@ -0,0 +1,388 @@
+/// Startup Snapshot
+///
+/// Compact binary snapshot of the last rendered app state, read at launch so
+/// the first frame can show real content before live data is loaded.
+///
+/// Layout (little endian):
+///   magic u32 | version u16 | section count u16 | written at i64 (ms)
+///   then per section: tag u8 | length u32 | payload
+/// Unknown sections are skipped, so newer sections don't break older readers.
+library;
+
+import 'dart:convert';
+import 'dart:typed_data';
+import '../../models/user/user_model.dart';
+import '../audio/models/track.dart';
+
+/// Today's panchang summary as last shown
+class PanchangSnapshot {
+  final DateTime date;
+  final String tithi;
+  final String nakshatra;
+  final String? festival;
+
+  const PanchangSnapshot({
+    required this.date,
+    required this.tithi,
+    required this.nakshatra,
+    this.festival,
+  });
+
+  bool isFor(DateTime day) =>
+      date.year == day.year && date.month == day.month && date.day == day.day;
+}
+
+/// Daily prediction headline as last shown
+class PredictionSnapshot {
+  final DateTime date;
+  final String headline;
+
+  const PredictionSnapshot({required this.date, required this.headline});
+
+  bool isFor(DateTime day) =>
+      date.year == day.year && date.month == day.month && date.day == day.day;
+}
+
+/// Mini-player track and the head of the queue
+class PlaybackSnapshot {
+  /// Queue head, starting with the current track
+  final List<Track> queueHead;
+
+  const PlaybackSnapshot({required this.queueHead});
+
+  Track? get currentTrack => queueHead.isEmpty ? null : queueHead.first;
+}
+
+/// Startup Snapshot
+class StartupSnapshot {
+  final DateTime writtenAt;
+  final UserModel? user;
+  final PanchangSnapshot? panchang;
+  final PredictionSnapshot? prediction;
+  final PlaybackSnapshot? playback;
+
+  const StartupSnapshot({
+    required this.writtenAt,
+    this.user,
+    this.panchang,
+    this.prediction,
+    this.playback,
+  });
+
+  static final StartupSnapshot empty =
+      StartupSnapshot(writtenAt: DateTime.fromMillisecondsSinceEpoch(0));
+
+  bool get isEmpty =>
+      user == null &&
+      panchang == null &&
+      prediction == null &&
+      playback == null;
+
+  StartupSnapshot copyWith({
+    UserModel? user,
+    PanchangSnapshot? panchang,
+    PredictionSnapshot? prediction,
+    PlaybackSnapshot? playback,
+    bool clearUser = false,
+    bool clearPlayback = false,
+  }) {
+    return StartupSnapshot(
+      writtenAt: writtenAt,
+      user: clearUser ? null : user ?? this.user,
+      panchang: panchang ?? this.panchang,
+      prediction: prediction ?? this.prediction,
+      playback: clearPlayback ? null : playback ?? this.playback,
+    );
+  }
+}
+
+/// Binary encoder/decoder for [StartupSnapshot]
+class StartupSnapshotCodec {
+  StartupSnapshotCodec._();
+
+  static const int magic = 0x53534B53; // 'SKSS'
+  static const int version = 1;
+
+  static const int _tagUser = 1;
+  static const int _tagPanchang = 2;
+  static const int _tagPrediction = 3;
+  static const int _tagPlayback = 4;
+
+  /// Encode a snapshot, stamping it with [writtenAt]
+  static Uint8List encode(StartupSnapshot snapshot, DateTime writtenAt) {
+    final sections = <int, Uint8List>{};
+
+    final user = snapshot.user;
+    if (user != null) {
+      sections[_tagUser] = (_Writer()
+            ..string(user.id)
+            ..string(user.name)
+            ..optString(user.username)
+            ..optString(user.email)
+            ..optString(user.phone)
+            ..date(user.dateOfBirth)
+            ..u8(user.timeOfBirth.hour)
+            ..u8(user.timeOfBirth.minute)
+            ..u8(user.timeOfBirth.second)
+            ..string(user.placeOfBirth)
+            ..f64(user.latitude)
+            ..f64(user.longitude)
+            ..string(user.sex)
+            ..optString(user.gender)
+            ..optString(user.timezone)
+            ..string(user.ayanamsha)
+            ..string(user.houseSystem)
+            ..optDateTime(user.createdAt)
+            ..optDateTime(user.updatedAt))
+          .takeBytes();
+    }
+
+    final panchang = snapshot.panchang;
+    if (panchang != null) {
+      sections[_tagPanchang] = (_Writer()
+            ..date(panchang.date)
+            ..string(panchang.tithi)
+            ..string(panchang.nakshatra)
+            ..optString(panchang.festival))
+          .takeBytes();
+    }
+
+    final prediction = snapshot.prediction;
+    if (prediction != null) {
+      sections[_tagPrediction] = (_Writer()
+            ..date(prediction.date)
+            ..string(prediction.headline))
+          .takeBytes();
+    }
+
+    final playback = snapshot.playback;
+    if (playback != null && playback.queueHead.isNotEmpty) {
+      final writer = _Writer()..u8(playback.queueHead.length);
+      for (final track in playback.queueHead) {
+        writer
+          ..string(track.id)
+          ..string(track.title)
+          ..string(track.subtitle)
+          ..string(track.album)
+          ..u32(track.duration.inMilliseconds)
+          ..string(track.coverUrl)
+          ..string(track.sourceUrl);
+      }
+      sections[_tagPlayback] = writer.takeBytes();
+    }
+
+    final out = _Writer()
+      ..u32(magic)
+      ..u16(version)
+      ..u16(sections.length)
+      ..i64(writtenAt.millisecondsSinceEpoch);
+    for (final entry in sections.entries) {
+      out
+        ..u8(entry.key)
+        ..u32(entry.value.length)
+        ..bytes(entry.value);
+    }
+    return out.takeBytes();
+  }
+
+  /// Decode a snapshot; returns null for foreign, newer or corrupt data
+  static StartupSnapshot? decode(Uint8List data) {
+    try {
+      final reader = _Reader(data);
+      if (reader.u32() != magic || reader.u16() != version) return null;
+      final sectionCount = reader.u16();
+      final writtenAt = DateTime.fromMillisecondsSinceEpoch(reader.i64());
+
+      UserModel? user;
+      PanchangSnapshot? panchang;
+      PredictionSnapshot? prediction;
+      PlaybackSnapshot? playback;
+
+      for (var i = 0; i < sectionCount; i++) {
+        final tag = reader.u8();
+        final length = reader.u32();
+        final section = _Reader(reader.view(length));
+        switch (tag) {
+          case _tagUser:
+            user = UserModel(
+              id: section.string(),
+              name: section.string(),
+              username: section.optString(),
+              email: section.optString(),
+              phone: section.optString(),
+              dateOfBirth: section.date(),
+              timeOfBirth: TimeOfBirth(
+                hour: section.u8(),
+                minute: section.u8(),
+                second: section.u8(),
+              ),
+              placeOfBirth: section.string(),
+              latitude: section.f64(),
+              longitude: section.f64(),
+              sex: section.string(),
+              gender: section.optString(),
+              timezone: section.optString(),
+              ayanamsha: section.string(),
+              houseSystem: section.string(),
+              createdAt: section.optDateTime(),
+              updatedAt: section.optDateTime(),
+            );
+          case _tagPanchang:
+            panchang = PanchangSnapshot(
+              date: section.date(),
+              tithi: section.string(),
+              nakshatra: section.string(),
+              festival: section.optString(),
+            );
+          case _tagPrediction:
+            prediction = PredictionSnapshot(
+              date: section.date(),
+              headline: section.string(),
+            );
+          case _tagPlayback:
+            final count = section.u8();
+            playback = PlaybackSnapshot(
+              queueHead: List.generate(
+                count,
+                (_) => Track(
+                  id: section.string(),
+                  title: section.string(),
+                  subtitle: section.string(),
+                  album: section.string(),
+                  duration: Duration(milliseconds: section.u32()),
+                  coverUrl: section.string(),
+                  sourceUrl: section.string(),
+                ),
+              ),
+            );
+          default:
+            break; // Unknown section from a newer writer
+        }
+      }
+
+      return StartupSnapshot(
+        writtenAt: writtenAt,
+        user: user,
+        panchang: panchang,
+        prediction: prediction,
+        playback: playback,
+      );
+    } on RangeError {
+      return null; // Truncated
+    } on FormatException {
+      return null; // Bad UTF-8
+    }
+  }
+}
+
+class _Writer {
+  final BytesBuilder _builder = BytesBuilder();
+  final ByteData _scratch = ByteData(8);
+
+  void u8(int value) => _builder.addByte(value);
+
+  void u16(int value) {
+    _scratch.setUint16(0, value, Endian.little);
+    _builder.add(_scratch.buffer.asUint8List(0, 2));
+  }
+
+  void u32(int value) {
+    _scratch.setUint32(0, value, Endian.little);
+    _builder.add(_scratch.buffer.asUint8List(0, 4));
+  }
+
+  void i64(int value) {
+    _scratch.setInt64(0, value, Endian.little);
+    _builder.add(_scratch.buffer.asUint8List(0, 8));
+  }
+
+  void f64(double value) {
+    _scratch.setFloat64(0, value, Endian.little);
+    _builder.add(_scratch.buffer.asUint8List(0, 8));
+  }
+
+  void bytes(List<int> value) => _builder.add(value);
+
+  void string(String value) {
+    final encoded = utf8.encode(value);
+    u16(encoded.length);
+    _builder.add(encoded);
+  }
+
+  /// Null is written as length 0xFFFF
+  void optString(String? value) {
+    if (value == null) {
+      u16(0xFFFF);
+    } else {
+      string(value);
+    }
+  }
+
+  void date(DateTime value) {
+    u16(value.year);
+    u8(value.month);
+    u8(value.day);
+  }
+
+  void optDateTime(DateTime? value) =>
+      i64(value?.millisecondsSinceEpoch ?? -1);
+
+  Uint8List takeBytes() => _builder.takeBytes();
+}
+
+class _Reader {
+  final ByteData _data;
+  int _offset = 0;
+
+  _Reader(Uint8List bytes) : _data = ByteData.sublistView(bytes);
+
+  Uint8List view(int length) {
+    final view = Uint8List.sublistView(_data, _offset, _offset + length);
+    _offset += length;
+    return view;
+  }
+
+  int u8() => _data.getUint8(_offset++);
+
+  int u16() {
+    final value = _data.getUint16(_offset, Endian.little);
+    _offset += 2;
+    return value;
+  }
+
+  int u32() {
+    final value = _data.getUint32(_offset, Endian.little);
+    _offset += 4;
+    return value;
+  }
+
+  int i64() {
+    final value = _data.getInt64(_offset, Endian.little);
+    _offset += 8;
+    return value;
+  }
+
+  double f64() {
+    final value = _data.getFloat64(_offset, Endian.little);
+    _offset += 8;
+    return value;
+  }
+
+  String string() => utf8.decode(view(u16()));
+
+  String? optString() {
+    final length = u16();
+    return length == 0xFFFF ? null : utf8.decode(view(length));
+  }
+
+  DateTime date() {
+    final year = u16();
+    final month = u8();
+    return DateTime(year, month, u8());
+  }
+
+  DateTime? optDateTime() {
+    final millis = i64();
+    return millis < 0 ? null : DateTime.fromMillisecondsSinceEpoch(millis);
+  }
+}
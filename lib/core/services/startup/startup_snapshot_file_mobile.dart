@@ -0,0 +1,30 @@
+/// Startup Snapshot File Mobile Implementation
+///
+/// Uses dart:io to read and write the snapshot file
+library;
+
+import 'dart:io' show File;
+import 'dart:typed_data';
+import 'package:path_provider/path_provider.dart';
+
+/// Path of the snapshot file
+Future<String?> getSnapshotPath() async {
+  final supportDir = await getApplicationSupportDirectory();
+  return '${supportDir.path}/startup_snapshot.bin';
+}
+
+/// Read the snapshot synchronously (a few hundred bytes), null if missing
+Uint8List? readSnapshotFile(String path) {
+  final file = File(path);
+  if (!file.existsSync()) {
+    return null;
+  }
+  return file.readAsBytesSync();
+}
+
+/// Write the snapshot atomically (write to temp, then rename)
+Future<void> writeSnapshotFile(String path, Uint8List bytes) async {
+  final temp = File('$path.tmp');
+  await temp.writeAsBytes(bytes, flush: true);
+  await temp.rename(path);
+}
@@ -0,0 +1,15 @@
+/// Startup Snapshot File Stub
+///
+/// Stub implementation for web platform (no snapshot, live data only)
+library;
+
+import 'dart:typed_data';
+
+/// Path stub
+Future<String?> getSnapshotPath() async => null;
+
+/// Read stub
+Uint8List? readSnapshotFile(String path) => null;
+
+/// Write stub
+Future<void> writeSnapshotFile(String path, Uint8List bytes) async {}
@@ -0,0 +1,156 @@
+/// Startup Snapshot Service
+///
+/// Loads the startup snapshot before the first frame and keeps it up to
+/// date as live data arrives. The snapshot is written when the app pauses or
+/// exits, and right away when the user profile changes.
+library;
+
+import '../../logging/logging_helper.dart';
+import '../../models/user/user_model.dart';
+import '../audio/models/queue_state.dart';
+import 'startup_snapshot.dart';
+
+import 'startup_snapshot_file_stub.dart'
+    if (dart.library.io) 'startup_snapshot_file_mobile.dart';
+
+/// Startup Snapshot Service
+class StartupSnapshotService {
+  static StartupSnapshotService? _instance;
+
+  static StartupSnapshotService get instance {
+    _instance ??= StartupSnapshotService._();
+    return _instance!;
+  }
+
+  StartupSnapshotService._();
+
+  /// Tracks kept from the queue (current track first)
+  static const int queueHeadLength = 5;
+
+  /// Longest prediction headline kept
+  static const int maxHeadlineLength = 140;
+
+  StartupSnapshot _snapshot = StartupSnapshot.empty;
+  String? _path;
+  bool _dirty = false;
+  Future<void>? _writing;
+
+  /// Latest known state: the loaded snapshot, updated with live data
+  StartupSnapshot get snapshot => _snapshot;
+
+  /// Load the snapshot written by the previous session
+  ///
+  /// Call before `runApp`; a missing or unreadable snapshot leaves [snapshot]
+  /// empty and never throws.
+  Future<void> load() async {
+    try {
+      _path = await getSnapshotPath();
+      final path = _path;
+      if (path == null) return;
+
+      final bytes = readSnapshotFile(path);
+      if (bytes == null) return;
+
+      final decoded = StartupSnapshotCodec.decode(bytes);
+      if (decoded != null) {
+        _snapshot = decoded;
+      } else {
+        LoggingHelper.logWarning('Discarded unreadable startup snapshot',
+            source: 'StartupSnapshotService');
+      }
+    } catch (e) {
+      LoggingHelper.logError('Failed to load startup snapshot',
+          source: 'StartupSnapshotService', error: e);
+    }
+  }
+
+  /// Record the current user profile (written immediately)
+  void recordUser(UserModel? user) {
+    if (user == _snapshot.user) return;
+    _snapshot = user == null
+        ? _snapshot.copyWith(clearUser: true)
+        : _snapshot.copyWith(user: user);
+    _dirty = true;
+    flush();
+  }
+
+  /// Record today's panchang summary
+  void recordPanchang({
+    required DateTime date,
+    required String tithi,
+    required String nakshatra,
+    String? festival,
+  }) {
+    _snapshot = _snapshot.copyWith(
+      panchang: PanchangSnapshot(
+        date: date,
+        tithi: tithi,
+        nakshatra: nakshatra,
+        festival: festival,
+      ),
+    );
+    _dirty = true;
+  }
+
+  /// Record the daily prediction headline
+  void recordPrediction({required DateTime date, required String headline}) {
+    final trimmed = headline.trim();
+    if (trimmed.isEmpty) return;
+    _snapshot = _snapshot.copyWith(
+      prediction: PredictionSnapshot(
+        date: date,
+        headline: trimmed.length > maxHeadlineLength
+            ? '${trimmed.substring(0, maxHeadlineLength - 1)}…'
+            : trimmed,
+      ),
+    );
+    _dirty = true;
+  }
+
+  /// Record the mini-player track and the queue following it (play order)
+  void recordPlayback(QueueState queue) {
+    if (queue.queue.isEmpty) {
+      if (_snapshot.playback == null) return;
+      _snapshot = _snapshot.copyWith(clearPlayback: true);
+    } else {
+      final order = queue.shuffleEnabled ? queue.shuffledIndices : null;
+      final start = queue.currentIndex.clamp(0, queue.queue.length - 1);
+      final end = (start + queueHeadLength).clamp(0, queue.queue.length);
+      _snapshot = _snapshot.copyWith(
+        playback: PlaybackSnapshot(queueHead: [
+          for (var i = start; i < end; i++) queue.queue[order?[i] ?? i],
+        ]),
+      );
+    }
+    _dirty = true;
+  }
+
+  /// Write the snapshot if anything changed since the last write
+  Future<void> flush() async {
+    // Serialize writes; a write requested mid-write runs after it
+    while (_writing != null) {
+      await _writing;
+    }
+    if (!_dirty) return;
+
+    final write = _write();
+    _writing = write;
+    await write;
+    _writing = null;
+  }
+
+  Future<void> _write() async {
+    try {
+      final path = _path ??= await getSnapshotPath();
+      if (path == null) return;
+
+      _dirty = false;
+      final bytes = StartupSnapshotCodec.encode(_snapshot, DateTime.now());
+      await writeSnapshotFile(path, bytes);
+    } catch (e) {
+      _dirty = true;
+      LoggingHelper.logError('Failed to write startup snapshot',
+          source: 'StartupSnapshotService', error: e);
+    }
+  }
+}
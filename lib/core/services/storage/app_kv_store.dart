@@ -0,0 +1,74 @@
+/// App KV Store
+///
+/// The single [KvStore] shared by the app's storage services, plus a one-time
+/// migration of their old SharedPreferences keys.
+library;
+
+import 'package:shared_preferences/shared_preferences.dart';
+import '../../logging/logging_helper.dart';
+import 'kv_store.dart';
+
+import 'kv_store_backend_stub.dart'
+    if (dart.library.io) 'kv_store_backend_mobile.dart';
+
+/// App KV Store
+class AppKvStore {
+  AppKvStore._();
+
+  static const String _storeName = 'app';
+
+  /// Whether this isolate owns the store (truncates and compacts)
+  ///
+  /// Set by `main()`; background isolates leave it false and only append.
+  static bool isPrimary = false;
+
+  static final Map<String, Future<KvStore>> _opening = {};
+
+  /// Open the store once per isolate
+  ///
+  /// Large, separately queried data sets (e.g. match history) use their own
+  /// [name] so they don't slow down opening the shared store.
+  static Future<KvStore> open({String name = _storeName}) {
+    return _opening[name] ??= _open(name).catchError((Object e) {
+      _opening.remove(name); // Let the next caller retry
+      throw e;
+    });
+  }
+
+  static Future<KvStore> _open(String name) async {
+    final stopwatch = Stopwatch()..start();
+    final backend = await createAppKvBackend(name);
+    final store = await KvStore.open(backend, isPrimary: isPrimary);
+    LoggingHelper.logInfo(
+        'KV store $name opened in ${stopwatch.elapsedMilliseconds}ms '
+        '(generation ${store.generation}, log ${store.logLength} bytes)',
+        source: 'AppKvStore');
+    return store;
+  }
+
+  /// Move legacy preference keys into the store, once
+  ///
+  /// [fill] copies the values into the batch; the migrated marker goes into
+  /// the same batch, so a crash never leaves a half-migrated table. The old
+  /// keys are removed only after the batch is durable.
+  static Future<void> migrateFromPreferences(
+    KvStore store, {
+    required String marker,
+    required List<String> keys,
+    required void Function(KvBatch batch, SharedPreferences prefs) fill,
+  }) async {
+    final migrated = store.table('_migrated', KvCodec.boolean);
+    if (migrated.get(marker) == true) return;
+
+    final prefs = await SharedPreferences.getInstance();
+    await store.write((batch) {
+      fill(batch, prefs);
+      batch.put(migrated, marker, true);
+    });
+    for (final key in keys) {
+      await prefs.remove(key);
+    }
+    LoggingHelper.logInfo('Migrated $marker to the KV store',
+        source: 'AppKvStore');
+  }
+}
@@ -0,0 +1,605 @@
+/// KV Store
+///
+/// Embedded, log-structured key-value store with typed tables and atomic
+/// batches. Every write appends one checksummed record to a write-ahead log
+/// instead of rewriting a whole preferences file; the log is periodically
+/// compacted into a snapshot.
+///
+/// On-disk format (little endian):
+///   record   = payload length u32 | crc32(payload) u32 | payload
+///   payload  = generation i64 | op count u32 | ops
+///   op       = kind u8 | table (u16 length + utf8) | key (u16 length + utf8)
+///              | value (u32 length + bytes, puts only)
+///   snapshot = magic u32 | version u16 | one record holding every live entry
+///
+/// Crash consistency: a batch is a single record, so it is applied entirely
+/// or not at all. Recovery replays records until the first torn or corrupt
+/// one. Each compaction starts a new generation; log records from an older
+/// generation than the snapshot are already contained in it and skipped,
+/// which makes a crash between writing a snapshot and resetting the log
+/// harmless.
+///
+/// Several openers (e.g. the app and a background isolate) may share the
+/// files. Appends, torn-tail truncation and compaction each run inside
+/// [KvBackend.exclusive], so no record lands between a compaction reading
+/// the log and resetting it.
+library;
+
+import 'dart:async';
+import 'dart:collection';
+import 'dart:convert';
+import 'dart:typed_data';
+import 'package:archive/archive.dart' show getCrc32;
+
+/// Encodes values of a table to bytes and back
+class KvCodec<T> {
+  final Uint8List Function(T value) encode;
+  final T Function(Uint8List bytes) decode;
+
+  const KvCodec({required this.encode, required this.decode});
+
+  static final KvCodec<String> string = KvCodec(
+    encode: (value) => Uint8List.fromList(utf8.encode(value)),
+    decode: (bytes) => utf8.decode(bytes),
+  );
+
+  static final KvCodec<int> int64 = KvCodec(
+    encode: (value) =>
+        (ByteData(8)..setInt64(0, value, Endian.little)).buffer.asUint8List(),
+    decode: (bytes) => ByteData.sublistView(bytes).getInt64(0, Endian.little),
+  );
+
+  static final KvCodec<bool> boolean = KvCodec(
+    encode: (value) => Uint8List.fromList([value ? 1 : 0]),
+    decode: (bytes) => bytes.isNotEmpty && bytes[0] != 0,
+  );
+
+  static final KvCodec<Map<String, dynamic>> json = KvCodec(
+    encode: (value) => Uint8List.fromList(utf8.encode(jsonEncode(value))),
+    decode: (bytes) => jsonDecode(utf8.decode(bytes)) as Map<String, dynamic>,
+  );
+}
+
+/// Persistence for the snapshot and the log
+abstract class KvBackend {
+  /// Current snapshot, or null if none was written yet
+  Future<Uint8List?> readSnapshot();
+
+  /// Entire log, or null if it doesn't exist
+  Future<Uint8List?> readLog();
+
+  /// Bytes in the log, without reading it (0 if it doesn't exist)
+  Future<int> logLength();
+
+  /// Append [record] to the log; completes once it is durable
+  Future<void> appendLog(Uint8List record);
+
+  /// Cut the log to [length] bytes (drops a torn tail, or resets it)
+  Future<void> truncateLog(int length);
+
+  /// Atomically replace the snapshot
+  Future<void> replaceSnapshot(Uint8List snapshot);
+
+  /// Run [action] while no other opener of the same data is inside its own
+  /// [exclusive] section, in this isolate or any other
+  Future<T> exclusive<T>(Future<T> Function() action);
+
+  Future<void> close();
+}
+
+/// In-memory backend (tests, and crash simulation via its byte buffers)
+class MemoryKvBackend implements KvBackend {
+  Uint8List? snapshot;
+  final BytesBuilder _log = BytesBuilder(copy: true);
+
+  /// Tail of the [exclusive] sections of every store opened on this backend
+  Future<void> _exclusive = Future.value();
+
+  MemoryKvBackend({this.snapshot, Uint8List? log}) {
+    if (log != null) _log.add(log);
+  }
+
+  /// Copy of the log as currently "on disk"
+  Uint8List get logBytes => _log.toBytes();
+
+  @override
+  Future<Uint8List?> readSnapshot() async => snapshot;
+
+  @override
+  Future<Uint8List?> readLog() async => _log.isEmpty ? null : _log.toBytes();
+
+  @override
+  Future<int> logLength() async => _log.length;
+
+  @override
+  Future<void> appendLog(Uint8List record) async => _log.add(record);
+
+  @override
+  Future<void> truncateLog(int length) async {
+    final kept = _log.toBytes().sublist(0, length);
+    _log
+      ..clear()
+      ..add(kept);
+  }
+
+  @override
+  Future<void> replaceSnapshot(Uint8List snapshot) async {
+    this.snapshot = snapshot;
+  }
+
+  @override
+  Future<T> exclusive<T>(Future<T> Function() action) {
+    final next = _exclusive.then((_) => action());
+    _exclusive = next.then((_) {}, onError: (_) {});
+    return next;
+  }
+
+  @override
+  Future<void> close() async {}
+}
+
+/// A typed table inside a [KvStore]
+///
+/// Values are kept as bytes and decoded on first read; decoded values are
+/// cached until the entry changes.
+class KvTable<T> {
+  final KvStore store;
+  final String name;
+  final KvCodec<T> codec;
+  final Map<String, T> _decoded = {};
+
+  KvTable._(this.store, this.name, this.codec);
+
+  SplayTreeMap<String, Uint8List> get _entries => store._tableEntries(name);
+
+  int get length => _entries.length;
+
+  bool get isEmpty => _entries.isEmpty;
+
+  bool containsKey(String key) => _entries.containsKey(key);
+
+  /// Value for [key], decoded lazily
+  T? get(String key) {
+    final cached = _decoded[key];
+    if (cached != null) return cached;
+    final bytes = _entries[key];
+    if (bytes == null) return null;
+    return _decoded[key] = codec.decode(bytes);
+  }
+
+  /// Keys in ascending order
+  Iterable<String> get keys => _entries.keys;
+
+  /// Entries with keys in [start, end), ascending or descending
+  Iterable<MapEntry<String, T>> scan({
+    String? start,
+    String? end,
+    bool descending = false,
+    int? limit,
+  }) sync* {
+    final entries = _entries;
+    var count = 0;
+    if (!descending) {
+      var key = start == null
+          ? entries.firstKey()
+          : entries.containsKey(start)
+              ? start
+              : entries.firstKeyAfter(start);
+      while (key != null && (end == null || key.compareTo(end) < 0)) {
+        if (limit != null && count++ >= limit) return;
+        yield MapEntry(key, get(key) as T);
+        key = entries.firstKeyAfter(key);
+      }
+    } else {
+      var key = end == null ? entries.lastKey() : entries.lastKeyBefore(end);
+      while (key != null && (start == null || key.compareTo(start) >= 0)) {
+        if (limit != null && count++ >= limit) return;
+        yield MapEntry(key, get(key) as T);
+        key = entries.lastKeyBefore(key);
+      }
+    }
+  }
+
+  /// Write one value (a single-op batch)
+  Future<void> put(String key, T value) =>
+      store.write((batch) => batch.put(this, key, value));
+
+  /// Delete one value (a single-op batch)
+  Future<void> delete(String key) =>
+      store.write((batch) => batch.delete(this, key));
+
+  /// Delete every value in the table (a single-op batch)
+  Future<void> clear() => store.write((batch) => batch.clear(this));
+}
+
+class _KvOp {
+  static const int put = 1;
+  static const int delete = 2;
+  static const int clear = 3;
+
+  final int kind;
+  final String table;
+  final String key;
+  final Uint8List? value;
+
+  const _KvOp(this.kind, this.table, this.key, [this.value]);
+}
+
+/// Operations applied together, atomically
+class KvBatch {
+  final List<_KvOp> _ops = [];
+  final List<void Function()> _cacheUpdates = [];
+
+  bool get isEmpty => _ops.isEmpty;
+
+  void put<T>(KvTable<T> table, String key, T value) {
+    _ops.add(_KvOp(_KvOp.put, table.name, key, table.codec.encode(value)));
+    _cacheUpdates.add(() => table._decoded[key] = value);
+  }
+
+  void delete<T>(KvTable<T> table, String key) {
+    _ops.add(_KvOp(_KvOp.delete, table.name, key));
+    _cacheUpdates.add(() => table._decoded.remove(key));
+  }
+
+  void clear<T>(KvTable<T> table) {
+    _ops.add(_KvOp(_KvOp.clear, table.name, ''));
+    _cacheUpdates.add(table._decoded.clear);
+  }
+}
+
+/// KV Store
+///
+/// Writes are applied in memory immediately (reads see them at once) and the
+/// returned future completes when the batch is durable in the log. All
+/// backend I/O is serialized.
+class KvStore {
+  static const int _snapshotMagic = 0x564B4B53; // 'SKKV'
+  static const int _snapshotVersion = 1;
+
+  /// Compact once the log is larger than this and larger than the snapshot
+  static const int defaultCompactionThreshold = 256 * 1024;
+
+  final KvBackend _backend;
+
+  /// Only the primary opener compacts; other openers (e.g. a background
+  /// isolate) append, read and drop torn log tails
+  final bool isPrimary;
+  final int compactionThreshold;
+
+  final Map<String, SplayTreeMap<String, Uint8List>> _tables = {};
+  final Map<String, KvTable<dynamic>> _typedTables = {};
+
+  /// Batches applied in memory but not yet appended to the log
+  final List<List<_KvOp>> _unlogged = [];
+  Future<void> _io = Future.value();
+  int _generation = 0;
+  int _snapshotLength = 0;
+  int _logLength = 0;
+  bool _closed = false;
+
+  KvStore._(this._backend, this.isPrimary, this.compactionThreshold);
+
+  /// Open a store, recovering the snapshot and every intact log record
+  static Future<KvStore> open(
+    KvBackend backend, {
+    bool isPrimary = true,
+    int compactionThreshold = defaultCompactionThreshold,
+  }) async {
+    final store = KvStore._(backend, isPrimary, compactionThreshold);
+    await store._recover();
+    return store;
+  }
+
+  /// Current log generation (bumped by every compaction)
+  int get generation => _generation;
+
+  /// Bytes currently in the log
+  int get logLength => _logLength;
+
+  /// Typed view of table [name]; the same instance is returned per name
+  KvTable<T> table<T>(String name, KvCodec<T> codec) {
+    final existing = _typedTables[name];
+    if (existing != null) return existing as KvTable<T>;
+    final table = KvTable<T>._(this, name, codec);
+    _typedTables[name] = table;
+    return table;
+  }
+
+  SplayTreeMap<String, Uint8List> _tableEntries(String name) =>
+      _tables.putIfAbsent(name, () => SplayTreeMap());
+
+  /// Apply a batch atomically
+  Future<void> write(void Function(KvBatch batch) build) {
+    if (_closed) {
+      return Future.error(StateError('KvStore is closed'));
+    }
+    final batch = KvBatch();
+    build(batch);
+    if (batch.isEmpty) return Future.value();
+
+    final ops = batch._ops;
+    _apply(ops);
+    _unlogged.add(ops);
+    for (final update in batch._cacheUpdates) {
+      update();
+    }
+
+    return _enqueue(() => _backend.exclusive(() async {
+          // Checked under the lock: the primary can't compact between the
+          // check and the append
+          if (!isPrimary && await _snapshotGeneration() != _generation) {
+            // The primary compacted since we loaded; records of our old
+            // generation would be skipped, so catch up and re-stamp the
+            // batch
+            await _reload();
+          }
+          // Stamped when appended, so it carries the generation of the log
+          // it actually lands in
+          final record = _encodeRecord(_generation, ops);
+          await _backend.appendLog(record);
+          _unlogged.remove(ops);
+          _logLength += record.length;
+          if (isPrimary &&
+              _logLength > compactionThreshold &&
+              _logLength > _snapshotLength) {
+            await _compactNow();
+          }
+        }));
+  }
+
+  /// Rewrite the snapshot from memory and reset the log
+  Future<void> compact() => _enqueue(() => _backend.exclusive(_compactNow));
+
+  /// Pick up records appended by another opener of the same files
+  Future<void> refresh() => _enqueue(() => _backend.exclusive(_reload));
+
+  /// [refresh], but only if another opener changed the files since this one
+  /// last read or wrote them; a size check, so cheap on every cache miss
+  Future<void> refreshIfChanged() => _enqueue(() async {
+        final unchanged = await _backend.logLength() == _logLength &&
+            // Only the primary compacts, so a secondary also checks for a
+            // new generation whose log happens to be as long
+            (isPrimary || await _snapshotGeneration() == _generation);
+        if (!unchanged) await _backend.exclusive(_reload);
+      });
+
+  /// Wait for pending writes and release the backend
+  Future<void> close() async {
+    _closed = true;
+    await _io;
+    await _backend.close();
+  }
+
+  Future<void> _enqueue(Future<void> Function() action) {
+    final next = _io.then((_) => action());
+    _io = next.catchError((_) {});
+    return next;
+  }
+
+  Future<void> _recover() => _enqueue(() => _backend.exclusive(_reload));
+
+  /// Callers hold [KvBackend.exclusive]
+  Future<void> _reload() async {
+    _tables.clear();
+    _generation = 0;
+    _snapshotLength = 0;
+    _logLength = 0;
+    for (final table in _typedTables.values) {
+      table._decoded.clear();
+    }
+
+    final snapshot = await _backend.readSnapshot();
+    if (snapshot != null) {
+      _loadSnapshot(snapshot);
+      _snapshotLength = snapshot.length;
+    }
+
+    final log = await _backend.readLog();
+    if (log != null) {
+      final valid = _replay(log, 0);
+      _logLength = valid;
+      if (valid < log.length) {
+        // Torn or corrupt tail from a crash mid-append; cut by every opener
+        // so the next append doesn't land behind it
+        await _backend.truncateLog(valid);
+      }
+    }
+
+    // Local writes still waiting for their append stay visible
+    for (final ops in _unlogged) {
+      _apply(ops);
+    }
+  }
+
+  void _loadSnapshot(Uint8List snapshot) {
+    if (!_hasSnapshotHeader(snapshot)) return;
+    final decoded = _decodeRecord(snapshot, 6);
+    if (decoded == null) return;
+    _apply(decoded.ops);
+    _generation = decoded.generation;
+  }
+
+  static bool _hasSnapshotHeader(Uint8List snapshot) {
+    if (snapshot.length < 6) return false;
+    final header = ByteData.sublistView(snapshot, 0, 6);
+    return header.getUint32(0, Endian.little) == _snapshotMagic &&
+        header.getUint16(4, Endian.little) == _snapshotVersion;
+  }
+
+  Future<int> _snapshotGeneration() async {
+    final snapshot = await _backend.readSnapshot();
+    if (snapshot == null || !_hasSnapshotHeader(snapshot)) return 0;
+    return _decodeRecord(snapshot, 6)?.generation ?? 0;
+  }
+
+  /// Replay log records from [offset]; returns bytes consumed by intact ones
+  int _replay(Uint8List log, int offset) {
+    var position = offset;
+    while (true) {
+      final decoded = _decodeRecord(log, position);
+      if (decoded == null) break;
+      if (decoded.generation >= _generation) {
+        _apply(decoded.ops);
+      }
+      position += decoded.length;
+    }
+    return position - offset;
+  }
+
+  /// Callers hold [KvBackend.exclusive]
+  Future<void> _compactNow() async {
+    // Re-read first so records appended by other openers are kept. Batches
+    // still queued are in memory (and so in the snapshot) but are appended
+    // afterwards with the new generation; replaying them is idempotent.
+    await _reload();
+    final ops = <_KvOp>[
+      for (final table in _tables.entries)
+        for (final entry in table.value.entries)
+          _KvOp(_KvOp.put, table.key, entry.key, entry.value),
+    ];
+    final generation = ++_generation;
+    final record = _encodeRecord(generation, ops);
+    final snapshot = Uint8List(6 + record.length);
+    ByteData.sublistView(snapshot, 0, 6)
+      ..setUint32(0, _snapshotMagic, Endian.little)
+      ..setUint16(4, _snapshotVersion, Endian.little);
+    snapshot.setRange(6, snapshot.length, record);
+
+    await _backend.replaceSnapshot(snapshot);
+    _snapshotLength = snapshot.length;
+    await _backend.truncateLog(0);
+    _logLength = 0;
+  }
+
+  void _apply(List<_KvOp> ops) {
+    for (final op in ops) {
+      switch (op.kind) {
+        case _KvOp.put:
+          _tableEntries(op.table)[op.key] = op.value!;
+        case _KvOp.delete:
+          _tables[op.table]?.remove(op.key);
+        case _KvOp.clear:
+          _tables[op.table]?.clear();
+      }
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Record encoding
+  // ---------------------------------------------------------------------------
+
+  static Uint8List _encodeRecord(int generation, List<_KvOp> ops) {
+    final payload = BytesBuilder(copy: false);
+    final scratch = ByteData(8);
+
+    void u8(int value) => payload.addByte(value);
+    void u16(int value) {
+      scratch.setUint16(0, value, Endian.little);
+      payload.add(Uint8List.fromList(scratch.buffer.asUint8List(0, 2)));
+    }
+
+    void u32(int value) {
+      scratch.setUint32(0, value, Endian.little);
+      payload.add(Uint8List.fromList(scratch.buffer.asUint8List(0, 4)));
+    }
+
+    void text(String value) {
+      final bytes = utf8.encode(value);
+      u16(bytes.length);
+      payload.add(bytes);
+    }
+
+    scratch.setInt64(0, generation, Endian.little);
+    payload.add(Uint8List.fromList(scratch.buffer.asUint8List(0, 8)));
+    u32(ops.length);
+    for (final op in ops) {
+      u8(op.kind);
+      text(op.table);
+      text(op.key);
+      if (op.kind == _KvOp.put) {
+        u32(op.value!.length);
+        payload.add(op.value!);
+      }
+    }
+
+    final body = payload.takeBytes();
+    final record = Uint8List(8 + body.length);
+    ByteData.sublistView(record, 0, 8)
+      ..setUint32(0, body.length, Endian.little)
+      ..setUint32(4, getCrc32(body), Endian.little);
+    record.setRange(8, record.length, body);
+    return record;
+  }
+
+  /// Decode the record at [offset]; null if it is torn or corrupt
+  static _DecodedRecord? _decodeRecord(Uint8List data, int offset) {
+    if (offset + 8 > data.length) return null;
+    final header = ByteData.sublistView(data, offset, offset + 8);
+    final length = header.getUint32(0, Endian.little);
+    final checksum = header.getUint32(4, Endian.little);
+    final start = offset + 8;
+    final end = start + length;
+    if (end > data.length || length < 12) return null;
+
+    final body = Uint8List.sublistView(data, start, end);
+    if (getCrc32(body) != checksum) return null;
+
+    try {
+      final view = ByteData.sublistView(body);
+      var position = 0;
+      int u8() => view.getUint8(position++);
+      int u16() {
+        final value = view.getUint16(position, Endian.little);
+        position += 2;
+        return value;
+      }
+
+      int u32() {
+        final value = view.getUint32(position, Endian.little);
+        position += 4;
+        return value;
+      }
+
+      String text() {
+        final length = u16();
+        final value = utf8.decode(
+            Uint8List.sublistView(body, position, position + length));
+        position += length;
+        return value;
+      }
+
+      final generation = view.getInt64(0, Endian.little);
+      position = 8;
+      final count = u32();
+      final ops = <_KvOp>[];
+      for (var i = 0; i < count; i++) {
+        final kind = u8();
+        final table = text();
+        final key = text();
+        Uint8List? value;
+        if (kind == _KvOp.put) {
+          final valueLength = u32();
+          // Copy so the value doesn't pin the whole log buffer
+          value = Uint8List.fromList(
+              Uint8List.sublistView(body, position, position + valueLength));
+          position += valueLength;
+        }
+        ops.add(_KvOp(kind, table, key, value));
+      }
+      return _DecodedRecord(generation, ops, 8 + length);
+    } on RangeError {
+      return null;
+    } on FormatException {
+      return null;
+    }
+  }
+}
+
+class _DecodedRecord {
+  final int generation;
+  final List<_KvOp> ops;
+  final int length;
+
+  const _DecodedRecord(this.generation, this.ops, this.length);
+}
@@ -0,0 +1,201 @@
+/// KV Store Backend Mobile Implementation
+///
+/// Uses dart:io to keep the snapshot and the log as two files, with a third,
+/// transient lock file naming the opener inside its exclusive section
+library;
+
+import 'dart:io'
+    show
+        Directory,
+        File,
+        FileMode,
+        FileSystemException,
+        Platform,
+        RandomAccessFile,
+        pid;
+import 'dart:math' as math;
+import 'dart:typed_data';
+import 'package:path_provider/path_provider.dart';
+import 'kv_store.dart';
+
+/// File backed [KvBackend]: `<name>.snap` and `<name>.log`
+class FileKvBackend implements KvBackend {
+  /// A lock from this process older than this was left by an isolate that
+  /// died holding it
+  static const Duration staleLock = Duration(seconds: 30);
+
+  final File _snapshot;
+  final File _log;
+  final File _lock;
+  RandomAccessFile? _appender;
+
+  FileKvBackend(String directory, String name)
+      : _snapshot = File('$directory/$name.snap'),
+        _log = File('$directory/$name.log'),
+        _lock = File('$directory/$name.lock');
+
+  @override
+  Future<Uint8List?> readSnapshot() async {
+    if (!await _snapshot.exists()) return null;
+    return _snapshot.readAsBytes();
+  }
+
+  @override
+  Future<Uint8List?> readLog() async {
+    if (!await _log.exists()) return null;
+    return _log.readAsBytes();
+  }
+
+  @override
+  Future<int> logLength() async {
+    if (!await _log.exists()) return 0;
+    return _log.length();
+  }
+
+  @override
+  Future<void> appendLog(Uint8List record) async {
+    final file = _appender ??= await _log.open(mode: FileMode.append);
+    // Another opener may have compacted or cut the log since our last
+    // append; write at its current end, not where we left off
+    await file.setPosition(await file.length());
+    await file.writeFrom(record);
+    await file.flush();
+  }
+
+  @override
+  Future<void> truncateLog(int length) async {
+    final file = _appender ??= await _log.open(mode: FileMode.append);
+    await file.truncate(length);
+    await file.setPosition(length);
+    await file.flush();
+  }
+
+  /// Write to temp, then rename over the old snapshot
+  @override
+  Future<void> replaceSnapshot(Uint8List snapshot) async {
+    final temp = File('${_snapshot.path}.tmp');
+    await temp.writeAsBytes(snapshot, flush: true);
+    await temp.rename(_snapshot.path);
+  }
+
+  /// Exclusive creation of `<name>.lock`, holding `<pid> <token>`
+  ///
+  /// `RandomAccessFile.lock` is per process on Android and iOS, so it
+  /// wouldn't keep a background isolate of the same process out. Only the
+  /// opener whose token is in the lock deletes it.
+  @override
+  Future<T> exclusive<T>(Future<T> Function() action) async {
+    final owner = await _acquire();
+    try {
+      return await action();
+    } finally {
+      if (await _holder() == owner) await _lock.delete();
+    }
+  }
+
+  Future<String> _acquire() async {
+    final owner = '$pid ${_token()}';
+    var delay = 1;
+    while (true) {
+      try {
+        await _lock.create(exclusive: true);
+        await _lock.writeAsString(owner, flush: true);
+        return owner;
+      } on FileSystemException {
+        try {
+          final holder = await _holder();
+          if (holder != null && await _abandoned(holder)) {
+            await _break(holder);
+          }
+        } on FileSystemException {
+          // Released meanwhile
+        }
+      }
+      await Future<void>.delayed(Duration(milliseconds: delay));
+      delay = math.min(delay * 2, 50);
+    }
+  }
+
+  /// Contents of the lock, or null when nobody holds it
+  Future<String?> _holder() async {
+    try {
+      return await _lock.readAsString();
+    } on FileSystemException {
+      return null;
+    }
+  }
+
+  /// Whether the opener that wrote [holder] can no longer release it
+  ///
+  /// A lock from another process is abandoned as soon as that process is
+  /// gone. Another isolate of this process, or a lock whose creator hasn't
+  /// written it yet, can't be told apart from a dead one except by age.
+  Future<bool> _abandoned(String holder) async {
+    final holderPid = int.tryParse(holder.split(' ').first);
+    if (holderPid != null && holderPid != pid) {
+      return !await _running(holderPid);
+    }
+    final age = DateTime.now().difference(await _lock.lastModified());
+    return age > staleLock;
+  }
+
+  /// Whether process [id] is alive
+  static Future<bool> _running(int id) async {
+    // Android hides other apps' processes from /proc, so a reused pid
+    // reads as gone
+    if (Platform.isAndroid || Platform.isLinux) {
+      return Directory('/proc/$id').exists();
+    }
+    // Apple platforms run an app, background tasks included, in a single
+    // process; another pid was an earlier launch
+    return false;
+  }
+
+  /// Delete the abandoned lock [holder], once however many openers find it
+  ///
+  /// Breakers first create `<name>.lock.<token>.break` exclusively and
+  /// check the lock again inside, so a lock taken after the break, which
+  /// carries a new token or is fresh, is never deleted.
+  Future<void> _break(String holder) async {
+    final token = holder.split(' ').last;
+    final marker = File('${_lock.path}.'
+        '${RegExp(r'^[0-9a-f]+$').hasMatch(token) ? token : 'unnamed'}'
+        '.break');
+    try {
+      await marker.create(exclusive: true);
+    } on FileSystemException {
+      // Another opener is breaking it, unless it died doing so
+      final age = DateTime.now().difference(await marker.lastModified());
+      if (age > staleLock) await marker.delete();
+      return;
+    }
+    try {
+      if (await _holder() == holder && await _abandoned(holder)) {
+        await _lock.delete();
+      }
+    } finally {
+      await marker.delete();
+    }
+  }
+
+  static final math.Random _random = math.Random.secure();
+
+  static String _token() =>
+      _random.nextInt(1 << 32).toRadixString(16).padLeft(8, '0');
+
+  @override
+  Future<void> close() async {
+    await _appender?.close();
+    _appender = null;
+  }
+}
+
+/// Backend for the app store [name] in the support directory
+Future<KvBackend> createAppKvBackend(String name) async {
+  final supportDir = await getApplicationSupportDirectory();
+  final dir = Directory('${supportDir.path}/kv');
+  if (!await dir.exists()) {
+    await dir.create(recursive: true);
+  }
+  return FileKvBackend(dir.path, name);
+}
@@ -0,0 +1,111 @@
+/// KV Store Backend Stub
+///
+/// Web implementation: no file system, so the snapshot and the log are kept
+/// base64 encoded in SharedPreferences. The log is split into one key per
+/// append, so appending costs the record alone rather than a rewrite of
+/// the whole log.
+library;
+
+import 'dart:convert';
+import 'dart:typed_data';
+import 'package:shared_preferences/shared_preferences.dart';
+import 'kv_store.dart';
+
+/// SharedPreferences backed [KvBackend]
+class PreferencesKvBackend implements KvBackend {
+  final String _snapshotKey;
+
+  /// First log chunk; also the whole log as written before chunking
+  final String _logKey;
+  final String _chunkCountKey;
+  Future<void> _exclusive = Future.value();
+
+  PreferencesKvBackend(String name)
+      : _snapshotKey = 'kv_${name}_snap',
+        _logKey = 'kv_${name}_log',
+        _chunkCountKey = 'kv_${name}_log_count';
+
+  String _chunkKey(int index) => index == 0 ? _logKey : '${_logKey}_$index';
+
+  int _chunkCount(SharedPreferences prefs) =>
+      prefs.getInt(_chunkCountKey) ?? (prefs.containsKey(_logKey) ? 1 : 0);
+
+  @override
+  Future<Uint8List?> readSnapshot() async {
+    final prefs = await SharedPreferences.getInstance();
+    final encoded = prefs.getString(_snapshotKey);
+    return encoded == null ? null : base64Decode(encoded);
+  }
+
+  @override
+  Future<Uint8List?> readLog() async {
+    final prefs = await SharedPreferences.getInstance();
+    final count = _chunkCount(prefs);
+    if (count == 0) return null;
+    final log = BytesBuilder(copy: false);
+    for (var i = 0; i < count; i++) {
+      final encoded = prefs.getString(_chunkKey(i));
+      if (encoded != null) log.add(base64Decode(encoded));
+    }
+    return log.takeBytes();
+  }
+
+  /// Decoded sizes of the chunks, from their base64 lengths
+  @override
+  Future<int> logLength() async {
+    final prefs = await SharedPreferences.getInstance();
+    var length = 0;
+    for (var i = 0; i < _chunkCount(prefs); i++) {
+      final encoded = prefs.getString(_chunkKey(i)) ?? '';
+      final padding = encoded.endsWith('==')
+          ? 2
+          : encoded.endsWith('=')
+              ? 1
+              : 0;
+      length += encoded.length ~/ 4 * 3 - padding;
+    }
+    return length;
+  }
+
+  @override
+  Future<void> appendLog(Uint8List record) async {
+    final prefs = await SharedPreferences.getInstance();
+    final count = _chunkCount(prefs);
+    await prefs.setString(_chunkKey(count), base64Encode(record));
+    await prefs.setInt(_chunkCountKey, count + 1);
+  }
+
+  /// Rewrites the kept bytes as a single chunk; only torn tails keep any
+  @override
+  Future<void> truncateLog(int length) async {
+    final kept = length == 0 ? null : (await readLog())?.sublist(0, length);
+    final prefs = await SharedPreferences.getInstance();
+    final count = _chunkCount(prefs);
+    await prefs.setInt(_chunkCountKey, kept == null ? 0 : 1);
+    if (kept != null) await prefs.setString(_logKey, base64Encode(kept));
+    for (var i = kept == null ? 0 : 1; i < count; i++) {
+      await prefs.remove(_chunkKey(i));
+    }
+  }
+
+  @override
+  Future<void> replaceSnapshot(Uint8List snapshot) async {
+    final prefs = await SharedPreferences.getInstance();
+    await prefs.setString(_snapshotKey, base64Encode(snapshot));
+  }
+
+  /// A browser tab has a single opener, so this only orders its sections
+  @override
+  Future<T> exclusive<T>(Future<T> Function() action) {
+    final next = _exclusive.then((_) => action());
+    _exclusive = next.then((_) {}, onError: (_) {});
+    return next;
+  }
+
+  @override
+  Future<void> close() async {}
+}
+
+/// Backend for the app store [name]
+Future<KvBackend> createAppKvBackend(String name) async =>
+    PreferencesKvBackend(name);
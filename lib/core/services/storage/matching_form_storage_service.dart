@@ -5,19 +5,27 @@
 library;
 
 import 'dart:convert';
-import 'package:shared_preferences/shared_preferences.dart';
 import '../../../core/logging/logging_helper.dart';
+import 'app_kv_store.dart';
+import 'kv_store.dart';
 
 /// Service to store and retrieve matching form data
 class MatchingFormStorageService {
   static MatchingFormStorageService? _instance;
-  SharedPreferences? _prefs;
+  KvTable<String>? _form;
 
-  // Storage keys
+  // Storage keys (legacy preference keys, reused as KV keys)
   static const String _groomDataKey = 'matching_groom_data';
   static const String _brideDataKey = 'matching_bride_data';
   static const String _ayanamshaKey = 'matching_ayanamsha';
   static const String _houseSystemKey = 'matching_house_system';
+  static const List<String> _keys = [
+    _groomDataKey,
+    _brideDataKey,
+    _ayanamshaKey,
+    _houseSystemKey,
+  ];
+  static const String _formTable = 'matching_form';
 
   // Private constructor for singleton
   MatchingFormStorageService._();
@@ -31,7 +39,20 @@ class MatchingFormStorageService {
   /// Initialize the service
   Future<void> initialize() async {
     try {
-      _prefs = await SharedPreferences.getInstance();
+      final store = await AppKvStore.open();
+      final form = store.table(_formTable, KvCodec.string);
+      await AppKvStore.migrateFromPreferences(
+        store,
+        marker: _formTable,
+        keys: _keys,
+        fill: (batch, prefs) {
+          for (final key in _keys) {
+            final value = prefs.getString(key);
+            if (value != null) batch.put(form, key, value);
+          }
+        },
+      );
+      _form = form;
       LoggingHelper.logInfo('Matching Form Storage Service initialized');
     } catch (e) {
       LoggingHelper.logError(
@@ -63,7 +84,7 @@ class MatchingFormStorageService {
         'longitude': longitude,
       };
 
-      await _prefs!.setString(_groomDataKey, json.encode(groomData));
+      await _form!.put(_groomDataKey, json.encode(groomData));
       LoggingHelper.logInfo('Groom data saved successfully');
     } catch (e) {
       LoggingHelper.logError('Failed to save groom data',
@@ -92,7 +113,7 @@ class MatchingFormStorageService {
         'longitude': longitude,
       };
 
-      await _prefs!.setString(_brideDataKey, json.encode(brideData));
+      await _form!.put(_brideDataKey, json.encode(brideData));
       LoggingHelper.logInfo('Bride data saved successfully');
     } catch (e) {
       LoggingHelper.logError('Failed to save bride data',
@@ -104,7 +125,7 @@ class MatchingFormStorageService {
   Future<void> saveAyanamsha(String ayanamsha) async {
     try {
       await _ensureInitialized();
-      await _prefs!.setString(_ayanamshaKey, ayanamsha);
+      await _form!.put(_ayanamshaKey, ayanamsha);
       LoggingHelper.logInfo('Ayanamsha saved successfully');
     } catch (e) {
       LoggingHelper.logError('Failed to save ayanamsha',
@@ -116,7 +137,7 @@ class MatchingFormStorageService {
   Future<Map<String, dynamic>?> getGroomData() async {
     try {
       await _ensureInitialized();
-      final groomDataString = _prefs!.getString(_groomDataKey);
+      final groomDataString = _form!.get(_groomDataKey);
       if (groomDataString != null) {
         return json.decode(groomDataString);
       }
@@ -132,7 +153,7 @@ class MatchingFormStorageService {
   Future<Map<String, dynamic>?> getBrideData() async {
     try {
       await _ensureInitialized();
-      final brideDataString = _prefs!.getString(_brideDataKey);
+      final brideDataString = _form!.get(_brideDataKey);
       if (brideDataString != null) {
         return json.decode(brideDataString);
       }
@@ -148,7 +169,7 @@ class MatchingFormStorageService {
   Future<String?> getAyanamsha() async {
     try {
       await _ensureInitialized();
-      return _prefs!.getString(_ayanamshaKey);
+      return _form!.get(_ayanamshaKey);
     } catch (e) {
       LoggingHelper.logError('Failed to get ayanamsha',
           source: 'MatchingFormStorageService', error: e);
@@ -160,7 +181,7 @@ class MatchingFormStorageService {
   Future<void> saveHouseSystem(String houseSystem) async {
     try {
       await _ensureInitialized();
-      await _prefs!.setString(_houseSystemKey, houseSystem);
+      await _form!.put(_houseSystemKey, houseSystem);
       LoggingHelper.logInfo('House system saved successfully');
     } catch (e) {
       LoggingHelper.logError('Failed to save house system',
@@ -172,7 +193,7 @@ class MatchingFormStorageService {
   Future<String?> getHouseSystem() async {
     try {
       await _ensureInitialized();
-      return _prefs!.getString(_houseSystemKey);
+      return _form!.get(_houseSystemKey);
     } catch (e) {
       LoggingHelper.logError('Failed to get house system',
           source: 'MatchingFormStorageService', error: e);
@@ -184,10 +205,7 @@ class MatchingFormStorageService {
   Future<void> clearAllData() async {
     try {
       await _ensureInitialized();
-      await _prefs!.remove(_groomDataKey);
-      await _prefs!.remove(_brideDataKey);
-      await _prefs!.remove(_ayanamshaKey);
-      await _prefs!.remove(_houseSystemKey);
+      await _form!.clear();
       LoggingHelper.logInfo('All matching form data cleared');
     } catch (e) {
       LoggingHelper.logError('Failed to clear matching form data',
@@ -197,7 +215,7 @@ class MatchingFormStorageService {
 
   /// Ensure service is initialized
   Future<void> _ensureInitialized() async {
-    if (_prefs == null) {
+    if (_form == null) {
       await initialize();
     }
   }
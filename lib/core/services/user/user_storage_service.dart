@@ -5,22 +5,26 @@
 library;
 
 import 'dart:convert';
-import 'package:shared_preferences/shared_preferences.dart';
 import 'package:skvk_application/core/errors/failures.dart';
 import '../../../core/models/user/user_model.dart';
 import '../../../core/services/shared/cache_service.dart';
 import '../../../core/logging/logging_helper.dart';
 import '../../../core/utils/either.dart';
+import '../startup/startup_snapshot_service.dart';
+import '../storage/app_kv_store.dart';
+import '../storage/kv_store.dart';
 
 /// User storage service that integrates with centralized astrology cache
 class UserStorageService {
   static UserStorageService? _instance;
-  SharedPreferences? _prefs;
+  KvTable<Map<String, dynamic>>? _profile;
   final CacheService _cacheService = CacheService.instance;
 
   // Storage keys
   static const String _userDataKey = 'user_profile_data';
   static const String _userCacheKey = 'user_cache';
+  static const String _userTable = 'user';
+  static const String _profileKey = 'profile';
 
   // Private constructor for singleton
   UserStorageService._();
@@ -34,7 +38,21 @@ class UserStorageService {
   /// Initialize the service
   Future<void> initialize() async {
     try {
-      _prefs = await SharedPreferences.getInstance();
+      final store = await AppKvStore.open();
+      final profile = store.table(_userTable, KvCodec.json);
+      await AppKvStore.migrateFromPreferences(
+        store,
+        marker: _userTable,
+        keys: const [_userDataKey],
+        fill: (batch, prefs) {
+          final userData = prefs.getString(_userDataKey);
+          if (userData != null) {
+            batch.put(profile, _profileKey,
+                jsonDecode(userData) as Map<String, dynamic>);
+          }
+        },
+      );
+      _profile = profile;
       LoggingHelper.logInfo('User Storage Service initialized');
     } catch (e) {
       LoggingHelper.logError('Failed to initialize user storage service',
@@ -55,9 +73,8 @@ class UserStorageService {
         );
       }
 
-      // Save to SharedPreferences for persistence
-      final userJson = json.encode(user.toJson());
-      await _prefs!.setString(_userDataKey, userJson);
+      // Save to the KV store for persistence
+      await _profile!.put(_profileKey, user.toJson());
 
       // Cache user data (user data with 1 year TTL)
       _cacheService.set(
@@ -66,6 +83,8 @@ class UserStorageService {
         duration: const Duration(days: 365),
       );
 
+      StartupSnapshotService.instance.recordUser(user);
+
       LoggingHelper.logInfo('User data saved successfully');
       return ResultHelper.success(null);
     } catch (e) {
@@ -90,19 +109,21 @@ class UserStorageService {
         return ResultHelper.success(user);
       }
 
-      // Fallback to SharedPreferences
-      final userData = _prefs!.getString(_userDataKey);
-      if (userData != null) {
-        final userMap = json.decode(userData);
+      // Fallback to the KV store
+      final userMap = _profile!.get(_profileKey);
+      if (userMap != null) {
         final user = UserModel.fromJson(userMap);
 
         // Cache it for future use
         _cacheService.set(
           _userCacheKey,
-          userMap as Map<String, dynamic>,
+          userMap,
           duration: const Duration(days: 365),
         );
 
+        // Reconcile the startup snapshot with the stored profile
+        StartupSnapshotService.instance.recordUser(user);
+
         LoggingHelper.logDebug('User data retrieved from storage and cached');
         return ResultHelper.success(user);
       }
@@ -136,9 +157,8 @@ class UserStorageService {
         updatedAt: DateTime.now(),
       );
 
-      // Save to SharedPreferences
-      final userJson = json.encode(updatedUser.toJson());
-      await _prefs!.setString(_userDataKey, userJson);
+      // Save to the KV store
+      await _profile!.put(_profileKey, updatedUser.toJson());
 
       // Update cache
       _cacheService.set(
@@ -147,6 +167,8 @@ class UserStorageService {
         duration: const Duration(days: 365),
       );
 
+      StartupSnapshotService.instance.recordUser(updatedUser);
+
       LoggingHelper.logInfo('User data updated successfully');
       return ResultHelper.success(null);
     } catch (e) {
@@ -164,8 +186,7 @@ class UserStorageService {
     try {
       await _ensureInitialized();
 
-      final userData = _prefs!.getString(_userDataKey);
-      return ResultHelper.success(userData != null);
+      return ResultHelper.success(_profile!.containsKey(_profileKey));
     } catch (e) {
       LoggingHelper.logError('Failed to check if user exists',
           source: 'UserStorageService', error: e);
@@ -181,12 +202,14 @@ class UserStorageService {
     try {
       await _ensureInitialized();
 
-      // Remove from SharedPreferences
-      await _prefs!.remove(_userDataKey);
+      // Remove from the KV store
+      await _profile!.delete(_profileKey);
 
       // Remove from cache
       _cacheService.remove(_userCacheKey);
 
+      StartupSnapshotService.instance.recordUser(null);
+
       LoggingHelper.logInfo('User data deleted successfully');
       return ResultHelper.success(null);
     } catch (e) {
@@ -204,12 +227,14 @@ class UserStorageService {
     try {
       await _ensureInitialized();
 
-      // Clear SharedPreferences
-      await _prefs!.remove(_userDataKey);
+      // Clear the KV store table
+      await _profile!.clear();
 
       // Clear cache
       _cacheService.remove(_userCacheKey);
 
+      StartupSnapshotService.instance.recordUser(null);
+
       LoggingHelper.logInfo('All user data cleared successfully');
       return ResultHelper.success(null);
     } catch (e) {
@@ -269,7 +294,7 @@ class UserStorageService {
       return {
         'hasUserData': hasUserData.isSuccess ? hasUserData.value : false,
         'cacheStats': cacheStats,
-        'storageType': 'SharedPreferences + AstrologyCache',
+        'storageType': 'KvStore + AstrologyCache',
       };
     } catch (e) {
       LoggingHelper.logError('Failed to get storage stats',
@@ -283,7 +308,7 @@ class UserStorageService {
   // Private helper methods
 
   Future<void> _ensureInitialized() async {
-    if (_prefs == null) {
+    if (_profile == null) {
       await initialize();
     }
   }
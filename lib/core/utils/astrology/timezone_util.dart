@@ -9,13 +9,16 @@ import 'package:timezone/data/latest.dart' as tz;
 /// Timezone utility for datetime conversions
 class TimezoneUtil {
   static bool _initialized = false;
+  static Future<void>? _initialization;
 
   /// Initialize timezone database
-  static Future<void> initialize() async {
-    if (!_initialized) {
+  ///
+  /// Safe to call from anywhere; every caller shares one initialization.
+  static Future<void> initialize() {
+    return _initialization ??= Future(() {
       tz.initializeTimeZones();
       _initialized = true;
-    }
+    });
   }
 
   /// Get timezone location
@@ -6,6 +6,7 @@ import 'package:flutter_riverpod/flutter_riverpod.dart';
 
 import 'core/config/production_config.dart';
 import 'core/architecture/module_registry.dart';
+import 'core/architecture/startup_scheduler.dart';
 import 'ui/themes/theme_provider.dart';
 import 'ui/themes/app_themes.dart';
 
@@ -29,10 +30,15 @@ import 'core/utils/astrology/timezone_util.dart';
 import 'core/logging/app_logger.dart';
 import 'core/services/notification/daily_prediction_scheduler.dart';
 import 'core/services/notification/daily_prediction_notification_service.dart';
+import 'core/services/startup/startup_snapshot_service.dart';
+import 'core/services/storage/app_kv_store.dart';
 
 Future<void> main() async {
   WidgetsFlutterBinding.ensureInitialized();
 
+  // Created first so the startup timeline covers all of main()
+  final startup = StartupScheduler.instance;
+
   // Set system UI overlay style for production-ready appearance
   SystemChrome.setSystemUIOverlayStyle(
     const SystemUiOverlayStyle(
@@ -49,12 +55,26 @@ Future<void> main() async {
     DeviceOrientation.portraitDown,
   ]);
 
-  // Initialize logging system first (non-blocking - run in background)
-  AppLogger().initialize().catchError((e) {
-    developer.log('Failed to initialize logging system: $e', name: 'main');
-  });
+  // Startup work runs as a dependency graph: critical tasks concurrently
+  // before the first frame, deferred tasks after it
+  startup.register(StartupTask(
+    name: 'logger',
+    run: () => AppLogger().initialize(),
+  ));
+
+  startup.register(StartupTask(
+    name: 'timezone',
+    run: TimezoneUtil.initialize,
+  ));
+
+  // The UI isolate owns the KV store; the background prediction task only
+  // appends to it
+  AppKvStore.isPrimary = true;
+  startup.register(StartupTask(
+    name: 'kv_store',
+    run: AppKvStore.open,
+  ));
 
-  // Initialize module registry (lightweight - just registration)
   try {
     final moduleRegistry = ModuleRegistry();
 
@@ -67,48 +87,54 @@ Future<void> main() async {
     moduleRegistry.registerModule(CalendarModule());
     moduleRegistry.registerModule(PredictionsModule());
 
-    // Initialize all modules in background (non-blocking)
-    moduleRegistry.initializeAll().catchError((e) {
-      developer.log('Failed to initialize modules: $e', name: 'main');
-    });
+    moduleRegistry.scheduleStartup(startup);
   } catch (e) {
     developer.log('Failed to register modules: $e', name: 'main');
   }
 
-  // Initialize timezone utility in background (non-blocking)
-  TimezoneUtil.initialize().catchError((e) {
-    developer.log('Failed to initialize timezone utility: $e', name: 'main');
-  });
+  // Daily prediction services are not critical for app startup
+  // App still works without notifications, so failures are only logged
+  startup.register(StartupTask(
+    name: 'prediction_scheduler',
+    priority: StartupPriority.deferred,
+    dependsOn: const ['timezone'],
+    run: () => DailyPredictionScheduler.instance.initialize(),
+  ));
 
-  // Initialize daily prediction services in background (non-blocking)
-  // These are not critical for app startup
-  Future.microtask(() async {
-    try {
-      final scheduler = DailyPredictionScheduler.instance;
-      await scheduler.initialize();
+  startup.register(StartupTask(
+    name: 'prediction_notifications',
+    priority: StartupPriority.deferred,
+    dependsOn: const ['prediction_scheduler'],
+    run: () => DailyPredictionNotificationService.instance.initialize(),
+  ));
 
-      final notificationService = DailyPredictionNotificationService.instance;
-      await notificationService.initialize();
-    } catch (e) {
-      developer.log('Failed to initialize daily prediction services: $e',
-          name: 'main');
-      // Don't throw - app should still work without notifications
-    }
-  });
+  startup.register(StartupTask(
+    name: 'log_production_config',
+    priority: StartupPriority.deferred,
+    dependsOn: const ['logger'],
+    run: () => AppLogger().info(
+      ProductionConfig.isProduction
+          ? 'Running in production mode'
+          : 'Running in development mode',
+      source: 'main',
+    ),
+  ));
 
-  // Log production configuration (non-blocking)
-  Future.microtask(() async {
-    try {
-      if (ProductionConfig.isProduction) {
-        await AppLogger().info('Running in production mode', source: 'main');
-      } else {
-        await AppLogger().info('Running in development mode', source: 'main');
-      }
-    } catch (e) {
-      developer.log('Failed to log production config: $e', name: 'main');
-    }
+  // Last session's state, so the first frame shows real content
+  startup.register(StartupTask(
+    name: 'startup_snapshot',
+    run: StartupSnapshotService.instance.load,
+  ));
+
+  // Non-blocking - the first frame does not wait on startup tasks
+  startup.start().catchError((e) {
+    developer.log('Failed to run startup tasks: $e', name: 'main');
   });
 
+  // The snapshot is the one task the first frame waits for (a single small
+  // file read; load() never throws)
+  await startup.ensure('startup_snapshot');
+
   runApp(
     const ProviderScope(
       child: MyApp(),
@@ -165,6 +191,16 @@ class _MyAppState extends ConsumerState<MyApp> with WidgetsBindingObserver {
     super.dispose();
   }
 
+  @override
+  void didChangeAppLifecycleState(AppLifecycleState state) {
+    super.didChangeAppLifecycleState(state);
+    if (state == AppLifecycleState.paused ||
+        state == AppLifecycleState.detached) {
+      // Persist the last rendered state for the next cold start
+      StartupSnapshotService.instance.flush();
+    }
+  }
+
   @override
   void didChangePlatformBrightness() {
     super.didChangePlatformBrightness();
@@ -0,0 +1,286 @@
+/// Calendar Mini Month Painter
+///
+/// Paints a whole month of day cells with a single CustomPainter, reading
+/// from the compact day-record store. Digits and symbols come from a cached
+/// glyph atlas so repainting a month lays out no text.
+library;
+
+import 'package:flutter/material.dart';
+import '../../../core/features/astrology/engine/gochara.dart';
+import '../../../core/features/calendar/calendar_day_record_store.dart';
+
+/// Cached, pre-laid-out glyphs (day numbers 1-31 and day symbols)
+///
+/// Keyed by style, so each combination of size/colour/weight is laid out once
+/// and shared by every month that paints with it.
+class CalendarGlyphAtlas {
+  static final Map<_GlyphStyle, Map<String, TextPainter>> _glyphs = {};
+  static const int _maxStyles = 24;
+
+  /// Symbols painted under the day number
+  static const String festivalSymbol = '•';
+  static const String amavasyaSymbol = '●';
+  static const String purnimaSymbol = '○';
+
+  static TextPainter glyph(
+    String text, {
+    required double fontSize,
+    required Color color,
+    FontWeight fontWeight = FontWeight.normal,
+  }) {
+    final style = _GlyphStyle(fontSize, color, fontWeight);
+    final glyphs = _glyphs.putIfAbsent(style, () {
+      if (_glyphs.length >= _maxStyles) {
+        _clearOldestStyle();
+      }
+      return {};
+    });
+    return glyphs.putIfAbsent(text, () {
+      return TextPainter(
+        text: TextSpan(
+          text: text,
+          style: TextStyle(
+            fontSize: fontSize,
+            color: color,
+            fontWeight: fontWeight,
+            height: 1.0,
+          ),
+        ),
+        textDirection: TextDirection.ltr,
+        maxLines: 1,
+      )..layout();
+    });
+  }
+
+  static void _clearOldestStyle() {
+    final oldest = _glyphs.keys.first;
+    for (final painter in _glyphs.remove(oldest)!.values) {
+      painter.dispose();
+    }
+  }
+
+  /// Drop all cached glyphs (e.g. on theme or text scale change)
+  static void clear() {
+    for (final glyphs in _glyphs.values) {
+      for (final painter in glyphs.values) {
+        painter.dispose();
+      }
+    }
+    _glyphs.clear();
+  }
+}
+
+class _GlyphStyle {
+  final double fontSize;
+  final Color color;
+  final FontWeight fontWeight;
+
+  const _GlyphStyle(this.fontSize, this.color, this.fontWeight);
+
+  @override
+  bool operator ==(Object other) =>
+      other is _GlyphStyle &&
+      other.fontSize == fontSize &&
+      other.color == color &&
+      other.fontWeight == fontWeight;
+
+  @override
+  int get hashCode => Object.hash(fontSize, color, fontWeight);
+}
+
+/// Colours used by [CalendarMiniMonthPainter]
+class CalendarMiniMonthColors {
+  final Color text;
+  final Color mutedText;
+  final Color primary;
+  final Color onPrimary;
+  final Color festival;
+
+  /// Heatmap tints of good and difficult transit days
+  final Color good;
+  final Color bad;
+
+  const CalendarMiniMonthColors({
+    required this.text,
+    required this.mutedText,
+    required this.primary,
+    required this.onPrimary,
+    required this.festival,
+    required this.good,
+    required this.bad,
+  });
+
+  @override
+  bool operator ==(Object other) =>
+      other is CalendarMiniMonthColors &&
+      other.text == text &&
+      other.mutedText == mutedText &&
+      other.primary == primary &&
+      other.onPrimary == onPrimary &&
+      other.festival == festival &&
+      other.good == good &&
+      other.bad == bad;
+
+  @override
+  int get hashCode =>
+      Object.hash(text, mutedText, primary, onPrimary, festival, good, bad);
+}
+
+/// Paints a 7-column month grid (Monday first)
+class CalendarMiniMonthPainter extends CustomPainter {
+  final int year;
+  final int month;
+  final CalendarYearRecords? records;
+  final int recordsRevision;
+  final DateTime? today;
+  final DateTime? selectedDate;
+  final CalendarMiniMonthColors colors;
+
+  /// Personal transit scores, painted as a heatmap behind the days
+  final GocharaMatrix? transits;
+
+  CalendarMiniMonthPainter({
+    required this.year,
+    required this.month,
+    required this.records,
+    required this.colors,
+    this.today,
+    this.selectedDate,
+    this.transits,
+  }) : recordsRevision = records?.revision ?? -1;
+
+  /// Score at which the heatmap tint is fully saturated
+  static const int _fullScore = 6;
+
+  /// Rows needed for the month
+  static int weekRows(int year, int month) {
+    final leading = DateTime(year, month, 1).weekday - 1;
+    final daysInMonth = DateTime(year, month + 1, 0).day;
+    return ((leading + daysInMonth) / 7).ceil();
+  }
+
+  bool _isSameDay(DateTime? a, int day) =>
+      a != null && a.year == year && a.month == month && a.day == day;
+
+  @override
+  void paint(Canvas canvas, Size size) {
+    final leading = DateTime(year, month, 1).weekday - 1;
+    final daysInMonth = DateTime(year, month + 1, 0).day;
+    final rows = weekRows(year, month);
+    final cellWidth = size.width / 7;
+    final cellHeight = size.height / rows;
+    final fontSize = (cellHeight * 0.5).clamp(6.0, 14.0).roundToDouble();
+    final symbolSize = (fontSize * 0.6).roundToDouble();
+    final radius = (cellWidth < cellHeight ? cellWidth : cellHeight) * 0.45;
+
+    final highlightPaint = Paint()..color = colors.primary;
+    final todayPaint = Paint()
+      ..color = colors.primary
+      ..style = PaintingStyle.stroke
+      ..strokeWidth = 1;
+    final firstDayIndex = records != null
+        ? CalendarYearRecords.dayOfYear(DateTime(year, month, 1))
+        : 0;
+    final transits = this.transits;
+    final firstTransitDay = transits?.dayOf(DateTime(year, month, 1)) ?? -1;
+    final heatPaint = Paint();
+
+    for (var day = 1; day <= daysInMonth; day++) {
+      final cell = leading + day - 1;
+      final column = cell % 7;
+      final row = cell ~/ 7;
+      final center = Offset(
+        (column + 0.5) * cellWidth,
+        (row + 0.5) * cellHeight,
+      );
+
+      final isSelected = _isSameDay(selectedDate, day);
+      final isToday = _isSameDay(today, day);
+      final flags = records?.flags[firstDayIndex + day - 1] ?? 0;
+      final isFestival = flags & CalendarDayFlags.festival != 0;
+      final isSunday = column == 6;
+
+      final transitDay = firstTransitDay + day - 1;
+      if (transits != null &&
+          firstTransitDay >= 0 &&
+          transitDay < transits.days) {
+        final score = transits.score(transitDay);
+        if (score != 0) {
+          final strength = (score.abs() / _fullScore).clamp(0.0, 1.0);
+          heatPaint.color = (score > 0 ? colors.good : colors.bad)
+              .withAlpha(((0.1 + 0.3 * strength) * 255).round());
+          canvas.drawRRect(
+            RRect.fromRectAndRadius(
+              Rect.fromCenter(
+                  center: center, width: cellWidth - 1, height: cellHeight - 1),
+              Radius.circular(radius * 0.3),
+            ),
+            heatPaint,
+          );
+        }
+      }
+
+      if (isSelected) {
+        canvas.drawCircle(center, radius, highlightPaint);
+      } else if (isToday) {
+        canvas.drawCircle(center, radius, todayPaint);
+      }
+
+      final digit = CalendarGlyphAtlas.glyph(
+        '$day',
+        fontSize: fontSize,
+        color: isSelected
+            ? colors.onPrimary
+            : isFestival || isSunday
+                ? colors.festival
+                : colors.text,
+        fontWeight: isSelected || isToday || isFestival
+            ? FontWeight.bold
+            : FontWeight.normal,
+      );
+      digit.paint(
+        canvas,
+        center - Offset(digit.width / 2, digit.height / 2),
+      );
+
+      // One symbol under the number: festival > amavasya > purnima
+      final symbol = isFestival
+          ? CalendarGlyphAtlas.festivalSymbol
+          : flags & CalendarDayFlags.amavasya != 0
+              ? CalendarGlyphAtlas.amavasyaSymbol
+              : flags & CalendarDayFlags.purnima != 0
+                  ? CalendarGlyphAtlas.purnimaSymbol
+                  : null;
+      if (symbol != null && cellHeight > fontSize + symbolSize) {
+        final glyph = CalendarGlyphAtlas.glyph(
+          symbol,
+          fontSize: symbolSize,
+          color: isSelected
+              ? colors.onPrimary
+              : isFestival
+                  ? colors.festival
+                  : colors.mutedText,
+        );
+        glyph.paint(
+          canvas,
+          Offset(
+            center.dx - glyph.width / 2,
+            center.dy + digit.height / 2 - glyph.height * 0.25,
+          ),
+        );
+      }
+    }
+  }
+
+  @override
+  bool shouldRepaint(CalendarMiniMonthPainter oldDelegate) {
+    return oldDelegate.year != year ||
+        oldDelegate.month != month ||
+        !identical(oldDelegate.records, records) ||
+        oldDelegate.recordsRevision != recordsRevision ||
+        oldDelegate.selectedDate != selectedDate ||
+        oldDelegate.today != today ||
+        oldDelegate.colors != colors ||
+        !identical(oldDelegate.transits, transits);
+  }
+}
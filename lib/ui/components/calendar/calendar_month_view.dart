@@ -10,9 +10,7 @@ import '../../../core/design_system/design_system.dart';
 import '../../../core/services/language/translation_service.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 import 'day_view_popup.dart';
-import '../../../core/services/astrology/astrology_service_bridge.dart';
-import '../../../core/services/location/simple_location_service.dart';
-import '../../../core/utils/astrology/timezone_util.dart';
+import '../../../core/features/calendar/calendar_month_window.dart';
 import '../../../core/services/astrology/astrology_name_service.dart';
 import '../../../core/services/language/language_service.dart';
 
@@ -44,18 +42,56 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
   late Animation<double> _fadeAnimation;
   late DateTime
       _today; // Cache today's date to avoid multiple DateTime.now() calls
-  late ScrollController _scrollController;
-  Map<String, dynamic>? _monthData;
-  bool _isMonthDataLoading = true;
+
+  // Month timeline: page index <-> month, anchored at the initial month
+  static const int _anchorPage = 10000;
+  late DateTime _anchorMonth;
+  late PageController _pageController;
+  late CalendarMonthWindow _window;
 
   @override
   void initState() {
     super.initState();
     _today = DateTime.now(); // Get device's current date once
-    _scrollController = ScrollController();
+    _anchorMonth =
+        DateTime(widget.currentMonth.year, widget.currentMonth.month);
+    _pageController = PageController(initialPage: _anchorPage);
+    _window = _createWindow();
     _initializeAnimations();
   }
 
+  CalendarMonthWindow _createWindow() {
+    // Use ayanamsha as region identifier
+    final window = CalendarMonthWindow(
+      region: widget.ayanamsha,
+      ayanamsha: widget.ayanamsha,
+    );
+    window.addListener(_onWindowChanged);
+    window.setFocus(widget.currentMonth);
+    return window;
+  }
+
+  void _onWindowChanged() {
+    if (mounted) setState(() {});
+  }
+
+  DateTime _monthForPage(int page) =>
+      DateTime(_anchorMonth.year, _anchorMonth.month + (page - _anchorPage));
+
+  int _pageForMonth(DateTime month) =>
+      _anchorPage +
+      (month.year - _anchorMonth.year) * 12 +
+      (month.month - _anchorMonth.month);
+
+  void _onPageChanged(int page) {
+    final month = _monthForPage(page);
+    _window.setFocus(month);
+    if (month.year != widget.currentMonth.year ||
+        month.month != widget.currentMonth.month) {
+      widget.onDateSelected(month);
+    }
+  }
+
   void _initializeAnimations() {
     _animationController = AnimationController(
       duration: const Duration(milliseconds: 300),
@@ -76,14 +112,17 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
   @override
   void dispose() {
     _animationController.dispose();
-    _scrollController.dispose();
+    _pageController.dispose();
+    _window.removeListener(_onWindowChanged);
+    _window.dispose();
     super.dispose();
   }
 
   /// Show detailed day view popup for the selected date
   void _showDetailedDayView(BuildContext context, DateTime date) {
     // Check if month data is still loading
-    if (_isMonthDataLoading) {
+    final slot = _window.slotFor(date);
+    if (slot == null) {
       ScaffoldMessenger.of(context).showSnackBar(
         const SnackBar(
           content: Text('Loading month data, please wait...'),
@@ -93,37 +132,10 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
       return;
     }
 
-    // Find the day data from already cached month data
-    Map<String, dynamic>? dayData;
-
-    print('🔍 DEBUG: _monthData is null: ${_monthData == null}');
-    print('🔍 DEBUG: _isMonthDataLoading: $_isMonthDataLoading');
-
-    if (_monthData != null) {
-      final daysRaw = _monthData!['days'];
-      final days = _convertToListOfMaps(daysRaw);
-      print('🔍 DEBUG: Month data has ${days.length} days');
-      print('🔍 DEBUG: Looking for day ${date.day} in month ${date.month}');
-
-      try {
-        final rawDayData = days.firstWhere(
-          (day) {
-            final dayDate = _parseDateTime(day['date']);
-            return dayDate != null &&
-                dayDate.day == date.day &&
-                dayDate.month == date.month;
-          },
-        );
-        // Transform nested API response to flat structure expected by DayViewPopup
-        dayData = _flattenDayData(rawDayData);
-        print('🔍 DEBUG: Found day data: ${dayData['tithiName'] ?? 'N/A'}');
-      } catch (e) {
-        print('🔍 DEBUG: Day not found in cached data: $e');
-        dayData = null;
-      }
-    } else {
-      print('🔍 DEBUG: Month data is null, cannot extract day data');
-    }
+    // Find the day data from already materialized month data
+    final rawDayData = slot.daysByNumber[date.day];
+    // Transform nested API response to flat structure expected by DayViewPopup
+    final dayData = rawDayData != null ? _flattenDayData(rawDayData) : null;
 
     showDialog(
       context: context,
@@ -139,106 +151,28 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
-  @override
-  void didChangeDependencies() {
-    super.didChangeDependencies();
-    _prefetchMonthAndYear();
-  }
-
   @override
   void didUpdateWidget(CalendarMonthView oldWidget) {
     super.didUpdateWidget(oldWidget);
-    // Reload data if month or ayanamsha changed
-    if (oldWidget.currentMonth.year != widget.currentMonth.year ||
-        oldWidget.currentMonth.month != widget.currentMonth.month ||
-        oldWidget.ayanamsha != widget.ayanamsha) {
-      _prefetchMonthAndYear();
+    // New window if ayanamsha changed
+    if (oldWidget.ayanamsha != widget.ayanamsha) {
+      _window.removeListener(_onWindowChanged);
+      _window.dispose();
+      _window = _createWindow();
     }
-  }
 
-  Future<void> _prefetchMonthAndYear() async {
-    try {
-      setState(() {
-        _isMonthDataLoading = true;
+    // Month changed from outside (year dropdown, year view) - move the timeline
+    if (oldWidget.currentMonth.year != widget.currentMonth.year ||
+        oldWidget.currentMonth.month != widget.currentMonth.month) {
+      final page = _pageForMonth(widget.currentMonth);
+      // Jumping mid-build would notify listeners during the build
+      WidgetsBinding.instance.addPostFrameCallback((_) {
+        if (!mounted || !_pageController.hasClients) return;
+        if (_pageController.page?.round() != page) {
+          _pageController.jumpToPage(page);
+        }
       });
-
-      // Get device location with fallback to country-level location
-      final locationService = SimpleLocationService();
-      final locationResult =
-          await locationService.getDeviceLocationWithFallback();
-
-      if (!locationResult.isSuccess ||
-          locationResult.latitude == null ||
-          locationResult.longitude == null) {
-        throw Exception('Failed to get location: ${locationResult.error}');
-      }
-
-      final latitude = locationResult.latitude!;
-      final longitude = locationResult.longitude!;
-
-      // Get timezone from device or use default
-      await TimezoneUtil.initialize();
-      final timezoneId = _getTimezoneId(latitude, longitude);
-
-      // Get region from location or use default
-      final region = widget.ayanamsha; // Use ayanamsha as region identifier
-
-      // Fetch calendar month data from API through bridge (handles timezone conversions)
-      // Ayanamsha is required for accurate nakshatra, tithi, yoga, karana calculations (sidereal zodiac)
-      final bridge = AstrologyServiceBridge.instance;
-      final monthData = await bridge.getCalendarMonth(
-        year: widget.currentMonth.year,
-        month: widget.currentMonth.month,
-        region: region,
-        latitude: latitude,
-        longitude: longitude,
-        timezoneId: timezoneId,
-        ayanamsha: widget.ayanamsha, // Pass ayanamsha for accurate calculations
-      );
-
-      if (mounted) {
-        setState(() {
-          _monthData = monthData;
-          _isMonthDataLoading = false;
-        });
-      }
-    } catch (e) {
-      if (mounted) {
-        setState(() {
-          _isMonthDataLoading = false;
-        });
-      }
-      debugPrint('Error loading month data: $e');
-    }
-  }
-
-  /// Get timezone ID from coordinates or use default
-  String _getTimezoneId(double latitude, double longitude) {
-    try {
-      // Try to get timezone from coordinates
-      // For simplicity, use a default timezone based on longitude
-      // In production, you might want to use a timezone lookup service
-      final offsetHours = (longitude / 15.0).round();
-
-      // Map common timezones (simplified)
-      if (offsetHours >= 5 && offsetHours <= 6) {
-        return 'Asia/Kolkata'; // India
-      } else if (offsetHours >= -5 && offsetHours <= -4) {
-        return 'America/New_York'; // US East
-      } else if (offsetHours >= -8 && offsetHours <= -7) {
-        return 'America/Los_Angeles'; // US West
-      } else if (offsetHours >= 0 && offsetHours <= 1) {
-        return 'Europe/London'; // UK
-      } else if (offsetHours >= 8 && offsetHours <= 9) {
-        return 'Asia/Shanghai'; // China
-      } else if (offsetHours >= 9 && offsetHours <= 10) {
-        return 'Asia/Tokyo'; // Japan
-      }
-
-      // Default to India timezone
-      return 'Asia/Kolkata';
-    } catch (e) {
-      return 'Asia/Kolkata'; // Default fallback
+      _window.setFocus(widget.currentMonth);
     }
   }
 
@@ -264,19 +198,29 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
+  /// Build error state for a month that failed to load
+  Widget _buildErrorState(BuildContext context, DateTime month) {
+    return Center(
+      child: Column(
+        mainAxisAlignment: MainAxisAlignment.center,
+        children: [
+          Icon(
+            Icons.error_outline,
+            size: ResponsiveSystem.iconSize(context, baseSize: 40),
+            color: ThemeHelpers.getErrorColor(context),
+          ),
+          ResponsiveSystem.sizedBox(context, height: 12),
+          TextButton(
+            onPressed: () => _window.retry(month),
+            child: const Text('Retry'),
+          ),
+        ],
+      ),
+    );
+  }
+
   @override
   Widget build(BuildContext context) {
-    final firstDayOfMonth =
-        DateTime(widget.currentMonth.year, widget.currentMonth.month, 1);
-    final lastDayOfMonth =
-        DateTime(widget.currentMonth.year, widget.currentMonth.month + 1, 0);
-    final firstDayOfWeek = firstDayOfMonth.weekday;
-    final daysInMonth = lastDayOfMonth.day;
-
-    // Calculate total cells needed (including empty cells for days before month starts)
-    final totalCells = firstDayOfWeek - 1 + daysInMonth;
-    final weeks = (totalCells / 7).ceil();
-
     return FadeTransition(
       opacity: _fadeAnimation,
       child: Container(
@@ -293,53 +237,14 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
 
             ResponsiveSystem.sizedBox(context, height: 8),
 
-            // Calendar Grid with proper responsive sizing
+            // Scrollable month timeline, backed by the month window
             Expanded(
-              child: _isMonthDataLoading
-                  ? _buildLoadingState(context)
-                  : LayoutBuilder(
-                      builder: (context, constraints) {
-                        // Calculate responsive cell size based on available space
-                        final availableWidth = constraints.maxWidth;
-                        final availableHeight = constraints.maxHeight;
-
-                        // Calculate cell dimensions based on available space
-                        final spacing =
-                            ResponsiveSystem.spacing(context, baseSpacing: 4);
-                        final cellWidth = (availableWidth - (6 * spacing)) / 7;
-                        final cellHeight =
-                            (availableHeight - ((weeks - 1) * spacing)) / weeks;
-
-                        // Use the smaller dimension to maintain square cells
-                        final cellSize =
-                            cellWidth < cellHeight ? cellWidth : cellHeight;
-                        final aspectRatio = 1.0; // Square cells
-
-                        return GridView.builder(
-                          controller: _scrollController,
-                          physics: const BouncingScrollPhysics(),
-                          gridDelegate:
-                              SliverGridDelegateWithFixedCrossAxisCount(
-                            crossAxisCount: 7,
-                            crossAxisSpacing: spacing,
-                            mainAxisSpacing: spacing,
-                            childAspectRatio: aspectRatio,
-                          ),
-                          itemCount: weeks * 7,
-                          itemBuilder: (context, index) {
-                            final dayIndex = index - (firstDayOfWeek - 1);
-                            if (dayIndex < 0 || dayIndex >= daysInMonth) {
-                              return const SizedBox.shrink();
-                            }
-                            final day = dayIndex + 1;
-                            final date = DateTime(widget.currentMonth.year,
-                                widget.currentMonth.month, day);
-
-                            return _buildDayCell(context, date, day, cellSize);
-                          },
-                        );
-                      },
-                    ),
+              child: PageView.builder(
+                controller: _pageController,
+                onPageChanged: _onPageChanged,
+                itemBuilder: (context, page) =>
+                    _buildMonthPage(context, _monthForPage(page)),
+              ),
             ),
           ],
         ),
@@ -347,6 +252,62 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
+  Widget _buildMonthPage(BuildContext context, DateTime month) {
+    final slot = _window.slotFor(month);
+    if (slot == null) {
+      return _window.errorFor(month) != null
+          ? _buildErrorState(context, month)
+          : _buildLoadingState(context);
+    }
+
+    final firstDayOfMonth = DateTime(month.year, month.month, 1);
+    final lastDayOfMonth = DateTime(month.year, month.month + 1, 0);
+    final firstDayOfWeek = firstDayOfMonth.weekday;
+    final daysInMonth = lastDayOfMonth.day;
+
+    // Calculate total cells needed (including empty cells for days before month starts)
+    final totalCells = firstDayOfWeek - 1 + daysInMonth;
+    final weeks = (totalCells / 7).ceil();
+
+    return LayoutBuilder(
+      builder: (context, constraints) {
+        // Calculate responsive cell size based on available space
+        final availableWidth = constraints.maxWidth;
+        final availableHeight = constraints.maxHeight;
+
+        // Calculate cell dimensions based on available space
+        final spacing = ResponsiveSystem.spacing(context, baseSpacing: 4);
+        final cellWidth = (availableWidth - (6 * spacing)) / 7;
+        final cellHeight = (availableHeight - ((weeks - 1) * spacing)) / weeks;
+
+        // Use the smaller dimension to maintain square cells
+        final cellSize = cellWidth < cellHeight ? cellWidth : cellHeight;
+        final aspectRatio = 1.0; // Square cells
+
+        return GridView.builder(
+          physics: const BouncingScrollPhysics(),
+          gridDelegate: SliverGridDelegateWithFixedCrossAxisCount(
+            crossAxisCount: 7,
+            crossAxisSpacing: spacing,
+            mainAxisSpacing: spacing,
+            childAspectRatio: aspectRatio,
+          ),
+          itemCount: weeks * 7,
+          itemBuilder: (context, index) {
+            final dayIndex = index - (firstDayOfWeek - 1);
+            if (dayIndex < 0 || dayIndex >= daysInMonth) {
+              return const SizedBox.shrink();
+            }
+            final day = dayIndex + 1;
+            final date = DateTime(month.year, month.month, day);
+
+            return _buildDayCell(context, date, day, cellSize, slot);
+          },
+        );
+      },
+    );
+  }
+
   Widget _buildMonthHeader(BuildContext context) {
     const monthNames = [
       'January',
@@ -369,9 +330,10 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
         // Previous Month
         IconButton(
           onPressed: () {
-            final previousMonth = DateTime(
-                widget.currentMonth.year, widget.currentMonth.month - 1);
-            widget.onDateSelected(previousMonth);
+            _pageController.previousPage(
+              duration: const Duration(milliseconds: 250),
+              curve: Curves.easeOut,
+            );
           },
           icon: Icon(
             LucideIcons.chevronLeft,
@@ -404,9 +366,10 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
         // Next Month
         IconButton(
           onPressed: () {
-            final nextMonth = DateTime(
-                widget.currentMonth.year, widget.currentMonth.month + 1);
-            widget.onDateSelected(nextMonth);
+            _pageController.nextPage(
+              duration: const Duration(milliseconds: 250),
+              curve: Curves.easeOut,
+            );
           },
           icon: Icon(
             LucideIcons.chevronRight,
@@ -441,8 +404,8 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
-  Widget _buildDayCell(
-      BuildContext context, DateTime date, int day, double cellSize) {
+  Widget _buildDayCell(BuildContext context, DateTime date, int day,
+      double cellSize, CalendarMonthSlot slot) {
     final isSelected = date.day == widget.selectedDate.day &&
         date.month == widget.selectedDate.month &&
         date.year == widget.selectedDate.year;
@@ -508,7 +471,8 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
 
                 // Hindu info for all days
                 Flexible(
-                  child: _buildHinduInfo(context, date, isSelected, cellSize),
+                  child: _buildHinduInfo(
+                      context, date, isSelected, cellSize, slot),
                 ),
               ],
             ),
@@ -518,26 +482,15 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
-  Widget _buildHinduInfo(
-      BuildContext context, DateTime date, bool isSelected, double cellSize) {
+  Widget _buildHinduInfo(BuildContext context, DateTime date, bool isSelected,
+      double cellSize, CalendarMonthSlot slot) {
     // Get current language and astrology name service
     final languagePrefs = ref.read(languageServiceProvider);
     final currentLanguage = languagePrefs.contentLanguage;
     final astrologyNameService = ref.read(astrologyNameServiceProvider);
 
     // Prefer batch data if present; fallback to old per-day future
-    final daysRaw = _monthData?['days'];
-    final days = _convertToListOfMaps(daysRaw);
-    final dayInfo = days.firstWhere(
-      (d) {
-        final dayDate = _parseDateTime(d['date']);
-        return dayDate != null &&
-            dayDate.year == date.year &&
-            dayDate.month == date.month &&
-            dayDate.day == date.day;
-      },
-      orElse: () => <String, dynamic>{},
-    );
+    final dayInfo = slot.daysByNumber[date.day] ?? <String, dynamic>{};
     if (dayInfo.isNotEmpty) {
       final chips = <Widget>[];
 
@@ -588,7 +541,7 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
 
     // Fallback (rare): compute per day
     return FutureBuilder<Map<String, dynamic>>(
-      future: _getCalendarInfo(date),
+      future: _getCalendarInfo(date, slot.data),
       builder: (context, snapshot) {
         if (!snapshot.hasData || snapshot.data == null)
           return const SizedBox.shrink();
@@ -623,7 +576,8 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
     );
   }
 
-  Future<Map<String, dynamic>> _getCalendarInfo(DateTime date) async {
+  Future<Map<String, dynamic>> _getCalendarInfo(
+      DateTime date, Map<String, dynamic> monthData) async {
     try {
       // Get current language and astrology name service
       final languagePrefs = ref.read(languageServiceProvider);
@@ -631,8 +585,8 @@ class _CalendarMonthViewState extends ConsumerState<CalendarMonthView>
       final astrologyNameService = ref.read(astrologyNameServiceProvider);
 
       // Use month data if available (from API)
-      if (_monthData != null && _monthData!.containsKey('days')) {
-        final daysRaw = _monthData!['days'];
+      if (monthData.containsKey('days')) {
+        final daysRaw = monthData['days'];
         final days = _convertToListOfMaps(daysRaw);
         final dayData = days.firstWhere(
           (day) {
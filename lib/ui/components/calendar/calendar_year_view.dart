@@ -4,11 +4,21 @@
 /// sravanamas, and month-specific information
 library;
 
+import 'package:flutter/foundation.dart';
 import 'package:flutter/material.dart';
 import '../../../core/design_system/design_system.dart';
+import '../../../core/features/astrology/engine/gochara.dart';
+import '../../../core/features/astrology/engine/lunar_calendar.dart';
+import '../../../core/features/calendar/calendar_day_record_store.dart';
 import '../../../core/services/astrology/astrology_service_bridge.dart';
-import '../../../core/services/location/simple_location_service.dart';
-import '../../../core/utils/astrology/timezone_util.dart';
+import '../../../core/features/calendar/calendar_session_context.dart';
+import 'calendar_mini_month_painter.dart';
+
+/// Lunar months of a year, run through [compute] off the UI isolate
+List<LunarMonth> _lunarYear((int, String, MonthConvention) request) {
+  final (year, ayanamsha, convention) = request;
+  return LunarCalendar.year(year, ayanamsha: ayanamsha, convention: convention);
+}
 
 class CalendarYearView extends StatefulWidget {
   final int selectedYear;
@@ -18,10 +28,17 @@ class CalendarYearView extends StatefulWidget {
   final double latitude;
   final double longitude;
   final String ayanamsha;
+
+  /// Calendar region (`RegionAyanamshaMapper` name); picks the lunar
+  /// month convention for names computed on the device
+  final String region;
   final bool showFestivals;
   final bool showAuspiciousTimes;
   final bool showCalendarInfo;
 
+  /// The user's transit matrix for [selectedYear], shown as a heatmap
+  final GocharaMatrix? transits;
+
   const CalendarYearView({
     super.key,
     required this.selectedYear,
@@ -31,9 +48,11 @@ class CalendarYearView extends StatefulWidget {
     required this.latitude,
     required this.longitude,
     this.ayanamsha = 'lahiri',
+    this.region = 'All India',
     this.showFestivals = true,
     this.showAuspiciousTimes = true,
     this.showCalendarInfo = true,
+    this.transits,
   });
 
   @override
@@ -61,9 +80,10 @@ class _CalendarYearViewState extends State<CalendarYearView>
   @override
   void didUpdateWidget(CalendarYearView oldWidget) {
     super.didUpdateWidget(oldWidget);
-    // Reload data if year or ayanamsha changed
+    // Reload data if year, ayanamsha or region changed
     if (oldWidget.selectedYear != widget.selectedYear ||
-        oldWidget.ayanamsha != widget.ayanamsha) {
+        oldWidget.ayanamsha != widget.ayanamsha ||
+        oldWidget.region != widget.region) {
       _loadYearData();
     }
   }
@@ -96,27 +116,18 @@ class _CalendarYearViewState extends State<CalendarYearView>
   Future<void> _loadYearData() async {
     try {
       setState(() {
+        // Keep painting the previous/empty grid while the new year loads
         _isLoading = true;
         _errorMessage = null;
+        _monthFestivals = {};
+        _monthInfo = {};
       });
 
-      // Get device location with fallback to country-level location
-      final locationService = SimpleLocationService();
-      final locationResult =
-          await locationService.getDeviceLocationWithFallback();
-
-      if (!locationResult.isSuccess ||
-          locationResult.latitude == null ||
-          locationResult.longitude == null) {
-        throw Exception('Failed to get location: ${locationResult.error}');
-      }
-
-      final latitude = locationResult.latitude!;
-      final longitude = locationResult.longitude!;
-
-      // Get timezone from device or use default
-      await TimezoneUtil.initialize();
-      final timezoneId = _getTimezoneId(latitude, longitude);
+      // Location and timezone are resolved once per session
+      final session = await CalendarSessionContext.resolve();
+      final latitude = session.latitude;
+      final longitude = session.longitude;
+      final timezoneId = session.timezoneId;
 
       // Get region from location or use default
       final region = widget.ayanamsha; // Use ayanamsha as region identifier
@@ -134,57 +145,69 @@ class _CalendarYearViewState extends State<CalendarYearView>
             .ayanamsha, // Pass ayanamsha for accurate nakshatra calculations
       );
 
+      // Pack per-day records for the painted grid
+      CalendarDayRecordStore.instance
+          .ingestYear(region, widget.selectedYear, yearData);
+
       // Parse API response
+      final months = yearData['months'] as Map<String, dynamic>? ?? {};
       final monthInfo = <int, Map<String, dynamic>>{};
       final monthFestivals = <int, List<String>>{};
 
-      if (yearData.containsKey('months')) {
-        final months = yearData['months'] as Map<String, dynamic>? ?? {};
-        for (int month = 1; month <= 12; month++) {
-          final monthKey = month.toString();
-          if (months.containsKey(monthKey)) {
-            final monthData = months[monthKey] as Map<String, dynamic>;
-            monthInfo[month] = {
-              'monthName': monthData['monthName'] ?? 'Month $month',
-              'season': monthData['season'] ?? 'Not available',
-              'specialPeriods': monthData['specialPeriods'] ?? [],
-              'auspiciousDays': monthData['auspiciousDays'] ?? [],
-            };
-
-            // Extract festivals
-            if (monthData.containsKey('festivals')) {
-              final festivals = monthData['festivals'] as List<dynamic>? ?? [];
-              monthFestivals[month] =
-                  festivals.map((f) => f.toString()).toList();
-            }
-          } else {
-            // Fallback: Use simple defaults if API doesn't have data
-            monthInfo[month] = {
-              'monthName': 'Month $month',
-              'season': 'Not available',
-              'specialPeriods': [],
-              'auspiciousDays': [],
-            };
-          }
+      // Lunar month names computed on device when the server has none: the
+      // month in which the Gregorian month's 15th falls. The sweep takes
+      // long enough to drop frames, so it runs on a background isolate.
+      List<LunarMonth> lunarMonths = const [];
+      final needsLocalNames = [
+        for (int month = 1; month <= 12; month++)
+          (months[month.toString()] as Map<String, dynamic>?)?['hinduMonth'],
+      ].any((name) => name == null);
+      if (needsLocalNames) {
+        lunarMonths = await compute(_lunarYear, (
+          widget.selectedYear,
+          widget.ayanamsha,
+          MonthConvention.forRegion(widget.region),
+        ));
+        if (!mounted) return;
+      }
+      LunarMonth? localMonth(int month) {
+        final middle = DateTime.utc(widget.selectedYear, month, 15, 12);
+        for (final lunar in lunarMonths) {
+          if (lunar.contains(middle)) return lunar;
         }
-      } else {
-        // Fallback: Use simple defaults if API response format is unexpected
-        for (int month = 1; month <= 12; month++) {
-          monthInfo[month] = {
-            'monthName': 'Month $month',
-            'season': 'Not available',
-            'specialPeriods': [],
-            'auspiciousDays': [],
-          };
+        return null;
+      }
+
+      for (int month = 1; month <= 12; month++) {
+        final monthData = months[month.toString()] as Map<String, dynamic>?;
+        final local = monthData?['hinduMonth'] == null
+            ? localMonth(month)
+            : null;
+        monthInfo[month] = {
+          'monthName': monthData?['monthName'] ?? 'Month $month',
+          'hinduMonth': monthData?['hinduMonth'] ?? local?.name,
+          'hinduMonthAdhika':
+              monthData?['hinduMonthAdhika'] ?? local?.adhika ?? false,
+          'season': monthData?['season'] ?? 'Not available',
+          'specialPeriods': monthData?['specialPeriods'] ?? [],
+          'auspiciousDays': monthData?['auspiciousDays'] ?? [],
+        };
+
+        // Extract festivals
+        final festivals = monthData?['festivals'] as List<dynamic>?;
+        if (festivals != null) {
+          monthFestivals[month] = festivals.map((f) => f.toString()).toList();
         }
       }
 
+      if (!mounted) return;
       setState(() {
         _monthFestivals = monthFestivals;
         _monthInfo = monthInfo;
         _isLoading = false;
       });
     } catch (e) {
+      if (!mounted) return;
       setState(() {
         _errorMessage = 'Error loading year data: $e';
         _isLoading = false;
@@ -192,36 +215,6 @@ class _CalendarYearViewState extends State<CalendarYearView>
     }
   }
 
-  /// Get timezone ID from coordinates or use default
-  String _getTimezoneId(double latitude, double longitude) {
-    try {
-      // Try to get timezone from coordinates
-      // For simplicity, use a default timezone based on longitude
-      // In production, you might want to use a timezone lookup service
-      final offsetHours = (longitude / 15.0).round();
-
-      // Map common timezones (simplified)
-      if (offsetHours >= 5 && offsetHours <= 6) {
-        return 'Asia/Kolkata'; // India
-      } else if (offsetHours >= -5 && offsetHours <= -4) {
-        return 'America/New_York'; // US East
-      } else if (offsetHours >= -8 && offsetHours <= -7) {
-        return 'America/Los_Angeles'; // US West
-      } else if (offsetHours >= 0 && offsetHours <= 1) {
-        return 'Europe/London'; // UK
-      } else if (offsetHours >= 8 && offsetHours <= 9) {
-        return 'Asia/Shanghai'; // China
-      } else if (offsetHours >= 9 && offsetHours <= 10) {
-        return 'Asia/Tokyo'; // Japan
-      }
-
-      // Default to India timezone
-      return 'Asia/Kolkata';
-    } catch (e) {
-      return 'Asia/Kolkata'; // Default fallback
-    }
-  }
-
   @override
   void dispose() {
     _animationController.dispose();
@@ -230,40 +223,27 @@ class _CalendarYearViewState extends State<CalendarYearView>
 
   @override
   Widget build(BuildContext context) {
-    if (_isLoading) {
-      return _buildLoadingView(context);
-    }
-
     if (_errorMessage != null) {
       return _buildErrorView(context);
     }
 
+    // The grid is painted from the day-record store, so it never waits on
+    // the network; month details fill in when the year data arrives.
     return FadeTransition(
       opacity: _fadeAnimation,
       child: SlideTransition(
         position: _slideAnimation,
-        child: _buildYearGrid(context),
-      ),
-    );
-  }
-
-  Widget _buildLoadingView(BuildContext context) {
-    return Container(
-      padding: ResponsiveSystem.all(context, baseSpacing: 32),
-      child: Column(
-        mainAxisAlignment: MainAxisAlignment.center,
-        children: [
-          CircularProgressIndicator(
-            color: ThemeHelpers.getPrimaryColor(context),
-          ),
-          ResponsiveSystem.sizedBox(context, height: 16),
-          Text(
-            'Loading year information...',
-            style: Theme.of(context).textTheme.bodyMedium?.copyWith(
-                  color: ThemeHelpers.getPrimaryTextColor(context),
-                ),
-          ),
-        ],
+        child: Column(
+          children: [
+            if (_isLoading)
+              LinearProgressIndicator(
+                minHeight: ResponsiveSystem.spacing(context, baseSpacing: 2),
+                color: ThemeHelpers.getPrimaryColor(context),
+                backgroundColor: ThemeHelpers.getTransparentColor(context),
+              ),
+            Expanded(child: _buildYearGrid(context)),
+          ],
+        ),
       ),
     );
   }
@@ -297,99 +277,134 @@ class _CalendarYearViewState extends State<CalendarYearView>
     );
   }
 
+  /// Month that gets interactive day widgets (selected, else current)
+  int get _focusedMonth {
+    if (widget.selectedDate.year == widget.selectedYear) {
+      return widget.selectedDate.month;
+    }
+    final now = DateTime.now();
+    return now.year == widget.selectedYear ? now.month : 1;
+  }
+
   Widget _buildYearGrid(BuildContext context) {
+    final records = CalendarDayRecordStore.instance
+        .recordsFor(widget.ayanamsha, widget.selectedYear);
+    final colors = CalendarMiniMonthColors(
+      text: ThemeHelpers.getPrimaryTextColor(context),
+      mutedText: ThemeHelpers.getSecondaryTextColor(context),
+      primary: ThemeHelpers.getPrimaryColor(context),
+      onPrimary: ThemeHelpers.getSurfaceColor(context),
+      festival: ThemeHelpers.getErrorColor(context),
+      good: ThemeHelpers.getSuccessColor(context),
+      bad: ThemeHelpers.getErrorColor(context),
+    );
+    final now = DateTime.now();
+    final today = DateTime(now.year, now.month, now.day);
+    final focusedMonth = _focusedMonth;
+
     return GridView.builder(
       padding: ResponsiveSystem.all(context, baseSpacing: 16),
       gridDelegate: const SliverGridDelegateWithFixedCrossAxisCount(
         crossAxisCount: 3,
         crossAxisSpacing: 12,
         mainAxisSpacing: 12,
-        childAspectRatio: 1.2,
+        childAspectRatio: 0.8,
       ),
       itemCount: 12,
       itemBuilder: (context, index) {
         final month = index + 1;
-        final monthDate = DateTime(widget.selectedYear, month);
-        final isCurrentMonth = month == DateTime.now().month &&
-            widget.selectedYear == DateTime.now().year;
+        final isCurrentMonth =
+            month == now.month && widget.selectedYear == now.year;
         final isSelectedMonth = month == widget.selectedDate.month &&
             widget.selectedYear == widget.selectedDate.year;
 
         return _buildMonthCard(
-            context, month, monthDate, isCurrentMonth, isSelectedMonth);
+          context,
+          month: month,
+          records: records,
+          colors: colors,
+          today: today,
+          isCurrentMonth: isCurrentMonth,
+          isSelectedMonth: isSelectedMonth,
+          isFocused: month == focusedMonth,
+        );
       },
     );
   }
 
-  Widget _buildMonthCard(BuildContext context, int month, DateTime monthDate,
-      bool isCurrentMonth, bool isSelectedMonth) {
+  Widget _buildMonthCard(
+    BuildContext context, {
+    required int month,
+    required CalendarYearRecords? records,
+    required CalendarMiniMonthColors colors,
+    required DateTime today,
+    required bool isCurrentMonth,
+    required bool isSelectedMonth,
+    required bool isFocused,
+  }) {
+    final monthDate = DateTime(widget.selectedYear, month);
     final monthInfo = _monthInfo[month] ?? {};
-    final festivals = _monthFestivals[month] ?? [];
+    final festivalCount =
+        records?.festivalCount(month) ?? _monthFestivals[month]?.length ?? 0;
+
+    final painter = RepaintBoundary(
+      child: CustomPaint(
+        size: Size.infinite,
+        painter: CalendarMiniMonthPainter(
+          year: widget.selectedYear,
+          month: month,
+          records: records,
+          colors: colors,
+          today: today,
+          selectedDate: widget.selectedDate,
+          transits: widget.transits,
+        ),
+      ),
+    );
 
     return GestureDetector(
       onTap: () => widget.onMonthSelected(monthDate),
       child: Container(
         decoration: BoxDecoration(
-          color: isSelectedMonth
+          color: isCurrentMonth
               ? ThemeHelpers.getPrimaryColor(context)
-              : isCurrentMonth
-                  ? ThemeHelpers.getPrimaryColor(context)
-                      .withAlpha((0.2 * 255).round())
-                  : ThemeHelpers.getSurfaceColor(context),
+                  .withAlpha((0.1 * 255).round())
+              : ThemeHelpers.getSurfaceColor(context),
           borderRadius: ResponsiveSystem.circular(context, baseRadius: 12),
           border: Border.all(
-            color: isSelectedMonth
+            color: isSelectedMonth || isCurrentMonth
                 ? ThemeHelpers.getPrimaryColor(context)
-                : isCurrentMonth
-                    ? ThemeHelpers.getPrimaryColor(context)
-                    : ThemeHelpers.getSecondaryTextColor(context)
-                        .withAlpha((0.3 * 255).round()),
-            width: ResponsiveSystem.borderWidth(context, baseWidth: 1),
+                : ThemeHelpers.getSecondaryTextColor(context)
+                    .withAlpha((0.3 * 255).round()),
+            width: ResponsiveSystem.borderWidth(context,
+                baseWidth: isSelectedMonth ? 2 : 1),
           ),
-          boxShadow: isSelectedMonth
-              ? [
-                  BoxShadow(
-                    color: ThemeHelpers.getPrimaryColor(context)
-                        .withAlpha((0.3 * 255).round()),
-                    blurRadius:
-                        ResponsiveSystem.spacing(context, baseSpacing: 8),
-                    offset: Offset(
-                        0, ResponsiveSystem.spacing(context, baseSpacing: 4)),
-                  ),
-                ]
-              : null,
         ),
         child: Padding(
-          padding: ResponsiveSystem.all(context, baseSpacing: 12),
+          padding: ResponsiveSystem.all(context, baseSpacing: 8),
           child: Column(
             crossAxisAlignment: CrossAxisAlignment.start,
             children: [
-              // Month name and year
-              _buildMonthHeader(
-                  context, month, isCurrentMonth, isSelectedMonth),
-
-              ResponsiveSystem.sizedBox(context, height: 8),
+              // Month name and festivals count
+              _buildMonthHeader(context, month, festivalCount, isCurrentMonth),
 
               // Hindu month name
-              _buildHinduMonthName(
-                  context, monthInfo, isCurrentMonth, isSelectedMonth),
-
-              ResponsiveSystem.sizedBox(context, height: 8),
-
-              // Season
-              _buildSeason(context, monthInfo, isCurrentMonth, isSelectedMonth),
-
-              ResponsiveSystem.sizedBox(context, height: 8),
-
-              // Festivals count
-              _buildFestivalsInfo(
-                  context, festivals, isCurrentMonth, isSelectedMonth),
+              _buildHinduMonthName(context, monthInfo, isCurrentMonth),
 
               ResponsiveSystem.sizedBox(context, height: 4),
 
-              // Special periods
-              _buildSpecialPeriods(
-                  context, monthInfo, isCurrentMonth, isSelectedMonth),
+              // Day cells - painted, interactive only for the focused month
+              Expanded(
+                child: isFocused
+                    ? Stack(
+                        fit: StackFit.expand,
+                        children: [
+                          painter,
+                          _buildFocusedMonthHitTargets(month),
+                        ],
+                      )
+                    : painter,
+              ),
             ],
           ),
         ),
@@ -397,8 +412,42 @@ class _CalendarYearViewState extends State<CalendarYearView>
     );
   }
 
-  Widget _buildMonthHeader(BuildContext context, int month, bool isCurrentMonth,
-      bool isSelectedMonth) {
+  /// Transparent tap targets over the painted days of the focused month
+  Widget _buildFocusedMonthHitTargets(int month) {
+    final leading = DateTime(widget.selectedYear, month, 1).weekday - 1;
+    final daysInMonth = DateTime(widget.selectedYear, month + 1, 0).day;
+    final rows = CalendarMiniMonthPainter.weekRows(widget.selectedYear, month);
+
+    return Column(
+      children: List.generate(rows, (row) {
+        return Expanded(
+          child: Row(
+            children: List.generate(7, (column) {
+              final day = row * 7 + column - leading + 1;
+              if (day < 1 || day > daysInMonth) {
+                return const Expanded(child: SizedBox.shrink());
+              }
+              final date = DateTime(widget.selectedYear, month, day);
+              return Expanded(
+                child: Semantics(
+                  button: true,
+                  label: '$day',
+                  child: GestureDetector(
+                    behavior: HitTestBehavior.opaque,
+                    onTap: () => widget.onDateSelected(date),
+                    onDoubleTap: () => widget.onMonthSelected(date),
+                  ),
+                ),
+              );
+            }),
+          ),
+        );
+      }),
+    );
+  }
+
+  Widget _buildMonthHeader(BuildContext context, int month, int festivalCount,
+      bool isCurrentMonth) {
     const monthNames = [
       'Jan',
       'Feb',
@@ -414,158 +463,63 @@ class _CalendarYearViewState extends State<CalendarYearView>
       'Dec'
     ];
 
+    final color = isCurrentMonth
+        ? ThemeHelpers.getPrimaryColor(context)
+        : ThemeHelpers.getPrimaryTextColor(context);
+
     return Row(
       children: [
         Expanded(
           child: Text(
             monthNames[month - 1],
             style: Theme.of(context).textTheme.titleMedium?.copyWith(
-                  color: isSelectedMonth
-                      ? ThemeHelpers.getSurfaceColor(context)
-                      : isCurrentMonth
-                          ? ThemeHelpers.getPrimaryColor(context)
-                          : ThemeHelpers.getPrimaryTextColor(context),
+                  color: color,
                   fontWeight: FontWeight.bold,
-                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 16),
+                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
                 ),
           ),
         ),
-        Text(
-          '${widget.selectedYear}',
-          style: Theme.of(context).textTheme.bodySmall?.copyWith(
-                color: isSelectedMonth
-                    ? ThemeHelpers.getSurfaceColor(context)
-                        .withAlpha((0.8 * 255).round())
-                    : isCurrentMonth
-                        ? ThemeHelpers.getPrimaryColor(context)
-                            .withAlpha((0.8 * 255).round())
-                        : ThemeHelpers.getSecondaryTextColor(context),
-                fontSize: ResponsiveSystem.fontSize(context, baseSize: 12),
-              ),
-        ),
+        if (festivalCount > 0) ...[
+          Icon(
+            Icons.celebration,
+            size: ResponsiveSystem.iconSize(context, baseSize: 10),
+            color: ThemeHelpers.getSecondaryTextColor(context),
+          ),
+          ResponsiveSystem.sizedBox(context, width: 2),
+          Text(
+            '$festivalCount',
+            style: Theme.of(context).textTheme.bodySmall?.copyWith(
+                  color: ThemeHelpers.getSecondaryTextColor(context),
+                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 10),
+                ),
+          ),
+        ],
       ],
     );
   }
 
-  Widget _buildHinduMonthName(
-      BuildContext context,
-      Map<String, dynamic> monthInfo,
-      bool isCurrentMonth,
-      bool isSelectedMonth) {
+  Widget _buildHinduMonthName(BuildContext context,
+      Map<String, dynamic> monthInfo, bool isCurrentMonth) {
     final hinduMonth = monthInfo['hinduMonth'] as String? ?? '';
+    if (hinduMonth.isEmpty) return const SizedBox.shrink();
+    final adhika = monthInfo['hinduMonthAdhika'] == true;
 
-    return Text(
+    final text = Text(
       hinduMonth,
-      style: Theme.of(context).textTheme.bodyMedium?.copyWith(
-            color: isSelectedMonth
-                ? ThemeHelpers.getSurfaceColor(context)
-                    .withAlpha((0.9 * 255).round())
-                : isCurrentMonth
-                    ? ThemeHelpers.getPrimaryColor(context)
-                        .withAlpha((0.9 * 255).round())
-                    : ThemeHelpers.getSecondaryTextColor(context),
-            fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
+      maxLines: 1,
+      overflow: TextOverflow.ellipsis,
+      style: Theme.of(context).textTheme.bodySmall?.copyWith(
+            color: isCurrentMonth
+                ? ThemeHelpers.getPrimaryColor(context)
+                : ThemeHelpers.getSecondaryTextColor(context),
+            fontSize: ResponsiveSystem.fontSize(context, baseSize: 10),
             fontWeight: FontWeight.w600,
+            // Intercalary months read apart from the regular ones
+            fontStyle: adhika ? FontStyle.italic : FontStyle.normal,
           ),
     );
-  }
-
-  Widget _buildSeason(BuildContext context, Map<String, dynamic> monthInfo,
-      bool isCurrentMonth, bool isSelectedMonth) {
-    final season = monthInfo['season'] as String? ?? '';
-
-    return Container(
-      padding: ResponsiveSystem.symmetric(context, horizontal: 8, vertical: 4),
-      decoration: BoxDecoration(
-        color: isSelectedMonth
-            ? ThemeHelpers.getSurfaceColor(context)
-                .withAlpha((0.2 * 255).round())
-            : ThemeHelpers.getPrimaryColor(context)
-                .withAlpha((0.1 * 255).round()),
-        borderRadius: ResponsiveSystem.circular(context, baseRadius: 6),
-      ),
-      child: Text(
-        season,
-        style: Theme.of(context).textTheme.bodySmall?.copyWith(
-              color: isSelectedMonth
-                  ? ThemeHelpers.getSurfaceColor(context)
-                  : isCurrentMonth
-                      ? ThemeHelpers.getPrimaryColor(context)
-                      : ThemeHelpers.getPrimaryTextColor(context),
-              fontSize: ResponsiveSystem.fontSize(context, baseSize: 10),
-              fontWeight: FontWeight.w500,
-            ),
-      ),
-    );
-  }
-
-  Widget _buildFestivalsInfo(BuildContext context, List<String> festivals,
-      bool isCurrentMonth, bool isSelectedMonth) {
-    return Row(
-      children: [
-        Icon(
-          Icons.celebration,
-          size: ResponsiveSystem.iconSize(context, baseSize: 12),
-          color: isSelectedMonth
-              ? ThemeHelpers.getSurfaceColor(context)
-              : isCurrentMonth
-                  ? ThemeHelpers.getPrimaryColor(context)
-                  : ThemeHelpers.getSecondaryTextColor(context),
-        ),
-        ResponsiveSystem.sizedBox(context, width: 4),
-        Text(
-          '${festivals.length} festivals',
-          style: Theme.of(context).textTheme.bodySmall?.copyWith(
-                color: isSelectedMonth
-                    ? ThemeHelpers.getSurfaceColor(context)
-                    : isCurrentMonth
-                        ? ThemeHelpers.getPrimaryColor(context)
-                        : ThemeHelpers.getSecondaryTextColor(context),
-                fontSize: ResponsiveSystem.fontSize(context, baseSize: 10),
-              ),
-        ),
-      ],
-    );
-  }
-
-  Widget _buildSpecialPeriods(
-      BuildContext context,
-      Map<String, dynamic> monthInfo,
-      bool isCurrentMonth,
-      bool isSelectedMonth) {
-    final specialPeriods = monthInfo['specialPeriods'] as List<String>? ?? [];
-
-    if (specialPeriods.isEmpty) return const SizedBox.shrink();
-
-    return Wrap(
-      spacing: 4,
-      runSpacing: 2,
-      children: specialPeriods.take(2).map((period) {
-        return Container(
-          padding:
-              ResponsiveSystem.symmetric(context, horizontal: 6, vertical: 2),
-          decoration: BoxDecoration(
-            color: isSelectedMonth
-                ? ThemeHelpers.getSurfaceColor(context)
-                    .withAlpha((0.3 * 255).round())
-                : ThemeHelpers.getPrimaryColor(context)
-                    .withAlpha((0.2 * 255).round()),
-            borderRadius: ResponsiveSystem.circular(context, baseRadius: 4),
-          ),
-          child: Text(
-            period,
-            style: Theme.of(context).textTheme.bodySmall?.copyWith(
-                  color: isSelectedMonth
-                      ? ThemeHelpers.getSurfaceColor(context)
-                      : isCurrentMonth
-                          ? ThemeHelpers.getPrimaryColor(context)
-                          : ThemeHelpers.getPrimaryTextColor(context),
-                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 8),
-                  fontWeight: FontWeight.w500,
-                ),
-          ),
-        );
-      }).toList(),
-    );
+    return adhika
+        ? Tooltip(message: 'Adhika (intercalary) month', child: text)
+        : text;
   }
 }
@@ -4,6 +4,7 @@
 /// Similar to Amazon Kindle or Google Play Books with physical book-like appearance
 library;
 
+import 'dart:async';
 import 'dart:convert';
 import 'package:flutter/material.dart';
 import 'package:flutter/foundation.dart' show kIsWeb;
@@ -14,6 +15,7 @@ import '../../../core/logging/logging_helper.dart';
 import '../../../core/utils/validation/error_message_helper.dart';
 import 'content_language_dropdown.dart';
 import '../../../core/services/content/content_api_service.dart';
+import '../../../core/services/content/book_prefetch_service.dart';
 import '../../../core/services/content/content_api_service_stub.dart'
     if (dart.library.io) '../../../core/services/content/content_api_service_mobile.dart';
 
@@ -209,6 +211,10 @@ class _BookReaderWidgetState extends ConsumerState<BookReaderWidget> {
   DateTime? _lastTapTime;
   String? _currentBookUrl; // Track current book URL to detect changes
 
+  /// Blocks applied to the pages of a book opened from local blocks; null
+  /// when the whole book was loaded
+  Set<int>? _appliedBlocks;
+
   @override
   void initState() {
     super.initState();
@@ -235,6 +241,11 @@ class _BookReaderWidgetState extends ConsumerState<BookReaderWidget> {
       });
     }
 
+    // Open instantly from local page blocks when the book is stored on device
+    if (await _openFromLocal()) {
+      return;
+    }
+
     try {
       // Download book from URL (JSON format)
       String jsonString;
@@ -394,12 +405,33 @@ class _BookReaderWidgetState extends ConsumerState<BookReaderWidget> {
       }
 
       final bookData = BookData.fromJson(jsonData);
+      final bookUrl = widget.bookUrl;
 
-      if (mounted) {
+      // Keep the book on device as compressed page blocks for next time
+      BookPrefetchService.instance.storeBook(
+        bookUrl,
+        title: bookData.title,
+        author: bookData.author,
+        language: bookData.language,
+        pages: bookData.pages
+            .map((page) => {
+                  'pageNumber': page.pageNumber,
+                  'content': page.content,
+                  'title': page.title,
+                })
+            .toList(),
+      );
+
+      final progress = await BookPrefetchService.instance.getProgress(bookUrl);
+      final savedPage = (progress?.pageIndex ?? 0)
+          .clamp(0, bookData.pages.isEmpty ? 0 : bookData.pages.length - 1);
+
+      if (mounted && bookUrl == widget.bookUrl) {
         setState(() {
           _bookData = bookData;
+          _appliedBlocks = null;
           _isLoading = false;
-          _currentPageIndex = 0; // Reset to first page on language change
+          _currentPageIndex = savedPage; // Resume at the saved page
           _errorMessage = null;
         });
       }
@@ -417,11 +449,116 @@ class _BookReaderWidgetState extends ConsumerState<BookReaderWidget> {
     }
   }
 
+  /// Open the book from local page blocks at the saved page
+  ///
+  /// Only the block containing the saved page is read before the first frame;
+  /// the blocks around it follow, and later ones as the reader gets near.
+  Future<bool> _openFromLocal() async {
+    final prefetch = BookPrefetchService.instance;
+    if (!prefetch.isSupported) return false;
+
+    final bookUrl = widget.bookUrl;
+    try {
+      final meta = await prefetch.loadMeta(bookUrl);
+      if (meta == null || meta.totalPages == 0) return false;
+
+      final progress = await prefetch.getProgress(bookUrl);
+      final savedPage =
+          (progress?.pageIndex ?? 0).clamp(0, meta.totalPages - 1);
+      final startBlock = BookPrefetchService.blockForPage(savedPage);
+      final block = await prefetch.loadBlock(bookUrl, startBlock);
+      if (block == null) return false;
+
+      // Placeholders for pages whose block hasn't been read yet
+      final pages = List<BookPage>.generate(
+        meta.totalPages,
+        (index) => BookPage(pageNumber: index + 1, content: ''),
+      );
+      _applyBlock(pages, startBlock, block);
+
+      if (!mounted || bookUrl != widget.bookUrl) return true;
+      setState(() {
+        _bookData = BookData(
+          title: meta.title,
+          author: meta.author,
+          totalPages: meta.totalPages,
+          pages: pages,
+          language: meta.language,
+        );
+        _appliedBlocks = {startBlock};
+        _isLoading = false;
+        _currentPageIndex = savedPage;
+        _errorMessage = null;
+      });
+
+      LoggingHelper.logInfo(
+        'Opened book from local blocks at page ${savedPage + 1}',
+        source: 'BookReaderWidget',
+      );
+
+      unawaited(_loadAround(bookUrl, savedPage));
+      return true;
+    } catch (e) {
+      LoggingHelper.logError('Failed to open book from local storage',
+          source: 'BookReaderWidget', error: e);
+      return false;
+    }
+  }
+
+  void _applyBlock(
+    List<BookPage> pages,
+    int blockIndex,
+    List<Map<String, dynamic>> block,
+  ) {
+    final start = blockIndex * BookPrefetchService.pagesPerBlock;
+    for (var i = 0; i < block.length && start + i < pages.length; i++) {
+      final page = block[i];
+      pages[start + i] = BookPage(
+        pageNumber: page['pageNumber'] as int? ?? start + i + 1,
+        content: page['content'] as String? ?? '',
+        title: page['title'] as String?,
+      );
+    }
+  }
+
+  /// Apply the blocks [BookPrefetchService.prefetchAhead] loads around
+  /// [pageIndex] that aren't on the pages yet
+  Future<void> _loadAround(String bookUrl, int pageIndex) async {
+    final blocks =
+        await BookPrefetchService.instance.prefetchAhead(bookUrl, pageIndex);
+    final applied = _appliedBlocks;
+    if (!mounted || bookUrl != widget.bookUrl || applied == null) return;
+    final fresh = [
+      for (final entry in blocks.entries)
+        if (!applied.contains(entry.key)) entry,
+    ];
+    if (fresh.isEmpty) return;
+    setState(() {
+      for (final entry in fresh) {
+        _applyBlock(_bookData!.pages, entry.key, entry.value);
+        applied.add(entry.key);
+      }
+    });
+  }
+
+  void _onPageChanged() {
+    if (_bookData == null) return;
+    BookPrefetchService.instance.recordPageTurn(
+      widget.bookUrl,
+      _currentPageIndex,
+      _bookData!.pages.length,
+    );
+    if (_appliedBlocks != null) {
+      unawaited(_loadAround(widget.bookUrl, _currentPageIndex));
+    }
+  }
+
   void _nextPage() {
     if (_bookData != null && _currentPageIndex < _bookData!.pages.length - 1) {
       setState(() {
         _currentPageIndex++; // Go to next page (increase page number)
       });
+      _onPageChanged();
     }
   }
 
@@ -430,6 +567,7 @@ class _BookReaderWidgetState extends ConsumerState<BookReaderWidget> {
       setState(() {
         _currentPageIndex--; // Go to previous page (decrease page number)
       });
+      _onPageChanged();
     }
   }
 
@@ -0,0 +1,250 @@
+/// Kundali Chart
+///
+/// Draws a birth chart diagram from a cached [KundaliDisplayList]. The
+/// diagram is recorded once per (chart, style) into pictures at a fixed
+/// reference size; rebuilds, theme changes and animations only scale and
+/// tint the cached pictures.
+library;
+
+import 'dart:collection';
+import 'dart:ui' as ui;
+import 'package:flutter/material.dart';
+import '../../../core/features/horoscope/chart/kundali_layout.dart';
+
+/// Recorded pictures for one display list
+///
+/// Lines and glyphs are recorded in opaque white so they can be tinted to any
+/// theme colour at paint time without re-recording.
+class KundaliPictures {
+  final ui.Picture lines;
+  final ui.Picture glyphs;
+  final ui.Picture aspects;
+
+  const KundaliPictures(this.lines, this.glyphs, this.aspects);
+}
+
+/// LRU cache of recorded kundali pictures, keyed by display list key
+///
+/// Evicted pictures are not disposed: a painter built before the eviction
+/// may still draw them, and they are freed once no painter holds them.
+class KundaliPictureCache {
+  static const double referenceSize = 1000.0;
+  static const int _maxEntries = 12;
+
+  static final LinkedHashMap<String, KundaliPictures> _entries =
+      LinkedHashMap();
+
+  /// Get (or record once) the pictures for [list]
+  static KundaliPictures picturesFor(KundaliDisplayList list) {
+    final cached = _entries.remove(list.key);
+    if (cached != null) {
+      _entries[list.key] = cached; // Mark most recently used
+      return cached;
+    }
+
+    final pictures = KundaliPictures(
+      _recordLines(list),
+      _recordGlyphs(list),
+      _recordAspects(list),
+    );
+    _entries[list.key] = pictures;
+    while (_entries.length > _maxEntries) {
+      _entries.remove(_entries.keys.first);
+    }
+    return pictures;
+  }
+
+  /// Drop all recorded pictures
+  static void clear() => _entries.clear();
+
+  static ui.Picture _recordLines(KundaliDisplayList list) {
+    final recorder = ui.PictureRecorder();
+    final canvas = Canvas(recorder);
+    const size = referenceSize;
+    final paint = Paint()
+      ..color = Colors.white
+      ..style = PaintingStyle.stroke
+      ..strokeWidth = 4
+      ..strokeJoin = StrokeJoin.round;
+
+    canvas.drawRect(const Rect.fromLTWH(2, 2, size - 4, size - 4), paint);
+
+    final path = Path();
+    for (var cell = 0; cell < list.cellCount; cell++) {
+      final start = list.cellOffsets[cell];
+      final end = list.cellOffsets[cell + 1];
+      path.moveTo(
+        list.points[start * 2] * size,
+        list.points[start * 2 + 1] * size,
+      );
+      for (var i = start + 1; i < end; i++) {
+        path.lineTo(list.points[i * 2] * size, list.points[i * 2 + 1] * size);
+      }
+      path.close();
+    }
+    canvas.drawPath(path, paint);
+
+    final frame = list.frameLines;
+    for (var i = 0; i + 3 < frame.length; i += 4) {
+      canvas.drawLine(
+        Offset(frame[i] * size, frame[i + 1] * size),
+        Offset(frame[i + 2] * size, frame[i + 3] * size),
+        paint,
+      );
+    }
+
+    return recorder.endRecording();
+  }
+
+  static ui.Picture _recordGlyphs(KundaliDisplayList list) {
+    final recorder = ui.PictureRecorder();
+    final canvas = Canvas(recorder);
+    const size = referenceSize;
+    final baseFontSize = KundaliLayout.glyphHeight * size * 0.8;
+
+    for (final glyph in list.glyphs) {
+      final painter = TextPainter(
+        text: TextSpan(
+          text: glyph.label,
+          style: TextStyle(
+            color: Colors.white,
+            fontSize: baseFontSize * glyph.scale,
+            fontWeight: glyph.kind == KundaliGlyphKind.planet
+                ? FontWeight.w600
+                : FontWeight.normal,
+            height: 1.0,
+          ),
+        ),
+        textDirection: TextDirection.ltr,
+        maxLines: 1,
+      )..layout();
+      painter.paint(
+        canvas,
+        Offset(
+          glyph.x * size - painter.width / 2,
+          glyph.y * size - painter.height / 2,
+        ),
+      );
+      painter.dispose();
+    }
+
+    return recorder.endRecording();
+  }
+
+  static ui.Picture _recordAspects(KundaliDisplayList list) {
+    final recorder = ui.PictureRecorder();
+    final canvas = Canvas(recorder);
+    const size = referenceSize;
+    final paint = Paint()
+      ..color = Colors.white
+      ..style = PaintingStyle.stroke
+      ..strokeWidth = 2;
+
+    // One line per distinct cell pair, however many planets share it
+    final drawn = <int>{};
+    for (final aspect in list.aspects) {
+      final pair = aspect.fromCell < aspect.toCell
+          ? aspect.fromCell * 16 + aspect.toCell
+          : aspect.toCell * 16 + aspect.fromCell;
+      if (!drawn.add(pair)) continue;
+      final (x1, y1) = list.cellCentroid(aspect.fromCell);
+      final (x2, y2) = list.cellCentroid(aspect.toCell);
+      canvas.drawLine(
+        Offset(x1 * size, y1 * size),
+        Offset(x2 * size, y2 * size),
+        paint,
+      );
+    }
+
+    return recorder.endRecording();
+  }
+}
+
+/// Kundali Chart widget
+///
+/// Square chart for [birthChart] in [style]. Layout and recording happen on
+/// first use of a (chart, style) pair; later builds reuse the cache.
+class KundaliChart extends StatelessWidget {
+  final Map<String, dynamic> birthChart;
+  final KundaliChartStyle style;
+  final Color lineColor;
+  final Color glyphColor;
+  final Color? aspectColor;
+
+  const KundaliChart({
+    super.key,
+    required this.birthChart,
+    required this.style,
+    required this.lineColor,
+    required this.glyphColor,
+    this.aspectColor,
+  });
+
+  @override
+  Widget build(BuildContext context) {
+    final list = KundaliLayoutCache.instance.get(birthChart, style);
+    final pictures = KundaliPictureCache.picturesFor(list);
+
+    return AspectRatio(
+      aspectRatio: 1,
+      child: RepaintBoundary(
+        child: CustomPaint(
+          painter: _KundaliPicturePainter(
+            pictures: pictures,
+            lineColor: lineColor,
+            glyphColor: glyphColor,
+            aspectColor: aspectColor,
+          ),
+        ),
+      ),
+    );
+  }
+}
+
+class _KundaliPicturePainter extends CustomPainter {
+  final KundaliPictures pictures;
+  final Color lineColor;
+  final Color glyphColor;
+  final Color? aspectColor;
+
+  _KundaliPicturePainter({
+    required this.pictures,
+    required this.lineColor,
+    required this.glyphColor,
+    this.aspectColor,
+  });
+
+  @override
+  void paint(Canvas canvas, Size size) {
+    const reference = KundaliPictureCache.referenceSize;
+    canvas.save();
+    canvas.scale(size.width / reference, size.height / reference);
+    const bounds = Rect.fromLTWH(0, 0, reference, reference);
+
+    if (aspectColor != null) {
+      _drawTinted(canvas, bounds, pictures.aspects, aspectColor!);
+    }
+    _drawTinted(canvas, bounds, pictures.lines, lineColor);
+    _drawTinted(canvas, bounds, pictures.glyphs, glyphColor);
+
+    canvas.restore();
+  }
+
+  void _drawTinted(
+      Canvas canvas, Rect bounds, ui.Picture picture, Color color) {
+    canvas.saveLayer(
+      bounds,
+      Paint()..colorFilter = ColorFilter.mode(color, BlendMode.srcIn),
+    );
+    canvas.drawPicture(picture);
+    canvas.restore();
+  }
+
+  @override
+  bool shouldRepaint(_KundaliPicturePainter oldDelegate) {
+    return !identical(oldDelegate.pictures, pictures) ||
+        oldDelegate.lineColor != lineColor ||
+        oldDelegate.glyphColor != glyphColor ||
+        oldDelegate.aspectColor != aspectColor;
+  }
+}
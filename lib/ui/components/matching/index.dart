@@ -22,4 +22,5 @@ export 'partner_details_card.dart';
 export 'matching_hero_section.dart';
 export 'custom_time_picker_dialog.dart';
 export 'koota_grid_layout.dart';
+export 'match_history_card.dart';
 
@@ -0,0 +1,200 @@
+/// Match History Card Component
+///
+/// Paged list of saved compatibility results with quick filters; tapping a
+/// match reopens its result without recomputing it
+library;
+
+import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:lucide_flutter/lucide_flutter.dart';
+import '../../../core/features/matching/history/match_history_store.dart';
+import '../../../core/features/matching/history/match_record.dart';
+import '../../../core/features/matching/providers/matching_provider.dart';
+import '../../utils/theme_helpers.dart';
+import '../../utils/responsive_system.dart';
+import '../common/index.dart';
+import 'koota_info_helper.dart';
+
+enum _HistoryFilter { all, highScore, nadiCancelled }
+
+/// Match History Card - Saved matches, newest first
+class MatchHistoryCard extends ConsumerStatefulWidget {
+  /// Called with the match to reopen
+  final ValueChanged<MatchRecord> onOpen;
+
+  const MatchHistoryCard({super.key, required this.onOpen});
+
+  @override
+  ConsumerState<MatchHistoryCard> createState() => _MatchHistoryCardState();
+}
+
+class _MatchHistoryCardState extends ConsumerState<MatchHistoryCard> {
+  /// Gunas considered a good match
+  static const int _goodScore = 24;
+  static const int _pageSize = 10;
+
+  _HistoryFilter _filter = _HistoryFilter.all;
+  final List<MatchRecord> _records = [];
+  String? _cursor;
+  bool _loading = false;
+  bool _loaded = false;
+
+  @override
+  void initState() {
+    super.initState();
+    _loadPage(reset: true);
+  }
+
+  MatchQuery get _query {
+    switch (_filter) {
+      case _HistoryFilter.all:
+        return MatchQuery.all;
+      case _HistoryFilter.highScore:
+        return const MatchQuery(minScore: _goodScore);
+      case _HistoryFilter.nadiCancelled:
+        return const MatchQuery(
+            minScore: _goodScore, nadiDosha: NadiDosha.cancelled);
+    }
+  }
+
+  Future<void> _loadPage({bool reset = false}) async {
+    if (_loading) return;
+    setState(() => _loading = true);
+    try {
+      final page = await ref.read(matchHistoryStoreProvider).query(
+            _query,
+            pageSize: _pageSize,
+            cursor: reset ? null : _cursor,
+          );
+      if (!mounted) return;
+      setState(() {
+        if (reset) _records.clear();
+        _records.addAll(page.records);
+        _cursor = page.cursor;
+        _loaded = true;
+      });
+    } catch (e) {
+      MatchHistoryStore.logFailure('Failed to load match history', e);
+    } finally {
+      if (mounted) setState(() => _loading = false);
+    }
+  }
+
+  void _setFilter(_HistoryFilter filter) {
+    if (filter == _filter) return;
+    setState(() => _filter = filter);
+    _loadPage(reset: true);
+  }
+
+  @override
+  Widget build(BuildContext context) {
+    if (_loaded && _records.isEmpty && _filter == _HistoryFilter.all) {
+      return const SizedBox.shrink(); // No history yet
+    }
+
+    return InfoCard(
+      child: Column(
+        crossAxisAlignment: CrossAxisAlignment.start,
+        children: [
+          Row(
+            children: [
+              Icon(
+                LucideIcons.history,
+                size: ResponsiveSystem.iconSize(context, baseSize: 20),
+                color: ThemeHelpers.getPrimaryColor(context),
+              ),
+              ResponsiveSystem.sizedBox(context,
+                  width: ResponsiveSystem.spacing(context, baseSpacing: 8)),
+              Text(
+                'Recent Matches',
+                style: TextStyle(
+                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 18),
+                  fontWeight: FontWeight.bold,
+                  color: ThemeHelpers.getPrimaryTextColor(context),
+                ),
+              ),
+            ],
+          ),
+          ResponsiveSystem.sizedBox(context,
+              height: ResponsiveSystem.spacing(context, baseSpacing: 12)),
+          Wrap(
+            spacing: ResponsiveSystem.spacing(context, baseSpacing: 8),
+            children: [
+              _buildFilterChip(context, _HistoryFilter.all, 'All'),
+              _buildFilterChip(
+                  context, _HistoryFilter.highScore, '$_goodScore+ gunas'),
+              _buildFilterChip(context, _HistoryFilter.nadiCancelled,
+                  'Nadi dosha cancelled'),
+            ],
+          ),
+          ResponsiveSystem.sizedBox(context,
+              height: ResponsiveSystem.spacing(context, baseSpacing: 8)),
+          if (_records.isEmpty && _loaded)
+            Text(
+              'No matches for this filter',
+              style: TextStyle(
+                fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
+                color: ThemeHelpers.getSecondaryTextColor(context),
+              ),
+            ),
+          for (final record in _records) _buildRecordTile(context, record),
+          if (_cursor != null)
+            Align(
+              alignment: Alignment.center,
+              child: TextButton(
+                onPressed: _loading ? null : () => _loadPage(),
+                child: Text(
+                  'Show more',
+                  style: TextStyle(
+                    color: ThemeHelpers.getPrimaryColor(context),
+                  ),
+                ),
+              ),
+            ),
+        ],
+      ),
+    );
+  }
+
+  Widget _buildFilterChip(
+      BuildContext context, _HistoryFilter filter, String label) {
+    return ChoiceChip(
+      label: Text(label),
+      selected: _filter == filter,
+      onSelected: (_) => _setFilter(filter),
+    );
+  }
+
+  Widget _buildRecordTile(BuildContext context, MatchRecord record) {
+    final percentage = record.result.compatibilityScore.round();
+    final date = record.createdAt;
+
+    return ListTile(
+      contentPadding: EdgeInsets.zero,
+      onTap: () => widget.onOpen(record),
+      title: Text(
+        '${record.person1.name} & ${record.person2.name}',
+        style: TextStyle(
+          fontSize: ResponsiveSystem.fontSize(context, baseSize: 15),
+          fontWeight: FontWeight.w600,
+          color: ThemeHelpers.getPrimaryTextColor(context),
+        ),
+      ),
+      subtitle: Text(
+        '${date.day}/${date.month}/${date.year} · ${record.result.level}',
+        style: TextStyle(
+          fontSize: ResponsiveSystem.fontSize(context, baseSize: 13),
+          color: ThemeHelpers.getSecondaryTextColor(context),
+        ),
+      ),
+      trailing: Text(
+        '${record.totalScore}/36',
+        style: TextStyle(
+          fontSize: ResponsiveSystem.fontSize(context, baseSize: 16),
+          fontWeight: FontWeight.bold,
+          color: KootaInfoHelper.getScoreColor(context, percentage),
+        ),
+      ),
+    );
+  }
+}
@@ -5,10 +5,14 @@ import '../../../core/services/user/user_service.dart';
 import '../../../core/utils/either.dart';
 import '../../../core/design_system/design_system.dart';
 import '../../../core/utils/validation/profile_completion_checker.dart';
-import '../../../core/services/astrology/astrology_service_bridge.dart';
+import '../../../core/features/predictions/text/prediction_text_engine.dart';
+import '../../../core/services/language/language_service.dart';
+import '../../../core/services/predictions/local_prediction_service.dart';
+import '../../../core/services/predictions/prediction_batch_service.dart';
 import 'package:lucide_flutter/lucide_flutter.dart';
 import '../../../core/services/language/translation_service.dart';
 import '../../../core/utils/validation/error_message_helper.dart';
+import '../../../core/services/startup/startup_snapshot_service.dart';
 
 class DailyPredictionsTab extends ConsumerStatefulWidget {
   const DailyPredictionsTab({super.key});
@@ -38,8 +42,6 @@ class _DailyPredictionsTabState extends ConsumerState<DailyPredictionsTab> {
         });
       }
 
-      final translationService = ref.read(translationServiceProvider);
-
       // Get user data from UserService first
       final userService = ref.read(userServiceProvider.notifier);
       final result = await userService.getCurrentUser();
@@ -58,172 +60,79 @@ class _DailyPredictionsTabState extends ConsumerState<DailyPredictionsTab> {
       }
 
       final currentUser = user;
-      final birthDate = currentUser.localBirthDateTime;
-
-      // Use AstrologyServiceBridge for timezone handling
-      final bridge = AstrologyServiceBridge.instance;
-
-      // Get timezone from user's location
-      final timezoneId = AstrologyServiceBridge.getTimezoneFromLocation(
-          currentUser.latitude, currentUser.longitude);
-
-      // Get birth data using bridge
-      final birthData = await bridge.getBirthData(
-        localBirthDateTime: birthDate,
-        timezoneId: timezoneId,
-        latitude: currentUser.latitude,
-        longitude: currentUser.longitude,
-        ayanamsha: currentUser.ayanamsha,
-      );
-
-      final rashiMap = birthData['rashi'] as Map<String, dynamic>?;
-      final nakshatraMap = birthData['nakshatra'] as Map<String, dynamic>?;
-      final padaMap = birthData['pada'] as Map<String, dynamic>?;
-
-      final moonData = {
-        'nakshatra': nakshatraMap?['number'] as int? ?? 0,
-        'pada': padaMap?['number'] as int? ?? 0,
-        'rashi': rashiMap?['number'] as int? ?? 0,
-      };
-
-      // Get predictions from API
-      // Note: For predictions, we need birth data and current location
-      final precisePredictions = await bridge.getPredictions(
-        localBirthDateTime: birthDate,
-        birthTimezoneId: timezoneId,
-        birthLatitude: currentUser.latitude,
-        birthLongitude: currentUser.longitude,
-        localTargetDateTime: DateTime.now(),
-        targetTimezoneId: timezoneId,
-        currentLatitude: currentUser.latitude,
-        currentLongitude: currentUser.longitude,
-        predictionType: 'daily',
-        ayanamsha: currentUser.ayanamsha,
-      );
-
-      // Store prediction data from API
-      // Extract prediction data from API response
-      final rashiNameMap = {
-        1: 'Aries',
-        2: 'Taurus',
-        3: 'Gemini',
-        4: 'Cancer',
-        5: 'Leo',
-        6: 'Virgo',
-        7: 'Libra',
-        8: 'Scorpio',
-        9: 'Sagittarius',
-        10: 'Capricorn',
-        11: 'Aquarius',
-        12: 'Pisces',
-      };
-
-      final nakshatraNameMap = {
-        1: 'Ashwini',
-        2: 'Bharani',
-        3: 'Krittika',
-        4: 'Rohini',
-        5: 'Mrigashira',
-        6: 'Ardra',
-        7: 'Punarvasu',
-        8: 'Pushya',
-        9: 'Ashlesha',
-        10: 'Magha',
-        11: 'Purva Phalguni',
-        12: 'Uttara Phalguni',
-        13: 'Hasta',
-        14: 'Chitra',
-        15: 'Swati',
-        16: 'Vishakha',
-        17: 'Anuradha',
-        18: 'Jyeshtha',
-        19: 'Mula',
-        20: 'Purva Ashadha',
-        21: 'Uttara Ashadha',
-        22: 'Shravana',
-        23: 'Dhanishtha',
-        24: 'Shatabhisha',
-        25: 'Purva Bhadrapada',
-        26: 'Uttara Bhadrapada',
-        27: 'Revati',
-      };
-
-      final rashiEnglishName = rashiNameMap[moonData['rashi']] ?? 'Pisces';
-      final nakshatraEnglishName =
-          nakshatraNameMap[moonData['nakshatra']] ?? 'Uttara Bhadrapada';
-
-      // Extract data from API response structure
-      // API returns: predictions.career.content, predictions.health.content, etc.
-      final predictionsMap =
-          precisePredictions['predictions'] as Map<String, dynamic>? ?? {};
-      final careerMap = predictionsMap['career'] as Map<String, dynamic>?;
-      final healthMap = predictionsMap['health'] as Map<String, dynamic>?;
-      final financeMap = predictionsMap['finance'] as Map<String, dynamic>?;
-
-      // Extract dasha information
-      final dashaMap = precisePredictions['dasha'] as Map<String, dynamic>?;
-      final dashaInfluence = dashaMap?['influence'] as String?;
+      final now = DateTime.now();
+      final language = ref.read(languageServiceProvider).contentLanguage.name;
+
+      // Texts are rendered on the device in the content language; the
+      // server's entry, when stored, adds lucky numbers, timings and
+      // remedies
+      final local = LocalPredictionService.instance;
+      final natal = await local.natal(currentUser);
+      final prediction = local.daily(natal, now, language: language);
+      final batch = PredictionBatchService.instance;
+      final extras =
+          await batch.cached(currentUser, PredictionKind.daily, now) ??
+              const <String, dynamic>{};
+
+      // Fill the rest of the week in the background; failed entries are
+      // logged by the batch and retried on its next run
+      batch.precompute(currentUser).ignore();
+
+      final words = PredictionTextEngine.instance.language(language);
+      final areas = prediction['predictions'] as Map<String, dynamic>;
+      String area(String key) =>
+          (areas[key] as Map<String, dynamic>)['content'] as String;
+      final dashaMap = prediction['dasha'] as Map<String, dynamic>;
+      final outlook = prediction['generalOutlook'] as String;
 
       // Extract lucky numbers and colors (using camelCase)
-      final luckyNumbersMap =
-          precisePredictions['luckyNumbers'] as Map<String, dynamic>?;
+      final luckyNumbersMap = extras['luckyNumbers'] as Map<String, dynamic>?;
       final luckyNumbersList = luckyNumbersMap?['numbers'] as List<dynamic>?;
       final luckyNumbers =
           luckyNumbersList?.map((n) => n.toString()).join(', ') ?? '1, 3, 7';
 
-      final luckyColorsMap =
-          precisePredictions['luckyColors'] as Map<String, dynamic>?;
+      final luckyColorsMap = extras['luckyColors'] as Map<String, dynamic>?;
       final luckyColorsList = luckyColorsMap?['colors'] as List<dynamic>?;
       final luckyColors = luckyColorsList?.join(', ') ?? 'Blue, Green';
 
       // Extract auspicious and avoid times (using camelCase)
       final auspiciousTimeMap =
-          precisePredictions['auspiciousTime'] as Map<String, dynamic>?;
+          extras['auspiciousTime'] as Map<String, dynamic>?;
       final auspiciousTime =
           auspiciousTimeMap?['time'] as String? ?? 'Morning 6-8 AM';
 
-      final avoidTimeMap =
-          precisePredictions['avoidTime'] as Map<String, dynamic>?;
+      final avoidTimeMap = extras['avoidTime'] as Map<String, dynamic>?;
       final avoidTime = avoidTimeMap?['time'] as String? ?? 'Evening 6-8 PM';
 
       // Extract remedies
-      final remediesMap =
-          precisePredictions['remedies'] as Map<String, dynamic>?;
+      final remediesMap = extras['remedies'] as Map<String, dynamic>?;
       final remedies = remediesMap?['content'] as String? ??
           'Chant mantras, donate to charity';
 
       _dailyPrediction = {
-        'date': DateFormat('yyyy-MM-dd').format(DateTime.now()),
-        'prediction': careerMap?['content'] as String? ??
-            translationService.translateContent('good_day_ahead',
-                fallback: 'Good day ahead'),
-        'rashi': rashiEnglishName,
-        'nakshatra': nakshatraEnglishName,
-        'generalOutlook': careerMap?['content'] as String? ??
-            translationService.translateContent('good_day_ahead',
-                fallback: 'Good day ahead'),
-        'love': translationService.translateContent('harmony_in_relationships',
-            fallback:
-                'Harmony in relationships'), // Love not in API response, use default
-        'career': careerMap?['content'] as String? ??
-            translationService.translateContent('progress_in_work',
-                fallback: 'Progress in work'),
-        'health': healthMap?['content'] as String? ??
-            translationService.translateContent('good_health',
-                fallback: 'Good health'),
-        'finance': financeMap?['content'] as String? ??
-            translationService.translateContent('stable_finances',
-                fallback: 'Stable finances'),
+        'date': DateFormat('yyyy-MM-dd').format(now),
+        'prediction': outlook,
+        'rashi': words.word(Vocabulary.rashi, natal.moon.rashi),
+        'nakshatra': words.word(Vocabulary.nakshatra, natal.moon.nakshatra),
+        'generalOutlook': outlook,
+        'love': area('love'),
+        'career': area('career'),
+        'health': area('health'),
+        'finance': area('finance'),
         'luckyNumbers': luckyNumbers,
         'luckyColors': luckyColors,
         'auspiciousTime': auspiciousTime,
         'avoidTime': avoidTime,
-        'dashaInfluence': dashaInfluence ??
-            translationService.translateContent('current_dasha_effects',
-                fallback: 'Current dasha period influence'),
+        'dashaInfluence': dashaMap['influence'] as String,
         'remedies': remedies,
       };
 
+      // Headline shown on the home screen's first frame next launch
+      StartupSnapshotService.instance.recordPrediction(
+        date: DateTime.now(),
+        headline: _dailyPrediction!['prediction']!,
+      );
+
       if (mounted) {
         setState(() {
           _isLoading = false;
@@ -248,6 +157,13 @@ class _DailyPredictionsTabState extends ConsumerState<DailyPredictionsTab> {
   Widget build(BuildContext context) {
     final translationService = ref.watch(translationServiceProvider);
 
+    // Texts are rendered locally; re-render when the content language changes
+    ref.listen(languageServiceProvider, (previous, next) {
+      if (previous?.contentLanguage != next.contentLanguage) {
+        _fetchDailyPredictions();
+      }
+    });
+
     if (_isLoading) {
       return Container(
         decoration: BoxDecoration(
@@ -1,72 +1,222 @@
-import '../../../core/design_system/design_system.dart';
 import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:intl/intl.dart';
 import 'package:lucide_flutter/lucide_flutter.dart';
+import '../../../core/design_system/design_system.dart';
+import '../../../core/features/predictions/text/prediction_text_engine.dart';
+import '../../../core/services/language/language_service.dart';
+import '../../../core/services/language/translation_service.dart';
+import '../../../core/services/predictions/local_prediction_service.dart';
+import '../../../core/services/user/user_service.dart';
+import '../../../core/utils/either.dart';
+import '../../../core/utils/validation/error_message_helper.dart';
+import '../../../core/utils/validation/profile_completion_checker.dart';
 
-class WeeklyPredictionsTab extends StatelessWidget {
+/// Seven days from today, rendered on the device in the content language
+class WeeklyPredictionsTab extends ConsumerStatefulWidget {
   const WeeklyPredictionsTab({super.key});
 
+  @override
+  ConsumerState<WeeklyPredictionsTab> createState() =>
+      _WeeklyPredictionsTabState();
+}
+
+class _WeeklyPredictionsTabState extends ConsumerState<WeeklyPredictionsTab> {
+  DateTime? _start;
+  String? _overview;
+  List<String> _days = const [];
+  List<TransitQuality> _qualities = const [];
+  bool _isLoading = true;
+  String? _errorMessage;
+
+  @override
+  void initState() {
+    super.initState();
+    _fetchWeeklyPredictions();
+  }
+
+  Future<void> _fetchWeeklyPredictions() async {
+    try {
+      if (mounted) {
+        setState(() {
+          _isLoading = true;
+          _errorMessage = null;
+        });
+      }
+
+      final userService = ref.read(userServiceProvider.notifier);
+      final result = await userService.getCurrentUser();
+      final user =
+          ResultHelper.isSuccess(result) ? ResultHelper.getValue(result) : null;
+
+      // The daily tab already routes incomplete profiles to the editor
+      if (user == null || !ProfileCompletionChecker.isProfileComplete(user)) {
+        if (mounted) {
+          setState(() {
+            _isLoading = false;
+          });
+        }
+        return;
+      }
+
+      final now = DateTime.now();
+      final language = ref.read(languageServiceProvider).contentLanguage.name;
+      final local = LocalPredictionService.instance;
+      final natal = await local.natal(user);
+      final week = local.week(natal, now);
+
+      final engine = PredictionTextEngine.instance;
+      _start = now;
+      _overview = engine.render(language, 'week_overview', week.first);
+      _days = [
+        for (final day in week) engine.render(language, 'week_day', day),
+      ];
+      _qualities = [
+        for (final day in week)
+          TransitQuality.values[day[PredictionFact.dayQuality]],
+      ];
+
+      if (mounted) {
+        setState(() {
+          _isLoading = false;
+        });
+      }
+    } catch (e) {
+      if (mounted) {
+        setState(() {
+          _isLoading = false;
+          _errorMessage = ErrorMessageHelper.getUserFriendlyMessage(e);
+          _overview = null;
+        });
+      }
+    }
+  }
+
   @override
   Widget build(BuildContext context) {
-    final isDark = Theme.of(context).brightness == Brightness.dark;
-    final backgroundGradient = BackgroundGradients.getBackgroundGradient(
-      isDark: isDark,
-      isEvening: false,
-      useSacredFire: false,
-    );
+    final translationService = ref.watch(translationServiceProvider);
+
+    ref.listen(languageServiceProvider, (previous, next) {
+      if (previous?.contentLanguage != next.contentLanguage) {
+        _fetchWeeklyPredictions();
+      }
+    });
+
+    final Widget child;
+    if (_isLoading) {
+      child = Center(
+        child: CircularProgressIndicator(
+            color: ThemeHelpers.getPrimaryColor(context)),
+      );
+    } else if (_overview == null) {
+      child = Center(
+        child: Padding(
+          padding: EdgeInsets.all(
+              ResponsiveSystem.spacing(context, baseSpacing: 24)),
+          child: Text(
+            _errorMessage ??
+                translationService.translateContent(
+                    'please_complete_profile',
+                    fallback: 'Complete your profile to see predictions'),
+            textAlign: TextAlign.center,
+            style: TextStyle(
+              fontSize: ResponsiveSystem.fontSize(context, baseSize: 16),
+              color: ThemeHelpers.getSecondaryTextColor(context),
+            ),
+          ),
+        ),
+      );
+    } else {
+      child = RefreshIndicator(
+        onRefresh: _fetchWeeklyPredictions,
+        child: ListView(
+          padding: EdgeInsets.all(
+              ResponsiveSystem.spacing(context, baseSpacing: 16)),
+          children: [
+            _buildCard(
+              icon: LucideIcons.calendar,
+              title: translationService.translateHeader('week_ahead',
+                  fallback: 'The Week Ahead'),
+              content: _overview!,
+            ),
+            for (var i = 0; i < _days.length; i++)
+              _buildCard(
+                icon: _iconFor(_qualities[i]),
+                title: DateFormat.MMMd().format(DateTime(
+                    _start!.year, _start!.month, _start!.day + i)),
+                content: _days[i],
+              ),
+          ],
+        ),
+      );
+    }
 
     return Container(
       decoration: BoxDecoration(
-        gradient: backgroundGradient,
+        gradient: BackgroundGradients.getBackgroundGradient(
+          isDark: Theme.of(context).brightness == Brightness.dark,
+          isEvening: false,
+          useSacredFire: false,
+        ),
       ),
-      child: Center(
+      child: child,
+    );
+  }
+
+  IconData _iconFor(TransitQuality quality) => switch (quality) {
+        TransitQuality.good => LucideIcons.sun,
+        TransitQuality.mixed => LucideIcons.cloudSun,
+        TransitQuality.bad => LucideIcons.cloud,
+      };
+
+  Widget _buildCard({
+    required IconData icon,
+    required String title,
+    required String content,
+  }) {
+    return Card(
+      margin: EdgeInsets.only(
+          bottom: ResponsiveSystem.spacing(context, baseSpacing: 12)),
+      elevation: ResponsiveSystem.elevation(context, baseElevation: 4),
+      shape: RoundedRectangleBorder(
+          borderRadius: ResponsiveSystem.circular(context, baseRadius: 12)),
+      color: ThemeHelpers.getSurfaceColor(context),
+      shadowColor: ThemeHelpers.getShadowColor(context),
+      child: Padding(
+        padding:
+            EdgeInsets.all(ResponsiveSystem.spacing(context, baseSpacing: 16)),
         child: Column(
-          mainAxisAlignment: MainAxisAlignment.center,
+          crossAxisAlignment: CrossAxisAlignment.start,
           children: [
-            Icon(
-              LucideIcons.calendar,
-              size: ResponsiveSystem.iconSize(context, baseSize: 64),
-              color: ThemeHelpers.getPrimaryColor(context),
+            Row(
+              children: [
+                Icon(icon,
+                    color: ThemeHelpers.getPrimaryColor(context),
+                    size: ResponsiveSystem.iconSize(context, baseSize: 22)),
+                SizedBox(
+                    width: ResponsiveSystem.spacing(context, baseSpacing: 12)),
+                Expanded(
+                  child: Text(
+                    title,
+                    style: TextStyle(
+                      fontSize:
+                          ResponsiveSystem.fontSize(context, baseSize: 17),
+                      fontWeight: FontWeight.bold,
+                      color: ThemeHelpers.getPrimaryTextColor(context),
+                    ),
+                  ),
+                ),
+              ],
             ),
             SizedBox(
-                height: ResponsiveSystem.spacing(context, baseSpacing: 16)),
+                height: ResponsiveSystem.spacing(context, baseSpacing: 8)),
             Text(
-              'Weekly Predictions',
+              content,
               style: TextStyle(
-                fontSize: ResponsiveSystem.fontSize(context, baseSize: 20),
-                fontWeight: FontWeight.bold,
+                fontSize: ResponsiveSystem.fontSize(context, baseSize: 15),
                 color: ThemeHelpers.getPrimaryTextColor(context),
               ),
             ),
-            SizedBox(height: ResponsiveSystem.spacing(context, baseSpacing: 8)),
-            Text(
-              'Coming Soon!',
-              style: TextStyle(
-                fontSize: ResponsiveSystem.fontSize(context, baseSize: 16),
-                color: ThemeHelpers.getSecondaryTextColor(context),
-              ),
-            ),
-            SizedBox(
-                height: ResponsiveSystem.spacing(context, baseSpacing: 16)),
-            Container(
-              padding: EdgeInsets.all(
-                  ResponsiveSystem.spacing(context, baseSpacing: 16)),
-              margin: EdgeInsets.symmetric(
-                  horizontal:
-                      ResponsiveSystem.spacing(context, baseSpacing: 32)),
-              decoration: BoxDecoration(
-                color: ThemeHelpers.getSurfaceColor(context)
-                    .withAlpha((0.8 * 255).round()),
-                borderRadius: ResponsiveSystem.circular(context, baseRadius: 12),
-              ),
-              child: Text(
-                'Weekly predictions will provide detailed insights for the entire week, including planetary transits, auspicious days, and comprehensive guidance.',
-                style: TextStyle(
-                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 16),
-                  color: ThemeHelpers.getPrimaryTextColor(context),
-                ),
-                textAlign: TextAlign.center,
-              ),
-            ),
           ],
         ),
       ),
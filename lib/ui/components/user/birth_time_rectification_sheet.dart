@@ -0,0 +1,286 @@
+/// Birth Time Rectification Sheet
+///
+/// Collects dated life events and searches ±2 hours around the entered
+/// birth time for the times whose dasha periods fit them; picking a result
+/// returns it as the new time of birth.
+library;
+
+import 'package:flutter/material.dart';
+import 'package:lucide_flutter/lucide_flutter.dart';
+import '../../../core/design_system/design_system.dart';
+import '../../../core/features/astrology/engine/rectification.dart';
+import '../../../core/features/horoscope/chart/kundali_layout.dart';
+import '../../../core/services/astrology/rectification_service.dart';
+import '../forms/reusable_form_fields.dart';
+
+class BirthTimeRectificationSheet extends StatefulWidget {
+  final DateTime dateOfBirth;
+  final TimeOfDay timeOfBirth;
+  final double latitude;
+  final double longitude;
+  final String ayanamsha;
+
+  const BirthTimeRectificationSheet({
+    super.key,
+    required this.dateOfBirth,
+    required this.timeOfBirth,
+    required this.latitude,
+    required this.longitude,
+    required this.ayanamsha,
+  });
+
+  /// Show the sheet; completes with the chosen time, or null
+  static Future<TimeOfDay?> show(
+    BuildContext context, {
+    required DateTime dateOfBirth,
+    required TimeOfDay timeOfBirth,
+    required double latitude,
+    required double longitude,
+    required String ayanamsha,
+  }) {
+    return showModalBottomSheet<TimeOfDay>(
+      context: context,
+      isScrollControlled: true,
+      backgroundColor: ThemeHelpers.getSurfaceColor(context),
+      builder: (context) => BirthTimeRectificationSheet(
+        dateOfBirth: dateOfBirth,
+        timeOfBirth: timeOfBirth,
+        latitude: latitude,
+        longitude: longitude,
+        ayanamsha: ayanamsha,
+      ),
+    );
+  }
+
+  @override
+  State<BirthTimeRectificationSheet> createState() =>
+      _BirthTimeRectificationSheetState();
+}
+
+class _BirthTimeRectificationSheetState
+    extends State<BirthTimeRectificationSheet> {
+  static const Map<LifeEventKind, String> _kindLabels = {
+    LifeEventKind.marriage: 'Marriage',
+    LifeEventKind.childbirth: 'Birth of a child',
+    LifeEventKind.career: 'Career start or promotion',
+    LifeEventKind.education: 'Graduation',
+    LifeEventKind.relocation: 'Move or emigration',
+    LifeEventKind.health: 'Illness or accident',
+  };
+
+  /// Candidates shown
+  static const int _shown = 5;
+
+  final List<LifeEvent> _events = [];
+  List<RectifiedBirthTime>? _results;
+  bool _isSearching = false;
+  String? _error;
+
+  Future<void> _search() async {
+    setState(() {
+      _isSearching = true;
+      _error = null;
+    });
+    try {
+      final results = await RectificationService.instance.rectify(
+        guess: DateTime(
+          widget.dateOfBirth.year,
+          widget.dateOfBirth.month,
+          widget.dateOfBirth.day,
+          widget.timeOfBirth.hour,
+          widget.timeOfBirth.minute,
+        ),
+        latitude: widget.latitude,
+        longitude: widget.longitude,
+        ayanamsha: widget.ayanamsha,
+        events: List.of(_events),
+      );
+      if (mounted) {
+        setState(() {
+          _results = results.take(_shown).toList();
+          _isSearching = false;
+        });
+      }
+    } catch (e) {
+      if (mounted) {
+        setState(() {
+          _error = 'Search failed: $e';
+          _isSearching = false;
+        });
+      }
+    }
+  }
+
+  Future<void> _addEvent() async {
+    var kind = LifeEventKind.marriage;
+    final now = DateTime.now();
+    var date = DateTime(widget.dateOfBirth.year + 25);
+    if (date.isAfter(now)) date = DateTime(now.year, now.month, now.day);
+    final added = await showDialog<LifeEvent>(
+      context: context,
+      builder: (context) => StatefulBuilder(
+        builder: (context, setDialogState) => AlertDialog(
+          title: const Text('Add Life Event'),
+          content: Column(
+            mainAxisSize: MainAxisSize.min,
+            children: [
+              ReusableDropdown<LifeEventKind>(
+                value: kind,
+                items: LifeEventKind.values,
+                onChanged: (value) =>
+                    setDialogState(() => kind = value ?? kind),
+                itemBuilder: (item) => _kindLabels[item]!,
+                hintText: 'Select event',
+              ),
+              ResponsiveSystem.sizedBox(context, height: 12),
+              ReusableDatePicker(
+                selectedDate: date,
+                firstDate: widget.dateOfBirth,
+                lastDate: now,
+                onDateChanged: (value) => setDialogState(() => date = value),
+              ),
+            ],
+          ),
+          actions: [
+            TextButton(
+              onPressed: () => Navigator.of(context).pop(),
+              child: const Text('Cancel'),
+            ),
+            TextButton(
+              onPressed: () =>
+                  Navigator.of(context).pop(LifeEvent(kind, date)),
+              child: const Text('Add'),
+            ),
+          ],
+        ),
+      ),
+    );
+    if (added != null && mounted) {
+      setState(() {
+        _events.add(added);
+        _results = null;
+      });
+    }
+  }
+
+  String _time(DateTime time) =>
+      '${time.hour.toString().padLeft(2, '0')}:'
+      '${time.minute.toString().padLeft(2, '0')}:'
+      '${time.second.toString().padLeft(2, '0')}';
+
+  String _sign(int sign) => KundaliLayout.signNames[sign];
+
+  @override
+  Widget build(BuildContext context) {
+    final textStyle = TextStyle(
+      fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
+      color: ThemeHelpers.getPrimaryTextColor(context),
+    );
+    final secondaryStyle = TextStyle(
+      fontSize: ResponsiveSystem.fontSize(context, baseSize: 12),
+      color: ThemeHelpers.getSecondaryTextColor(context),
+    );
+
+    return SafeArea(
+      child: SingleChildScrollView(
+        padding: EdgeInsets.all(
+            ResponsiveSystem.spacing(context, baseSpacing: 16)),
+        child: Column(
+          crossAxisAlignment: CrossAxisAlignment.start,
+          mainAxisSize: MainAxisSize.min,
+          children: [
+            Text(
+              'Find Your Birth Time',
+              style: TextStyle(
+                fontSize: ResponsiveSystem.fontSize(context, baseSize: 18),
+                fontWeight: FontWeight.bold,
+                color: ThemeHelpers.getPrimaryTextColor(context),
+              ),
+            ),
+            ResponsiveSystem.sizedBox(context, height: 8),
+            Text(
+              'Add a few dated life events. Times within two hours of '
+              '${widget.timeOfBirth.format(context)} are ranked by how well '
+              'their dasha periods match them.',
+              style: secondaryStyle,
+            ),
+            ResponsiveSystem.sizedBox(context, height: 12),
+            for (final (index, event) in _events.indexed)
+              ListTile(
+                dense: true,
+                contentPadding: EdgeInsets.zero,
+                leading: Icon(LucideIcons.calendar,
+                    color: ThemeHelpers.getPrimaryColor(context)),
+                title: Text(_kindLabels[event.kind]!, style: textStyle),
+                subtitle: Text(
+                  '${event.date.day}/${event.date.month}/${event.date.year}',
+                  style: secondaryStyle,
+                ),
+                trailing: IconButton(
+                  icon: const Icon(LucideIcons.x),
+                  onPressed: () => setState(() {
+                    _events.removeAt(index);
+                    _results = null;
+                  }),
+                ),
+              ),
+            Row(
+              children: [
+                TextButton.icon(
+                  onPressed: _isSearching ? null : _addEvent,
+                  icon: const Icon(LucideIcons.plus),
+                  label: const Text('Add event'),
+                ),
+                const Spacer(),
+                ElevatedButton(
+                  onPressed:
+                      _events.isEmpty || _isSearching ? null : _search,
+                  child: _isSearching
+                      ? SizedBox(
+                          width: ResponsiveSystem.iconSize(context,
+                              baseSize: 16),
+                          height: ResponsiveSystem.iconSize(context,
+                              baseSize: 16),
+                          child:
+                              const CircularProgressIndicator(strokeWidth: 2),
+                        )
+                      : const Text('Search'),
+                ),
+              ],
+            ),
+            if (_error != null)
+              Text(
+                _error!,
+                style: TextStyle(
+                  fontSize: ResponsiveSystem.fontSize(context, baseSize: 12),
+                  color: ThemeHelpers.getErrorColor(context),
+                ),
+              ),
+            if (_results != null) ...[
+              ResponsiveSystem.sizedBox(context, height: 8),
+              for (final result in _results!)
+                ListTile(
+                  contentPadding: EdgeInsets.zero,
+                  leading: Icon(LucideIcons.clock,
+                      color: ThemeHelpers.getPrimaryColor(context)),
+                  title: Text(
+                    '${_time(result.localStart)} – ${_time(result.localEnd)}',
+                    style: textStyle,
+                  ),
+                  subtitle: Text(
+                    'Lagna ${_sign(result.candidate.lagnaSign)}, navamsa '
+                    '${_sign(result.candidate.navamsaSign)} · score '
+                    '${result.candidate.score}',
+                    style: secondaryStyle,
+                  ),
+                  onTap: () =>
+                      Navigator.of(context).pop(TimeOfDay.fromDateTime(
+                          result.local)),
+                ),
+            ],
+          ],
+        ),
+      ),
+    );
+  }
+}
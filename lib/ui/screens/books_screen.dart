@@ -12,6 +12,7 @@ import '../utils/theme_helpers.dart';
 import '../utils/responsive_system.dart';
 // Core imports
 import '../../core/services/content/content_api_service.dart';
+import '../../core/services/content/book_prefetch_service.dart';
 import '../../core/design_system/theme/background_gradients.dart'; // For BackgroundGradients
 import '../../core/services/analytics/analytics_service.dart';
 import '../../core/services/content/content_language_service.dart';
@@ -45,6 +46,8 @@ class _BooksScreenState extends ConsumerState<BooksScreen> {
   void initState() {
     super.initState();
     _loadBooksList();
+    // Keep books the user is in the middle of ready on device (low priority)
+    BookPrefetchService.instance.resumePendingDownloads();
   }
 
   Future<void> _loadBooksList() async {
@@ -26,6 +26,8 @@ import '../../core/services/user/user_service.dart';
 import '../../core/utils/either.dart';
 import '../../core/utils/validation/profile_completion_checker.dart';
 import '../../core/utils/astrology/region_ayanamsha_mapper.dart';
+import '../../core/features/astrology/engine/gochara.dart';
+import '../../core/services/predictions/local_prediction_service.dart';
 import '../../core/logging/logging_helper.dart';
 import 'user_edit_screen.dart';
 
@@ -61,6 +63,9 @@ class _CalendarScreenState extends ConsumerState<CalendarScreen>
   String _selectedAyanamsha =
       'lahiri'; // Default ayanamsha (will be updated based on region)
 
+  // Personal transit scores for the year view's heatmap (complete profiles)
+  GocharaMatrix? _transits;
+
   @override
   void initState() {
     super.initState();
@@ -101,6 +106,33 @@ class _CalendarScreenState extends ConsumerState<CalendarScreen>
     // Initialize region and ayanamsha
     _selectedAyanamsha =
         RegionAyanamshaMapper.getAyanamshaForRegion(_selectedRegion);
+
+    _loadTransits();
+  }
+
+  /// Compute the selected year's transit matrix on the device
+  Future<void> _loadTransits() async {
+    try {
+      final userService = ref.read(userServiceProvider.notifier);
+      final result = await userService.getCurrentUser();
+      final user =
+          ResultHelper.isSuccess(result) ? ResultHelper.getValue(result) : null;
+      if (user == null || !ProfileCompletionChecker.isProfileComplete(user)) {
+        return;
+      }
+
+      final local = LocalPredictionService.instance;
+      final natal = await local.natal(user);
+      final transits = local.year(natal, _selectedYear);
+      if (mounted) {
+        setState(() {
+          _transits = transits;
+        });
+      }
+    } catch (e) {
+      LoggingHelper.logWarning('Transit heatmap unavailable: $e',
+          source: 'CalendarScreen');
+    }
   }
 
   @override
@@ -265,9 +297,11 @@ class _CalendarScreenState extends ConsumerState<CalendarScreen>
       latitude: 20.5937, // Default fallback (India center)
       longitude: 78.9629,
       ayanamsha: _selectedAyanamsha,
+      region: _selectedRegion,
       showFestivals: _showFestivals,
       showAuspiciousTimes: _showAuspiciousTimes,
       showCalendarInfo: _showCalendarInfo,
+      transits: _transits?.start.year == _selectedYear ? _transits : null,
     );
   }
 
@@ -437,7 +471,9 @@ class _CalendarScreenState extends ConsumerState<CalendarScreen>
               setState(() {
                 _selectedYear = newValue;
                 _currentMonth = DateTime(newValue, _currentMonth.month);
+                _transits = null;
               });
+              _loadTransits();
             }
           },
         ),
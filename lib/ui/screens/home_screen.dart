@@ -20,6 +20,9 @@ import '../../core/utils/validation/profile_completion_checker.dart';
 import '../../core/services/user/user_service.dart';
 import '../../core/utils/either.dart';
 import '../../core/services/language/translation_service.dart';
+import '../../core/services/language/language_service.dart';
+import '../../core/services/astrology/astrology_name_service.dart';
+import '../../core/services/startup/startup_snapshot_service.dart';
 import '../../core/navigation/animated_navigation.dart';
 import '../../core/navigation/hero_navigation.dart'; // For HeroNavigationWithRipple
 // UI Components - Reusable components
@@ -78,10 +81,36 @@ class _HomeScreenState extends ConsumerState<HomeScreen>
     }
   }
 
+  /// Today's panchang line from the startup snapshot, if it is for today
+  String? _snapshotPanchangLine() {
+    final panchang = StartupSnapshotService.instance.snapshot.panchang;
+    if (panchang == null || !panchang.isFor(DateTime.now())) return null;
+
+    final language = ref.read(languageServiceProvider).contentLanguage;
+    final names = ref.read(astrologyNameServiceProvider);
+    final parts = [
+      if (panchang.tithi.isNotEmpty)
+        names.getTithiNameFromString(panchang.tithi, language),
+      if (panchang.nakshatra.isNotEmpty)
+        names.getNakshatraNameFromString(panchang.nakshatra, language),
+      if (panchang.festival != null) panchang.festival!,
+    ].where((part) => part.isNotEmpty);
+    return parts.isEmpty ? null : parts.join(' · ');
+  }
+
   @override
   Widget build(BuildContext context) {
     final translationService = ref.watch(translationServiceProvider);
 
+    // Content from the last session, shown from the very first frame
+    final snapshot = StartupSnapshotService.instance.snapshot;
+    final prediction = snapshot.prediction;
+    final predictionHeadline =
+        prediction != null && prediction.isFor(DateTime.now())
+            ? prediction.headline
+            : null;
+    final panchangLine = _snapshotPanchangLine();
+
     return Scaffold(
       backgroundColor: ThemeHelpers.getBackgroundColor(context),
       body: AnimatedOpacity(
@@ -116,6 +145,20 @@ class _HomeScreenState extends ConsumerState<HomeScreen>
                   // Tagline below app title
                   WelcomeTagline(translationService: translationService),
 
+                  if (panchangLine != null) ...[
+                    ResponsiveSystem.sizedBox(context, height: 8),
+                    Text(
+                      panchangLine,
+                      maxLines: 1,
+                      overflow: TextOverflow.ellipsis,
+                      style: TextStyle(
+                        fontSize: ResponsiveSystem.fontSize(context, baseSize: 13),
+                        fontWeight: FontWeight.w600,
+                        color: ThemeHelpers.getPrimaryColor(context),
+                      ),
+                    ),
+                  ],
+
                   // Responsive spacing between tagline and CTA
                   ResponsiveSystem.sizedBox(
                     context,
@@ -134,7 +177,8 @@ class _HomeScreenState extends ConsumerState<HomeScreen>
                       'todays_guidance',
                       fallback: 'Today\'s Guidance',
                     ),
-                    subtitle: 'Get personalized insights for today',
+                    subtitle: predictionHeadline ??
+                        'Get personalized insights for today',
                     icon: Icons.auto_awesome,
                     onTap: () => _navigateWithProfileCheck(
                       context,
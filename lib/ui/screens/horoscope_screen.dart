@@ -1,3 +1,4 @@
+import 'dart:typed_data';
 import 'package:flutter/material.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 // UI Utils - Use only these for consistency
@@ -11,6 +12,7 @@ import '../utils/screen_handlers.dart';
 import '../components/common/index.dart';
 import '../components/app_bar/index.dart';
 import '../components/dialogs/index.dart';
+import '../components/horoscope/kundali_chart.dart';
 // Core imports
 import '../../core/services/language/translation_service.dart';
 import '../../core/features/user/providers/user_provider.dart' as user_providers;
@@ -18,6 +20,17 @@ import '../../core/utils/validation/profile_completion_checker.dart';
 import '../../core/utils/either.dart';
 import '../../core/models/user/user_model.dart';
 import '../../core/logging/logging_helper.dart';
+import '../../core/features/horoscope/chart/kundali_layout.dart';
+import '../../core/services/startup/startup_snapshot_service.dart';
+import '../../core/services/predictions/local_prediction_service.dart';
+import '../../core/features/astrology/engine/ashtakavarga.dart';
+import '../../core/features/astrology/engine/natal_chart.dart';
+import '../../core/features/astrology/engine/planetary_ephemeris.dart';
+import '../../core/features/astrology/engine/shadbala.dart';
+import '../../core/features/astrology/engine/varga.dart';
+import '../../core/features/astrology/engine/yoga.dart';
+import '../../core/features/predictions/text/prediction_text_engine.dart';
+import '../../core/services/language/language_service.dart';
 import 'user_edit_screen.dart';
 import 'package:lucide_flutter/lucide_flutter.dart';
 
@@ -36,13 +49,32 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
   Map<String, dynamic>? _fixedBirthData;
   String? _errorMessage;
   bool _isDisposed = false;
+  KundaliChartStyle _chartStyle = KundaliChartStyle.northIndian;
+  ShadbalaResult? _shadbala;
+  Int8List? _sarvashtakavarga;
+  NatalChart? _natalChart;
+  VargaTable? _vargas;
+  Varga _varga = Varga.d1;
+  YogaSet? _yogas;
 
   @override
   void initState() {
     super.initState();
+    _seedFromSnapshot();
     _checkProfileCompletion();
   }
 
+  /// Show the last known profile right away; the live check reconciles it
+  void _seedFromSnapshot() {
+    final user = StartupSnapshotService.instance.snapshot.user;
+    if (user == null || !ProfileCompletionChecker.isProfileComplete(user)) {
+      return;
+    }
+    _user = user;
+    _isProfileComplete = true;
+    _isLoading = false;
+  }
+
   @override
   void dispose() {
     _isDisposed = true;
@@ -84,7 +116,9 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
   Future<void> _generateHoroscope(UserModel user) async {
     try {
       setState(() {
-        _isLoading = true;
+        // Sections show their own placeholders while the chart loads, so
+        // only block the screen when there's no profile on display yet
+        _isLoading = _user == null;
         _errorMessage = null;
       });
 
@@ -101,6 +135,7 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
           _isLoading = false;
         });
       }
+      await _computeStrengths(user);
     } catch (e) {
       if (mounted && !_isDisposed) {
         setState(() {
@@ -111,6 +146,30 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
     }
   }
 
+  /// Shadbala, sarvashtakavarga, the divisional charts and the yogas from
+  /// the natal chart, on the device
+  Future<void> _computeStrengths(UserModel user) async {
+    try {
+      final natal = await LocalPredictionService.instance.natal(user);
+      final shadbala = Shadbala.compute(natal.chart);
+      final sarva = Ashtakavarga.sarva(Ashtakavarga.bhinna(natal.chart));
+      final vargas = Vargas.compute(natal.chart);
+      final yogas = YogaEngine.instance.evaluate(natal.chart);
+      if (mounted && !_isDisposed) {
+        setState(() {
+          _shadbala = shadbala;
+          _sarvashtakavarga = sarva;
+          _natalChart = natal.chart;
+          _vargas = vargas;
+          _yogas = yogas;
+        });
+      }
+    } catch (e) {
+      LoggingHelper.logWarning('Planet strengths unavailable: $e',
+          source: 'HoroscopeScreen');
+    }
+  }
+
   @override
   Widget build(BuildContext context) {
     final translationService = ref.watch(translationServiceProvider);
@@ -299,10 +358,20 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
                     if (_birthChart != null) ...[
                       _buildBirthChartInfo(),
                       ResponsiveSystem.sizedBox(context, height: 16),
+                      _buildKundaliChart(),
+                      ResponsiveSystem.sizedBox(context, height: 16),
                       _buildRasiNakshatraInfo(),
                       ResponsiveSystem.sizedBox(context, height: 16),
                       _buildPlanetaryPositions(),
                       ResponsiveSystem.sizedBox(context, height: 16),
+                      if (_shadbala != null) ...[
+                        _buildPlanetStrengths(),
+                        ResponsiveSystem.sizedBox(context, height: 16),
+                      ],
+                      if (_yogas != null) ...[
+                        _buildYogas(),
+                        ResponsiveSystem.sizedBox(context, height: 16),
+                      ],
                       _buildHousePositions(),
                       ResponsiveSystem.sizedBox(context, height: 16),
                       _buildAscendantInfo(),
@@ -472,6 +541,128 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
     );
   }
 
+  Widget _buildKundaliChart() {
+    const styleLabels = {
+      KundaliChartStyle.northIndian: 'North',
+      KundaliChartStyle.southIndian: 'South',
+      KundaliChartStyle.eastIndian: 'East',
+    };
+    final varga = _vargas == null ? Varga.d1 : _varga;
+
+    return InfoCard(
+      child: Column(
+        crossAxisAlignment: CrossAxisAlignment.start,
+        children: [
+          SectionTitle(
+            title: varga == Varga.d1
+                ? 'Birth Chart'
+                : '${varga.title} (${varga.label})',
+            baseFontSize: 18,
+          ),
+          ResponsiveSystem.sizedBox(context, height: 8),
+          Wrap(
+            spacing: ResponsiveSystem.spacing(context, baseSpacing: 8),
+            children: [
+              for (final entry in styleLabels.entries)
+                ChoiceChip(
+                  label: Text(entry.value),
+                  selected: _chartStyle == entry.key,
+                  onSelected: (_) => setState(() => _chartStyle = entry.key),
+                ),
+            ],
+          ),
+          if (_vargas != null) ...[
+            ResponsiveSystem.sizedBox(context, height: 8),
+            SingleChildScrollView(
+              scrollDirection: Axis.horizontal,
+              child: Row(
+                children: [
+                  for (final option in Varga.values)
+                    Padding(
+                      padding: EdgeInsets.only(
+                        right: ResponsiveSystem.spacing(context,
+                            baseSpacing: 6),
+                      ),
+                      child: ChoiceChip(
+                        label: Text(option.label),
+                        tooltip: option.title,
+                        selected: varga == option,
+                        onSelected: (_) => setState(() => _varga = option),
+                      ),
+                    ),
+                ],
+              ),
+            ),
+          ],
+          ResponsiveSystem.sizedBox(context, height: 12),
+          KundaliChart(
+            birthChart: varga == Varga.d1
+                ? _birthChart!
+                : _vargaChart(_vargas!, varga),
+            style: _chartStyle,
+            lineColor: ThemeHelpers.getSecondaryTextColor(context),
+            glyphColor: ThemeHelpers.getPrimaryTextColor(context),
+          ),
+        ],
+      ),
+    );
+  }
+
+  /// Kundali input for a divisional chart: the varga signs, with the natal
+  /// degree inside the sign so planets keep their order within a house
+  Map<String, dynamic> _vargaChart(VargaTable vargas, Varga varga) {
+    final natal = _natalChart!;
+    Map<String, dynamic> placement(int point) {
+      final sign = vargas.sign(point, varga);
+      return {
+        'rashi': {'number': sign + 1},
+        'longitude': sign * 30 + natal.longitudes[point] % 30,
+      };
+    }
+
+    return {
+      'ascendant': placement(NatalChart.lagna),
+      'planetaryPositions': {
+        for (final graha in Graha.values)
+          '${graha.name[0].toUpperCase()}${graha.name.substring(1)}':
+              placement(graha.index),
+      },
+    };
+  }
+
+  Widget _buildYogas() {
+    final present = _yogas!.present;
+
+    return InfoCard(
+      child: Column(
+        crossAxisAlignment: CrossAxisAlignment.start,
+        children: [
+          SectionTitle(
+            title: 'Yogas & Doshas',
+            baseFontSize: 18,
+          ),
+          ResponsiveSystem.sizedBox(context, height: 8),
+          if (present.isEmpty)
+            Text(
+              'No classical yoga or dosha in this chart',
+              style: TextStyle(
+                fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
+                color: ThemeHelpers.getSecondaryTextColor(context),
+              ),
+            ),
+          for (final rule in present)
+            InfoRow(
+              label: rule.name,
+              value: rule.description,
+              icon: rule.kind == YogaKind.dosha
+                  ? Icons.warning_amber
+                  : Icons.auto_awesome,
+            ),
+        ],
+      ),
+    );
+  }
+
   Widget _buildPlanetaryPositions() {
     final planetaryPositions =
         _birthChart?['planetaryPositions'] as Map<String, dynamic>?;
@@ -666,6 +857,51 @@ class _HoroscopeScreenState extends ConsumerState<HoroscopeScreen> {
     );
   }
 
+  Widget _buildPlanetStrengths() {
+    final shadbala = _shadbala!;
+    final sarva = _sarvashtakavarga!;
+    final language = ref.read(languageServiceProvider).contentLanguage.name;
+    final words = PredictionTextEngine.instance.language(language);
+
+    return InfoCard(
+      child: Column(
+        crossAxisAlignment: CrossAxisAlignment.start,
+        children: [
+          SectionTitle(
+            title: 'Planetary Strength',
+            baseFontSize: 18,
+          ),
+          ResponsiveSystem.sizedBox(context, height: 8),
+          Text(
+            'Shadbala in rupas against the classical minimum',
+            style: TextStyle(
+              fontSize: ResponsiveSystem.fontSize(context, baseSize: 14),
+              color: ThemeHelpers.getSecondaryTextColor(context),
+            ),
+          ),
+          ResponsiveSystem.sizedBox(context, height: 16),
+          for (final planet in Graha.values.take(Ashtakavarga.planets))
+            InfoRow(
+              label: words.word(Vocabulary.planet, planet.index),
+              value: '${shadbala.rupas(planet).toStringAsFixed(2)} / '
+                  '${ShadbalaResult.requiredRupas[planet.index]}'
+                  '${shadbala.ratio(planet) >= 1 ? '  ✓' : ''}',
+              icon: Icons.bolt,
+            ),
+          ResponsiveSystem.sizedBox(context, height: 8),
+          InfoRow(
+            label: 'Sarvashtakavarga',
+            value: [
+              for (var sign = 0; sign < 12; sign++)
+                '${words.word(Vocabulary.rashi, sign)} ${sarva[sign]}',
+            ].join(', '),
+            icon: Icons.grid_view,
+          ),
+        ],
+      ),
+    );
+  }
+
   Widget _buildPersonalityInsight(String aspect, String insight) {
     return InfoRow(
       label: aspect,
@@ -17,8 +17,12 @@ import '../../core/logging/logging_helper.dart';
 import '../../core/services/storage/matching_form_storage_service.dart';
 import '../../core/features/matching/providers/matching_provider.dart';
 import '../../core/features/matching/repositories/matching_repository.dart';
+import '../../core/features/matching/history/match_record.dart';
 import '../../core/features/user/providers/user_provider.dart';
 import '../../core/models/user/user_model.dart';
+import '../../core/features/astrology/engine/natal_chart.dart';
+import '../../core/features/astrology/engine/yoga.dart';
+import '../../core/utils/astrology/timezone_util.dart';
 
 class MatchingScreen extends ConsumerStatefulWidget {
   const MatchingScreen({super.key});
@@ -72,6 +76,9 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
   String _selectedAyanamsha = 'lahiri';
   String _selectedHouseSystem = 'placidus';
 
+  // Doshas of groom and bride from local charts, once matched
+  List<YogaSet>? _partnerDoshas;
+
   @override
   void initState() {
     super.initState();
@@ -439,6 +446,7 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
     }
 
     print('🔍 DEBUG: Validation passed, proceeding with matching');
+    setState(() => _partnerDoshas = null);
 
     try {
       LoggingHelper.logInfo('Starting kundali matching process - groom: ${_groomNameController.text.trim()}, bride: ${_brideNameController.text.trim()}');
@@ -520,6 +528,8 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
       print('🔍 DEBUG: Matching provider call completed');
       LoggingHelper.logInfo('Kundali matching completed successfully');
 
+      await _computePartnerDoshas(groomData, brideData);
+
       // Save form data for future sessions
       await _saveFormData();
 
@@ -902,9 +912,50 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
     return [
       ..._buildPartnerDetailsSection(translationService),
       ..._buildCalculationSection(translationService, matchingState),
+      ResponsiveSystem.sizedBox(context,
+          height: ResponsiveSystem.spacing(context, baseSpacing: 24)),
+      MatchHistoryCard(onOpen: _openHistoryRecord),
     ];
   }
 
+  /// Reopen a saved match: restore its inputs and show its stored result
+  void _openHistoryRecord(MatchRecord record) {
+    setState(() {
+      _groomNameController.text = record.person1.name;
+      _groomDob = record.person1.dateOfBirth;
+      _groomTob = record.person1.timeOfBirth;
+      _groomPob = record.person1.placeOfBirth;
+      _groomLatitude = record.person1.latitude;
+      _groomLongitude = record.person1.longitude;
+      _groomLocationSearchController.text = _groomPob;
+
+      _brideNameController.text = record.person2.name;
+      _brideDob = record.person2.dateOfBirth;
+      _brideTob = record.person2.timeOfBirth;
+      _bridePob = record.person2.placeOfBirth;
+      _brideLatitude = record.person2.latitude;
+      _brideLongitude = record.person2.longitude;
+      _brideLocationSearchController.text = _bridePob;
+
+      _selectedAyanamsha = record.ayanamsha;
+      _selectedHouseSystem = record.houseSystem;
+      _partnerDoshas = null;
+    });
+    ref.read(matchingProvider.notifier).openRecord(record);
+    _resultsAnimationController.forward();
+
+    // Doshas aren't stored with the record; evaluate this couple's again
+    PartnerData partner(MatchPartner person) => PartnerData(
+          name: person.name,
+          dateOfBirth: person.dateOfBirth,
+          timeOfBirth: person.timeOfBirth,
+          placeOfBirth: person.placeOfBirth,
+          latitude: person.latitude,
+          longitude: person.longitude,
+        );
+    _computePartnerDoshas(partner(record.person1), partner(record.person2));
+  }
+
   /// Build calculation and matching section
   List<Widget> _buildCalculationSection(
       TranslationService translationService, MatchingState matchingState) {
@@ -1194,6 +1245,11 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
         ScoreSummaryCard(matchingState: matchingState),
         ResponsiveSystem.sizedBox(context,
             height: ResponsiveSystem.spacing(context, baseSpacing: 24)),
+        if (_partnerDoshas != null) ...[
+          _buildDoshaCheck(_partnerDoshas!),
+          ResponsiveSystem.sizedBox(context,
+              height: ResponsiveSystem.spacing(context, baseSpacing: 24)),
+        ],
         CompatibilityInsightsCard(matchingState: matchingState),
         ResponsiveSystem.sizedBox(context,
             height: ResponsiveSystem.spacing(context, baseSpacing: 24)),
@@ -1211,6 +1267,73 @@ class _MatchingScreenState extends ConsumerState<MatchingScreen>
 
   // Note: _buildHeroSection and _buildResultsHeroSection have been replaced with MatchingHeroSection and MatchingResultsHeroSection components
 
+  /// Manglik and Kala Sarpa doshas of both partners, evaluated on the
+  /// device in one batch
+  Future<void> _computePartnerDoshas(
+      PartnerData groom, PartnerData bride) async {
+    try {
+      await TimezoneUtil.initialize();
+      NatalChart chart(PartnerData partner) {
+        final timezoneId = TimezoneUtil.getTimezoneFromLocation(
+            partner.latitude, partner.longitude);
+        return NatalChart.compute(
+          birthUtc: TimezoneUtil.convertLocalToUTC(
+              partner.dateOfBirth, timezoneId),
+          latitude: partner.latitude,
+          longitude: partner.longitude,
+          ayanamsha: _selectedAyanamsha,
+        );
+      }
+
+      final engine = YogaEngine.instance;
+      final batch = engine.batch([chart(groom), chart(bride)]);
+      if (mounted) {
+        setState(() {
+          _partnerDoshas = [
+            engine.batchResult(batch, 0),
+            engine.batchResult(batch, 1),
+          ];
+        });
+      }
+    } catch (e) {
+      LoggingHelper.logWarning('Partner doshas unavailable: $e',
+          source: 'MatchingScreen');
+    }
+  }
+
+  Widget _buildDoshaCheck(List<YogaSet> doshas) {
+    const checked = ['manglik', 'kala_sarpa'];
+    String mark(YogaSet set, String id) => set.has(id) ? 'Yes' : 'No';
+    final rules = {for (final rule in doshas.first.rules) rule.id: rule};
+    final bothManglik =
+        doshas[0].has('manglik') && doshas[1].has('manglik');
+
+    return InfoCard(
+      child: Column(
+        crossAxisAlignment: CrossAxisAlignment.start,
+        children: [
+          SectionTitle(title: 'Dosha Check'),
+          ResponsiveSystem.sizedBox(context, height: 8),
+          for (final id in checked)
+            InfoRow(
+              label: rules[id]!.name,
+              value: 'Groom: ${mark(doshas[0], id)} · '
+                  'Bride: ${mark(doshas[1], id)}',
+              icon: Icons.warning_amber,
+            ),
+          if (bothManglik)
+            Text(
+              'Both partners are Manglik, so the dosha is cancelled',
+              style: TextStyle(
+                fontSize: ResponsiveSystem.fontSize(context, baseSize: 13),
+                color: ThemeHelpers.getSecondaryTextColor(context),
+              ),
+            ),
+        ],
+      ),
+    );
+  }
+
   /// Build small compatibility button for top of results
   Widget _buildSmallCompatibilityButton() {
     return Row(
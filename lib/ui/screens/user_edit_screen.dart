@@ -14,6 +14,7 @@ import '../../core/utils/either.dart';
 import '../../core/utils/astrology/ayanamsha_info.dart';
 import '../../core/utils/astrology/house_system_info.dart';
 import '../components/forms/reusable_form_fields.dart';
+import '../components/user/birth_time_rectification_sheet.dart';
 
 /// User Edit Screen - Enhanced Version with Proper UI/UX
 class UserEditScreen extends ConsumerStatefulWidget {
@@ -144,6 +145,17 @@ class _UserEditScreenState extends ConsumerState<UserEditScreen> {
                     },
                   ),
                 ),
+                Align(
+                  alignment: Alignment.centerRight,
+                  child: TextButton.icon(
+                    onPressed: _rectifyBirthTime,
+                    icon: Icon(
+                      LucideIcons.search,
+                      size: ResponsiveSystem.iconSize(context, baseSize: 16),
+                    ),
+                    label: const Text('Not sure? Find it from life events'),
+                  ),
+                ),
 
                 ResponsiveSystem.sizedBox(context,
                     height: ResponsiveSystem.spacing(context, baseSpacing: 16)),
@@ -499,6 +511,32 @@ class _UserEditScreenState extends ConsumerState<UserEditScreen> {
     });
   }
 
+  /// Search around the entered time of birth using dated life events
+  Future<void> _rectifyBirthTime() async {
+    if (_pobController.text.trim().isEmpty) {
+      ScaffoldMessenger.of(context).showSnackBar(
+        SnackBar(
+          content: Text('Please select your place of birth first'),
+          backgroundColor: ThemeHelpers.getErrorColor(context),
+        ),
+      );
+      return;
+    }
+    final time = await BirthTimeRectificationSheet.show(
+      context,
+      dateOfBirth: _dob,
+      timeOfBirth: _tob,
+      latitude: _latitude,
+      longitude: _longitude,
+      ayanamsha: _ayanamsha,
+    );
+    if (time != null && mounted) {
+      setState(() {
+        _tob = time;
+      });
+    }
+  }
+
   /// Show ayanamsha selector dialog
   void _showAyanamshaSelector() {
     showDialog(
@@ -0,0 +1,82 @@
+/// Astro Request Handler Tests
+///
+/// API-shaped responses for the chart, prediction and calendar paths,
+/// errors in the API's shape, and batches sharing one calendar year
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/headless/astro_request_handler.dart';
+
+const _place = {'latitude': '13.08', 'longitude': '80.27'};
+
+void main() {
+  test('answers a full birth chart', () {
+    final response = AstroRequestHandler().handle(
+      AstroRequestHandler.birthChartPath,
+      {'dateOfBirth': '1990-05-15', 'timeOfBirth': '05:00:00', ..._place},
+    );
+    expect(response.ok, isTrue);
+    final chart = response.body['birthChart'] as Map<String, dynamic>;
+    final planets = chart['planetaryPositions'] as Map<String, dynamic>;
+    expect(planets.keys, contains('Ketu'));
+    expect(planets.length, 9);
+    expect((response.body['rashi'] as Map)['number'], inInclusiveRange(1, 12));
+    expect(response.body['birthDateTime'], '1990-05-15T05:00:00.000Z');
+  });
+
+  test('answers daily predictions and refuses other types', () {
+    final handler = AstroRequestHandler();
+    final query = {
+      'birthDateTime': '1990-05-15T05:00:00Z',
+      'birthLatitude': '13.08',
+      'birthLongitude': '80.27',
+      'currentLatitude': '13.08',
+      'currentLongitude': '80.27',
+      'targetDate': '2025-03-01',
+    };
+    final daily = handler.handle(AstroRequestHandler.predictionsPath,
+        {...query, 'predictionType': 'daily'});
+    expect(daily.ok, isTrue);
+    expect(daily.body['source'], 'local');
+
+    final hourly = handler.handle(AstroRequestHandler.predictionsPath,
+        {...query, 'predictionType': 'hourly'});
+    expect(hourly.status, 501);
+    expect(hourly.body.keys, containsAll(['code', 'message']));
+  });
+
+  test('reports bad requests and unknown paths', () {
+    final handler = AstroRequestHandler();
+    expect(handler.handle('/api/v1/nothing', const {}).status, 404);
+    expect(
+        handler.handle(AstroRequestHandler.calendarMonthPath,
+            {'year': '2025', 'month': 'x', ..._place}).status,
+        400);
+  });
+
+  test('a batch of months shares one calendar year', () {
+    final handler = AstroRequestHandler();
+    final responses = handler.handleBatch([
+      for (var month = 12; month >= 1; month--)
+        {
+          'path': AstroRequestHandler.calendarMonthPath,
+          'query': {'year': 2025, 'month': month, ..._place},
+        },
+      {'query': const {}},
+    ]);
+
+    expect(responses.length, 13);
+    expect(responses.last.status, 400);
+    expect((responses.first.body['days'] as List).length, 31);
+    expect((responses[10].body['days'] as List).length, 28);
+    final january = responses[11].body['days'] as List;
+    expect((january.first as Map)['date'], '2025-01-01');
+
+    // The year is cached: a later request reuses the same day maps
+    final year = handler.handle(AstroRequestHandler.calendarYearPath,
+        {'year': '2025', ..._place});
+    final months = year.body['months'] as Map<String, Object?>;
+    final days = (months['1'] as Map)['days'] as List;
+    expect(identical(days.first, january.first), isTrue);
+  });
+}
@@ -0,0 +1,86 @@
+/// Astro Tables Tests
+///
+/// The delta-T spline through its knots and against published values, the
+/// tabulated nutation against Meeus' worked example, and the shared frame
+/// of the ephemeris, lagna and ayanamsha
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_frame.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_tables.g.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_time.dart';
+import 'package:skvk_application/core/features/astrology/engine/ayanamsha.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/precision.dart';
+
+void main() {
+  group('Delta-T', () {
+    test('passes through the knots and is continuous between them', () {
+      for (var i = 0; i < deltaTKnots.length - 1; i++) {
+        final year = (deltaTFirstYear + i).toDouble();
+        expect(deltaTSeconds(year), closeTo(deltaTKnots[i], 1e-9));
+        expect(deltaTSeconds(year + 1 - 1e-9),
+            closeTo(deltaTKnots[i + 1], 1e-6));
+      }
+    });
+
+    test('follows published values', () {
+      // Espenak & Meeus tables and IERS observations, in seconds
+      const published = {
+        1800.0: 13.7,
+        1850.0: 7.1,
+        1900.0: -2.8,
+        1920.0: 21.2,
+        1950.0: 29.1,
+        1980.0: 50.5,
+        2000.0: 63.8,
+        2020.0: 69.4,
+        2026.0: 69.2,
+      };
+      published.forEach((year, seconds) {
+        expect(deltaTSeconds(year), closeTo(seconds, 0.5), reason: '$year');
+      });
+    });
+  });
+
+  group('Nutation', () {
+    test('matches Meeus example 22.a', () {
+      // 1987 April 10, 0h TD: Δψ = −3.788″, Δε = +9.443″
+      final frame = AstroFrame.of(2446895.5);
+      expect(frame.nutationLongitude * 3600, closeTo(-3.788, 0.001));
+      expect(frame.nutationObliquity * 3600, closeTo(9.443, 0.001));
+      expect(frame.trueObliquity, closeTo(23.4435694, 1e-6));
+    });
+
+    test('fast tier keeps the largest terms', () {
+      for (var jd = j2000 - 36525; jd < j2000 + 36525; jd += 97.3) {
+        final full = AstroFrame.of(jd).nutationLongitude;
+        final fast =
+            AstroFrame.of(jd, precision: Precision.fast).nutationLongitude;
+        expect((full - fast).abs(), lessThanOrEqualTo(0.92 / 3600));
+      }
+    });
+  });
+
+  group('Frame', () {
+    test('precession along the ecliptic is the ayanamsha rate', () {
+      final jd = julianDayTt(DateTime.utc(1925, 3, 1));
+      final frame = AstroFrame.of(jd);
+      final lahiri = Ayanamsha.degrees('lahiri', jd);
+      expect(lahiri - Ayanamsha.degrees('lahiri', j2000),
+          closeTo(frame.precession, 1e-12));
+      // The J2000 equinox, under a minute of arc from both ecliptics,
+      // moves by the precession alone
+      expect(frame.longitudeOfDate(1, 0, 0), closeTo(frame.precession, 1e-5));
+    });
+
+    test('is evaluated once per instant', () {
+      final jd = julianDayTt(DateTime.utc(1948, 8, 15, 6));
+      final frame = AstroFrame.of(jd);
+      grahaLongitudes(jd, Float64List(Graha.values.length));
+      expect(identical(AstroFrame.of(jd), frame), isTrue);
+    });
+  });
+}
@@ -0,0 +1,118 @@
+/// Calendar Exporter Tests
+///
+/// One NDJSON line per day, well-formed iCalendar with folded CRLF lines,
+/// the observances of early 2024, tithis no sunrise falls in or two
+/// sunrises fall in, and local times in iCalendar descriptions
+library;
+
+import 'dart:convert';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/panchang.dart';
+import 'package:skvk_application/core/features/calendar/calendar_exporter.dart';
+
+const _chennai = PanchangLocation(13.08, 80.27);
+
+void main() {
+  const exporter = CalendarExporter(location: _chennai);
+
+  test('writes one parseable NDJSON line per day', () {
+    final sink = StringBuffer();
+    final days = exporter.export(sink,
+        from: DateTime(2024, 1, 1), to: DateTime(2024, 2, 29));
+    expect(days, 60);
+
+    final lines = const LineSplitter().convert(sink.toString());
+    expect(lines.length, 60);
+    final records = [
+      for (final line in lines) jsonDecode(line) as Map<String, dynamic>,
+    ];
+    expect(records.first['date'], '2024-01-01');
+    expect(records.last['date'], '2024-02-29');
+
+    // Makara Sankranti 2024 falls before sunrise on 15 January
+    final makara = records.singleWhere(
+        (r) => (r['observances'] as List).contains('Makara Sankranti'));
+    expect(makara['date'], '2024-01-15');
+    // Pausha Putrada Ekadashi, 21 January
+    final ekadashi = records.firstWhere((r) => r['date'] == '2024-01-21');
+    expect(ekadashi['observances'], contains('Tithi 11'));
+    expect(records.where((r) => r['month'] == null), isEmpty);
+  });
+
+  test('writes folded iCalendar with CRLF lines', () {
+    final sink = StringBuffer();
+    const CalendarExporter(location: _chennai, dailyPanchang: true).export(
+      sink,
+      from: DateTime(2024, 1, 1),
+      to: DateTime(2024, 1, 31),
+      format: ExportFormat.ics,
+      stamp: DateTime.utc(2024),
+    );
+    final text = sink.toString();
+    expect(text.endsWith('END:VCALENDAR\r\n'), isTrue);
+    expect(text.replaceAll('\r\n', '').contains('\n'), isFalse);
+
+    final lines = text.split('\r\n')..removeLast();
+    for (final line in lines) {
+      expect(utf8.encode(line).length, lessThanOrEqualTo(75), reason: line);
+    }
+    final begins = lines.where((l) => l == 'BEGIN:VEVENT').length;
+    expect(begins, lines.where((l) => l == 'END:VEVENT').length);
+    expect(begins, greaterThan(31));
+    expect(lines, contains('UID:20240115-sankranti@skvk'));
+    expect(lines, contains('DTSTAMP:20240101T000000Z'));
+  });
+
+  test('each tithi is observed once, kshaya and two-sunrise ones too', () {
+    final sink = StringBuffer();
+    exporter.export(sink,
+        from: DateTime(2022, 1, 1), to: DateTime(2025, 12, 31));
+    final records = [
+      for (final line in const LineSplitter().convert(sink.toString()))
+        jsonDecode(line) as Map<String, dynamic>,
+    ];
+    int tithi(int i) => (records[i]['tithi'] as Map)['id'] as int;
+
+    var kshaya = 0, twoSunrises = 0;
+    for (var i = 1; i < records.length - 1; i++) {
+      final skipped = (tithi(i + 1) - tithi(i)) % 30 == 2;
+      if (skipped) kshaya++;
+      if (tithi(i) == tithi(i - 1)) twoSunrises++;
+      for (final id in [11, 15, 26, 30]) {
+        final observed = (tithi(i) == id && tithi(i - 1) != id) ||
+            (skipped && tithi(i) % 30 + 1 == id);
+        final observances = records[i]['observances'] as List;
+        expect(observances.contains('Tithi $id'), observed,
+            reason: '${records[i]['date']} Tithi $id');
+      }
+    }
+    expect(kshaya, greaterThan(0));
+    expect(twoSunrises, greaterThan(0));
+  });
+
+  test('iCalendar descriptions use the export\'s time zone', () {
+    String export(CalendarExporter exporter) {
+      final sink = StringBuffer();
+      exporter.export(sink,
+          from: DateTime(2024, 1, 21),
+          to: DateTime(2024, 1, 21),
+          format: ExportFormat.ics);
+      return sink.toString().replaceAll('\r\n ', '');
+    }
+
+    final utc = export(
+        const CalendarExporter(location: _chennai, dailyPanchang: true));
+    expect(utc, contains('X-WR-TIMEZONE:UTC'));
+    expect(utc, isNot(contains('Z\\n')));
+
+    final ist = export(CalendarExporter(
+      location: _chennai,
+      localTime: (utc) => utc.add(const Duration(hours: 5, minutes: 30)),
+      timeZone: 'Asia/Kolkata',
+      dailyPanchang: true,
+    ));
+    expect(ist, contains('X-WR-TIMEZONE:Asia/Kolkata'));
+    // Sunrise in Chennai is a little before 06:40 local time in January
+    expect(ist, matches(RegExp(r'Sunrise 2024-01-21 06:[34]\d')));
+  });
+}
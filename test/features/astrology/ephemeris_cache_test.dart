@@ -0,0 +1,83 @@
+/// Ephemeris Cache Tests
+///
+/// The per-day interpolation against direct [grahaLongitudes] evaluation,
+/// across day boundaries and the Moon's fastest days, the cache's
+/// eviction, and reuse of a cached day
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_time.dart';
+import 'package:skvk_application/core/features/astrology/engine/ephemeris_cache.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+
+/// Documented bound, in degrees
+const double _bound = 1e-5;
+
+double _difference(double a, double b) {
+  final d = (a - b).abs() % 360;
+  return d > 180 ? 360 - d : d;
+}
+
+void main() {
+  final grahas = Graha.values.length;
+
+  test('interpolated longitudes stay within the bound', () {
+    final cache = EphemerisCache();
+    final direct = Float64List(grahas);
+    final cached = Float64List(grahas);
+    var worst = 0.0;
+    // Four years in uneven steps: every hour fraction, lunar perigees and
+    // planetary stations fall somewhere in the sample
+    final start = julianDayTt(DateTime.utc(2024, 1, 1));
+    for (var jd = start; jd < start + 1461; jd += 0.6180339) {
+      grahaLongitudes(jd, direct);
+      cache.longitudes(jd, cached);
+      for (var g = 0; g < grahas; g++) {
+        final error = _difference(direct[g], cached[g]);
+        if (error > worst) worst = error;
+      }
+    }
+    expect(worst, lessThan(_bound));
+  });
+
+  test('day edges and single-graha queries agree', () {
+    final cache = EphemerisCache();
+    final direct = Float64List(grahas);
+    final day = cache.day(julianDayTt(DateTime.utc(1990, 3, 21, 12)));
+    for (final jd in [day.startJd, day.startJd + 0.999999, day.startJd + 1]) {
+      grahaLongitudes(jd, direct);
+      for (final graha in Graha.values) {
+        expect(_difference(cache.longitude(graha, jd), direct[graha.index]),
+            lessThan(_bound));
+      }
+    }
+    expect(day.covers(day.startJd + 1), isFalse);
+    expect(cache.day(day.startJd + 1).startJd, day.startJd + 1);
+  });
+
+  test('keeps the most recently used days', () {
+    final cache = EphemerisCache(capacity: 3);
+    final start = julianDayTt(DateTime.utc(2025, 6, 1)).floorToDouble();
+    final first = cache.day(start);
+    cache.day(start + 1);
+    cache.day(start + 2);
+    // Touch the first day so that the second is evicted
+    expect(identical(cache.day(start), first), isTrue);
+    cache.day(start + 3);
+    expect(cache.length, 3);
+    expect(identical(cache.day(start), first), isTrue);
+  });
+
+  test('queries within a day share one cached day', () {
+    final cache = EphemerisCache();
+    final out = Float64List(grahas);
+    final start = julianDayTt(DateTime.utc(2025, 1, 1, 0, 30));
+    const queries = 1000;
+    for (var i = 0; i < queries; i++) {
+      cache.longitudes(start + i / (queries * 2), out);
+    }
+    expect(cache.length, 1);
+  });
+}
@@ -0,0 +1,83 @@
+/// Fingerprint Tests
+///
+/// The portable trigonometry against the platform library, fingerprints
+/// through storage round trips, and their sensitivity to a single bit
+library;
+
+import 'dart:convert';
+import 'dart:math' as platform;
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/engine_math.dart'
+    as engine;
+import 'package:skvk_application/core/features/astrology/engine/fingerprint.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/varga.dart';
+
+void main() {
+  group('Portable trigonometry', () {
+    test('matches the platform library to a few ulps', () {
+      var x = -20000.0;
+      while (x < 20000) {
+        expect(engine.sin(x), closeTo(platform.sin(x), 1e-15));
+        expect(engine.cos(x), closeTo(platform.cos(x), 1e-15));
+        x += 0.7391;
+      }
+      for (var y = -3.0; y <= 3; y += 0.173) {
+        for (var z = -3.0; z <= 3; z += 0.219) {
+          expect(engine.atan2(y, z), closeTo(platform.atan2(y, z), 1e-15));
+        }
+        expect(engine.atan(y * 7), closeTo(platform.atan(y * 7), 1e-15));
+      }
+      for (var v = -0.99; v < 1; v += 0.0137) {
+        expect(engine.asin(v), closeTo(platform.asin(v), 1e-15));
+        expect(engine.acos(v), closeTo(platform.acos(v), 1e-15));
+      }
+    });
+
+    test('keeps exact values and signs', () {
+      expect(engine.sin(0), 0);
+      expect(engine.cos(0), 1);
+      expect(engine.atan2(0, -1), platform.pi);
+      expect(engine.atan2(-1, 0), -platform.pi / 2);
+      expect(engine.atan2(1, 1), closeTo(platform.pi / 4, 1e-16));
+      expect(engine.sin(double.nan).isNaN, isTrue);
+    });
+  });
+
+  group('Fingerprints', () {
+    final chart = NatalChart.compute(
+      birthUtc: DateTime.utc(1990, 5, 17, 4, 45),
+      latitude: 13.08,
+      longitude: 80.27,
+      ayanamsha: 'lahiri',
+    );
+
+    test('survive JSON storage', () {
+      final stored = jsonDecode(jsonEncode(chart.toList())) as List;
+      final restored = NatalChart.fromList(stored);
+      expect(restored.fingerprint, chart.fingerprint);
+      expect(EngineFingerprint.isCurrent(chart.fingerprint), isTrue);
+      expect(chart.fingerprint, startsWith('$engineVersion-'));
+    });
+
+    test('change with a single bit', () {
+      final values = Float64List.fromList(chart.toList());
+      values.buffer.asUint8List()[0] ^= 1;
+      expect(EngineFingerprint.of(values), isNot(chart.fingerprint));
+    });
+
+    test('are stable for repeated computation', () {
+      final again = NatalChart.compute(
+        birthUtc: DateTime.utc(1990, 5, 17, 4, 45),
+        latitude: 13.08,
+        longitude: 80.27,
+        ayanamsha: 'lahiri',
+      );
+      expect(again.fingerprint, chart.fingerprint);
+      expect(Vargas.compute(again).fingerprint,
+          Vargas.compute(chart).fingerprint);
+    });
+  });
+}
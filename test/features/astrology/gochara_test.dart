@@ -0,0 +1,69 @@
+/// Gochara Tests
+///
+/// Planet longitudes against published references, ashtakavarga totals and
+/// a year's transit matrix
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/ashtakavarga.dart';
+import 'package:skvk_application/core/features/astrology/engine/gochara.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+
+void main() {
+  group('Planetary ephemeris', () {
+    test('matches Meeus examples 25.a and 33.a', () {
+      // Sun, 1992 October 13, 0h TD
+      expect(grahaLongitude(Graha.sun, 2448908.5), closeTo(199.90988, 0.01));
+      // Venus, 1992 December 20, 0h TD
+      expect(
+          grahaLongitude(Graha.venus, 2448976.5), closeTo(313.08102, 0.01));
+    });
+
+    test('Ketu is opposite Rahu', () {
+      final rahu = grahaLongitude(Graha.rahu, 2451545);
+      final ketu = grahaLongitude(Graha.ketu, 2451545);
+      expect((ketu - rahu) % 360, closeTo(180, 1e-9));
+    });
+  });
+
+  final chart = NatalChart.compute(
+    birthUtc: DateTime.utc(1990, 5, 17, 4, 30),
+    latitude: 17.385,
+    longitude: 78.4867,
+    ayanamsha: 'lahiri',
+  );
+
+  group('Ashtakavarga', () {
+    test('bhinna totals are fixed for every chart', () {
+      final bindus = Ashtakavarga.bhinna(chart);
+      const totals = [48, 49, 39, 54, 56, 52, 39];
+      for (var p = 0; p < Ashtakavarga.planets; p++) {
+        var sum = 0;
+        for (var sign = 0; sign < 12; sign++) {
+          sum += bindus[p * 12 + sign];
+        }
+        expect(sum, totals[p]);
+      }
+    });
+  });
+
+  group('Gochara', () {
+    test('houses and taras are consistent with the natal chart', () {
+      final matrix = Gochara.year(chart, 2025, 'lahiri');
+      expect(matrix.days, 365);
+      for (var day = 0; day < matrix.days; day++) {
+        final moonHouse =
+            matrix.value(day, Graha.moon, GocharaMetric.houseFromMoon);
+        expect(moonHouse, inInclusiveRange(1, 12));
+        expect(matrix.tara(day), inInclusiveRange(1, 9));
+        expect(matrix.value(day, Graha.rahu, GocharaMetric.bindus), -1);
+        final rahu = matrix.value(day, Graha.rahu, GocharaMetric.houseFromMoon);
+        final ketu = matrix.value(day, Graha.ketu, GocharaMetric.houseFromMoon);
+        expect((ketu - rahu) % 12, 6);
+      }
+      expect(matrix.dayOf(DateTime(2025, 12, 31)), 364);
+      expect(matrix.dayOf(DateTime(2026, 1, 1)), -1);
+    });
+  });
+}
@@ -0,0 +1,75 @@
+/// Lunar Calendar Tests
+///
+/// Event times of one sweep against published new moons and sankrantis,
+/// month naming under both conventions around the 2023 adhika masa, and
+/// the months of a year
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/lunar_calendar.dart';
+
+void main() {
+  final events = LunarCalendar.scan(
+    DateTime.utc(2023),
+    DateTime.utc(2024, 2),
+    ayanamsha: 'lahiri',
+  );
+
+  void expectNear(DateTime actual, DateTime expected, Duration tolerance) {
+    expect(actual.difference(expected).abs() <= tolerance, isTrue,
+        reason: '$actual vs $expected');
+  }
+
+  test('finds new moons, full moons and sankrantis', () {
+    final newMoons = events.newMoons;
+    expect(newMoons.length, 13);
+    expectNear(newMoons[0], DateTime.utc(2023, 1, 21, 20, 53),
+        const Duration(minutes: 3));
+    expectNear(newMoons[6], DateTime.utc(2023, 7, 17, 18, 32),
+        const Duration(minutes: 3));
+    expectNear(events.fullMoons.first, DateTime.utc(2023, 1, 6, 23, 8),
+        const Duration(minutes: 3));
+
+    // Makara Sankranti 2024: 15 January, 02:54 IST
+    final makara = events.sankrantis.lastWhere((s) => s.$1 == 9);
+    expectNear(makara.$2, DateTime.utc(2024, 1, 14, 21, 24),
+        const Duration(minutes: 10));
+
+    // Thirty tithis a month, in order
+    var previous = -1;
+    for (var i = 0; i < events.length; i++) {
+      if (events.kind(i) != SkyEventKind.tithi) continue;
+      if (previous >= 0) expect(events.values[i], (previous + 1) % 30);
+      previous = events.values[i];
+    }
+  });
+
+  test('flags the 2023 Adhika Shravana', () {
+    final amanta = LunarCalendar.months(events);
+    final adhika = amanta.where((m) => m.adhika).toList();
+    expect(adhika.length, 1);
+    expect(adhika.single.name, 'Adhika Shravana');
+    expect(adhika.single.start.month, 7);
+
+    final next = amanta[amanta.indexOf(adhika.single) + 1];
+    expect(next.name, 'Shravana');
+    expect(next.adhika, isFalse);
+  });
+
+  test('purnimanta names the dark fortnight after the next month', () {
+    // Krishna Janmashtami 2023: Shravana (amanta), Bhadrapada (purnimanta)
+    final day = DateTime.utc(2023, 9, 6, 12);
+    final amanta = LunarCalendar.months(events);
+    final purnimanta = LunarCalendar.months(events,
+        convention: MonthConvention.purnimanta);
+    expect(amanta.firstWhere((m) => m.contains(day)).name, 'Shravana');
+    expect(purnimanta.firstWhere((m) => m.contains(day)).name, 'Bhadrapada');
+    expect(MonthConvention.forRegion('Delhi'), MonthConvention.purnimanta);
+    expect(MonthConvention.forRegion('Tamil Nadu'), MonthConvention.amanta);
+  });
+
+  test('a year has twelve to fourteen months', () {
+    final months = LunarCalendar.year(2025, ayanamsha: 'lahiri');
+    expect(months.length, inInclusiveRange(12, 14));
+  });
+}
@@ -0,0 +1,101 @@
+/// Panchang Tests
+///
+/// Sunrise against published times, the limbs at sunrise against direct
+/// evaluation, and batch against single-location results, however many
+/// locations share the sweep
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_time.dart';
+import 'package:skvk_application/core/features/astrology/engine/lunar_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/panchang.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+
+const _chennai = PanchangLocation(13.08, 80.27);
+const _delhi = PanchangLocation(28.61, 77.21);
+
+void main() {
+  void expectNear(DateTime? actual, DateTime expected, Duration tolerance) {
+    expect(actual, isNotNull);
+    expect(actual!.difference(expected).abs() <= tolerance, isTrue,
+        reason: '$actual vs $expected');
+  }
+
+  test('sunrise and sunset match published times', () {
+    final chennai = Panchang.single(_chennai,
+        date: DateTime(2024, 1, 15), ayanamsha: 'lahiri');
+    // 06:35 and 18:07 IST
+    expectNear(chennai.sunrise, DateTime.utc(2024, 1, 15, 1, 5),
+        const Duration(minutes: 3));
+    expectNear(chennai.sunset, DateTime.utc(2024, 1, 15, 12, 37),
+        const Duration(minutes: 3));
+    expect(chennai.vaara, 1);
+
+    // 05:24 IST on the longest day
+    final delhi = Panchang.single(_delhi,
+        date: DateTime(2024, 6, 21), ayanamsha: 'lahiri');
+    expectNear(delhi.sunrise, DateTime.utc(2024, 6, 20, 23, 54),
+        const Duration(minutes: 3));
+
+    final arctic = Panchang.single(const PanchangLocation(78.2, 15.6),
+        date: DateTime(2024, 6, 21), ayanamsha: 'lahiri');
+    expect(arctic.sunrise, isNull);
+  });
+
+  test('limbs at sunrise follow the Sun and Moon', () {
+    final table = Panchang.batch([_chennai, _delhi],
+        start: DateTime(2024, 3, 1), days: 60, ayanamsha: 'lahiri');
+    for (var l = 0; l < 2; l++) {
+      for (var d = 0; d < table.days; d++) {
+        final day = table.day(l, d);
+        final jd = julianDayTt(day.sunrise!);
+        final elongation = normalizeDegrees(moonApparentLongitude(jd) -
+            sunApparentLongitude(jd));
+        expect(day.tithi, (elongation / 12).floor());
+        expect(day.tithiEnd!.isAfter(day.sunrise!), isTrue);
+        expect(day.tithiEnd!.difference(day.sunrise!).inHours, lessThan(27));
+        expect(day.nakshatraEnd!.isAfter(day.sunrise!), isTrue);
+        expect(day.yogaEnd!.isAfter(day.sunrise!), isTrue);
+      }
+    }
+  });
+
+  test('batch cells equal single-location results', () {
+    final table = Panchang.batch([_chennai, _delhi],
+        start: DateTime(2024, 8, 10), days: 3, ayanamsha: 'lahiri');
+    final single = Panchang.single(_delhi,
+        date: DateTime(2024, 8, 12), ayanamsha: 'lahiri');
+    final cell = table.day(1, 2);
+    expect(cell.sunrise, single.sunrise);
+    expect(cell.tithi, single.tithi);
+    expect(cell.nakshatra, single.nakshatra);
+    expect(cell.karana, single.karana);
+    expect(cell.yogaEnd, single.yogaEnd);
+  });
+
+  test('locations sharing a sweep match their own batches', () {
+    final locations = [
+      for (var i = 0; i < 32; i++)
+        PanchangLocation(8.0 + i * 0.7, 70.0 + i * 0.9),
+    ];
+    final shared = Panchang.batch(locations,
+        start: DateTime(2025, 1, 1), days: 30, ayanamsha: 'lahiri');
+    for (final l in [0, 13, 31]) {
+      final own = Panchang.batch([locations[l]],
+          start: DateTime(2025, 1, 1), days: 30, ayanamsha: 'lahiri');
+      for (var d = 0; d < 30; d++) {
+        expect(shared.day(l, d).sunrise, own.day(0, d).sunrise);
+        expect(shared.day(l, d).tithi, own.day(0, d).tithi);
+        expect(shared.day(l, d).nakshatraEnd, own.day(0, d).nakshatraEnd);
+      }
+    }
+  });
+
+  test('karanas cycle through the month', () {
+    expect(Karana.ofHalf(0), Karana.kimstughna);
+    expect(Karana.ofHalf(1), Karana.bava);
+    expect(Karana.ofHalf(56), Karana.vishti);
+    expect(Karana.ofHalf(57), Karana.shakuni);
+    expect(Karana.ofHalf(59), Karana.naga);
+  });
+}
@@ -0,0 +1,67 @@
+/// Precision Tests
+///
+/// Each tier's error against [Precision.high] over two centuries and the
+/// truncated lunar series against the full one
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/astro_time.dart';
+import 'package:skvk_application/core/features/astrology/engine/lunar_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/precision.dart';
+
+/// Documented bounds in degrees: 1.5′ and 15″
+const Map<Precision, double> _bounds = {
+  Precision.fast: 1.5 / 60,
+  Precision.standard: 15 / 3600,
+};
+
+double _difference(double a, double b) {
+  final d = (a - b).abs() % 360;
+  return d > 180 ? 360 - d : d;
+}
+
+void main() {
+  final grahas = Graha.values.length;
+
+  for (final tier in _bounds.keys) {
+    test('${tier.name} tier stays within its bound', () {
+      final high = Float64List(grahas);
+      final lower = Float64List(grahas);
+      var worst = 0.0;
+      for (var year = 1900.0; year < 2100; year += 0.0731) {
+        final utc = dateTimeFromJulianDay(j2000 + (year - 2000) * 365.25);
+        grahaLongitudes(julianDayTt(utc), high);
+        grahaLongitudes(julianDayTt(utc, precision: tier), lower,
+            precision: tier);
+        for (var g = 0; g < grahas; g++) {
+          final error = _difference(high[g], lower[g]);
+          if (error > worst) worst = error;
+        }
+
+        final jd = julianDayTt(utc);
+        final sun = _difference(sunApparentLongitude(jd),
+            sunApparentLongitude(jd, precision: tier));
+        if (sun > worst) worst = sun;
+      }
+      expect(worst, lessThan(_bounds[tier]!));
+    });
+  }
+
+  test('truncated series follow the full series', () {
+    // Same instants, same nutation: only the dropped lunar terms differ
+    for (var jd = j2000 - 5000; jd < j2000 + 5000; jd += 3.17) {
+      final full = moonGeometricLongitude(jd);
+      expect(
+          _difference(full,
+              moonGeometricLongitude(jd, precision: Precision.standard)),
+          lessThanOrEqualTo(12.1 / 3600));
+      expect(
+          _difference(
+              full, moonGeometricLongitude(jd, precision: Precision.fast)),
+          lessThanOrEqualTo(38.2 / 3600));
+    }
+  });
+}
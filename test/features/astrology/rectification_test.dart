@@ -0,0 +1,87 @@
+/// Rectification Tests
+///
+/// The incremental sweep against full chart computation, range splitting,
+/// the numeric dasha periods against [Vimshottari.at], and a ±2 hour sweep
+/// at 10 s resolution
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/rectification.dart';
+import 'package:skvk_application/core/features/astrology/engine/vimshottari.dart';
+
+void main() {
+  final guess = DateTime.utc(1988, 7, 14, 3, 20);
+  final events = [
+    LifeEvent(LifeEventKind.education, DateTime.utc(2009, 6, 1)),
+    LifeEvent(LifeEventKind.career, DateTime.utc(2011, 2, 14)),
+    LifeEvent(LifeEventKind.marriage, DateTime.utc(2016, 11, 20)),
+    LifeEvent(LifeEventKind.childbirth, DateTime.utc(2019, 4, 3)),
+  ];
+  RectificationSweep sweep() => RectificationSweep.around(
+        guessUtc: guess,
+        latitude: 19.07,
+        longitude: 72.88,
+        ayanamsha: 'lahiri',
+        events: events,
+      );
+
+  test('periods match the dated dasha calculation', () {
+    final birth = DateTime.utc(1990, 1, 1);
+    for (var moon = 0.5; moon < 360; moon += 7.3) {
+      for (final years in [0.1, 3.7, 18.2, 41.9, 77.4]) {
+        final at = birth.add(Duration(hours: (years * 365.25 * 24).round()));
+        final state = Vimshottari.at(moon, birth, at);
+        final period = Vimshottari.periodIndex(
+            moon, at.difference(birth).inHours / 24);
+        expect(Vimshottari.lords[period ~/ 9], state.mahadasha.lord);
+        expect(Vimshottari.lords[period % 9], state.antardasha.lord);
+      }
+    }
+  });
+
+  test('incremental lagna and navamsa match full charts', () {
+    final s = sweep();
+    final chunk = s.evaluate(0, s.instants);
+    for (var i = 0; i < s.instants; i += 97) {
+      final chart = NatalChart.compute(
+        birthUtc: s.instant(i),
+        latitude: 19.07,
+        longitude: 72.88,
+        ayanamsha: 'lahiri',
+      );
+      final lagna = chart.lagnaLongitude;
+      // Skip instants within a hundredth of a degree of a boundary
+      if ((lagna * 9 / 30 + 0.003) % 1 < 0.006) continue;
+      expect(chunk.lagna[i], chart.rashi(NatalChart.lagna));
+      expect(chunk.navamsa[i], (lagna * 9 / 30).floor() % 12);
+    }
+  });
+
+  test('split ranges give the same candidates as one range', () {
+    final s = sweep();
+    final whole = s.run();
+    final bounds = [0, 100, 101, 700, 1200, s.instants];
+    final split = s.candidates([
+      for (var r = bounds.length - 2; r >= 0; r--)
+        s.evaluate(bounds[r], bounds[r + 1]),
+    ]);
+    expect(split.length, whole.length);
+    for (var i = 0; i < whole.length; i++) {
+      expect(split[i].startUtc, whole[i].startUtc);
+      expect(split[i].score, whole[i].score);
+    }
+    // Runs tile the window
+    final byStart = [...whole]
+      ..sort((a, b) => a.startUtc.compareTo(b.startUtc));
+    expect(byStart.first.startUtc, s.instant(0));
+    expect(byStart.last.endUtc, s.instant(s.instants - 1));
+  });
+
+  test('a full sweep covers the window and finds candidates', () {
+    final s = sweep();
+    final candidates = s.run();
+    expect(s.instants, 1441);
+    expect(candidates, isNotEmpty);
+  });
+}
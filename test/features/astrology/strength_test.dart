@@ -0,0 +1,74 @@
+/// Strength Tests
+///
+/// Sarvashtakavarga totals, shadbala component ranges and batch consistency
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/ashtakavarga.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/planetary_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/shadbala.dart';
+
+void main() {
+  final charts = [
+    for (var i = 0; i < 50; i++)
+      NatalChart.compute(
+        birthUtc: DateTime.utc(1950 + i, 1 + i % 12, 1 + i % 28, i % 24),
+        latitude: -30 + i.toDouble(),
+        longitude: 70 + i / 10,
+        ayanamsha: 'lahiri',
+      ),
+  ];
+
+  test('natal chart survives serialization', () {
+    final restored = NatalChart.fromList(charts.first.toList());
+    expect(restored.longitudes, charts.first.longitudes);
+    expect(restored.speeds, charts.first.speeds);
+    expect(restored.jdUt, charts.first.jdUt);
+    expect(() => NatalChart.fromList([1, 2, 3]), throwsFormatException);
+  });
+
+  group('Ashtakavarga', () {
+    test('sarva totals 337 and batch matches single charts', () {
+      final batch = Ashtakavarga.batch(charts);
+      for (var i = 0; i < charts.length; i++) {
+        final bhinna = Ashtakavarga.bhinna(charts[i]);
+        final sarva = Ashtakavarga.sarva(bhinna);
+        expect(sarva.fold<int>(0, (sum, v) => sum + v), 337);
+        final offset = i * Ashtakavarga.tableSize;
+        expect(batch.sublist(offset, offset + bhinna.length), bhinna);
+        expect(batch.sublist(offset + bhinna.length,
+            offset + Ashtakavarga.tableSize), sarva);
+      }
+    });
+  });
+
+  group('Shadbala', () {
+    test('components stay within their classical ranges', () {
+      for (final chart in charts) {
+        final result = Shadbala.compute(chart);
+        for (final planet in Graha.values.take(Ashtakavarga.planets)) {
+          double c(ShadbalaComponent component) =>
+              result.component(planet, component);
+          expect(c(ShadbalaComponent.dig), inInclusiveRange(0, 60));
+          expect(c(ShadbalaComponent.chesta), inInclusiveRange(0, 60));
+          expect(c(ShadbalaComponent.sthana), inInclusiveRange(15, 165));
+          expect(c(ShadbalaComponent.drik).abs(), lessThanOrEqualTo(90));
+          expect(result.total(planet), greaterThan(0));
+        }
+        expect(result.component(Graha.sun, ShadbalaComponent.naisargika), 60);
+      }
+    });
+
+    test('batch totals match single charts', () {
+      final totals = Shadbala.batch(charts);
+      for (var i = 0; i < charts.length; i++) {
+        final result = Shadbala.compute(charts[i]);
+        for (var p = 0; p < Ashtakavarga.planets; p++) {
+          expect(totals[i * Ashtakavarga.planets + p],
+              closeTo(result.total(Graha.values[p]), 1e-9));
+        }
+      }
+    });
+  });
+}
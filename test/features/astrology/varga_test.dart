@@ -0,0 +1,61 @@
+/// Varga Tests
+///
+/// Divisional signs against the Parashari rules at known longitudes, the
+/// rashi and navamsa identities
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/varga.dart';
+
+/// A chart with every point at [longitude]
+NatalChart _at(double longitude) => NatalChart(
+    Float64List.fromList(List.filled(NatalChart.points, longitude)));
+
+int _sign(double longitude, Varga varga) =>
+    Vargas.compute(_at(longitude)).sign(0, varga);
+
+void main() {
+  test('D1 is the rashi and D9 the navamsa of the longitude', () {
+    for (var longitude = 0.0; longitude < 360; longitude += 0.37) {
+      expect(_sign(longitude, Varga.d1), longitude ~/ 30);
+      expect(_sign(longitude, Varga.d9), (longitude * 9 / 30).floor() % 12);
+    }
+  });
+
+  test('follows the Parashari rules', () {
+    // Hora: odd signs Leo then Cancer, even signs Cancer then Leo
+    expect(_sign(10, Varga.d2), 4);
+    expect(_sign(20, Varga.d2), 3);
+    expect(_sign(40, Varga.d2), 3);
+    // Taurus 12°: second drekkana, the 5th sign from Taurus
+    expect(_sign(42, Varga.d3), 5);
+    // Taurus 2°: saptamsa from the 7th, dasamsa from the 9th
+    expect(_sign(32, Varga.d7), 7);
+    expect(_sign(32, Varga.d10), 9);
+    // Dwadasamsa and shashtyamsa count from the sign itself
+    expect(_sign(29.9, Varga.d12), 11);
+    expect(_sign(0.6, Varga.d60), 1);
+    // Shodasamsa and akshavedamsa of a fixed sign start from Leo
+    expect(_sign(30.5, Varga.d16), 4);
+    expect(_sign(30.5, Varga.d45), 4);
+    // Vimsamsa of a dual sign starts from Leo, of a fixed one Sagittarius
+    expect(_sign(60.5, Varga.d20), 4);
+    expect(_sign(30.5, Varga.d20), 8);
+    // Khavedamsa of an even sign starts from Libra
+    expect(_sign(30.1, Varga.d40), 6);
+    // Bhamsa of an earthy sign starts from Cancer
+    expect(_sign(30.5, Varga.d27), 3);
+  });
+
+  test('trimsamsa uses the unequal parts', () {
+    // Aries: Mars 0–5, Saturn 5–10, Jupiter 10–18, Mercury 18–25, Venus
+    const odd = [2.0, 7.0, 15.0, 20.0, 27.0];
+    expect([for (final d in odd) _sign(d, Varga.d30)], [0, 10, 8, 2, 6]);
+    // Taurus: Venus 0–5, Mercury 5–12, Jupiter 12–20, Saturn 20–25, Mars
+    const even = [2.0, 11.9, 12.0, 24.0, 29.0];
+    expect([for (final d in even) _sign(30 + d, Varga.d30)], [1, 5, 11, 9, 7]);
+  });
+}
@@ -0,0 +1,83 @@
+/// Yoga Tests
+///
+/// Classical yogas and doshas on hand-built charts, negation through the
+/// compiler and batch consistency
+library;
+
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/natal_chart.dart';
+import 'package:skvk_application/core/features/astrology/engine/yoga.dart';
+
+/// Sun, Moon, Mars, Mercury, Jupiter, Venus, Saturn, Rahu, Ketu, lagna
+NatalChart _chart(List<double> longitudes) =>
+    NatalChart(Float64List.fromList(longitudes));
+
+void main() {
+  final engine = YogaEngine.instance;
+
+  test('detects yogas and doshas of a known chart', () {
+    // Aries lagna, Moon in Cancer, Jupiter and Mars in Libra, Sun and
+    // Mercury in Taurus
+    final yogas = engine.evaluate(
+        _chart([40, 100, 185, 45, 190, 70, 300, 250, 70, 5]));
+    expect(yogas.has('gaja_kesari'), isTrue);
+    expect(yogas.has('budha_aditya'), isTrue);
+    expect(yogas.has('manglik'), isTrue);
+    expect(yogas.has('kala_sarpa'), isFalse);
+    expect(yogas.has('kemadruma'), isFalse);
+    expect(yogas.has('guru_chandala'), isFalse);
+  });
+
+  test('kala sarpa and kemadruma', () {
+    final hemmed = engine.evaluate(
+        _chart([10, 30, 50, 70, 90, 110, 130, 0, 180, 200]));
+    expect(hemmed.has('kala_sarpa'), isTrue);
+    final broken = engine.evaluate(
+        _chart([10, 30, 50, 70, 90, 110, 230, 0, 180, 200]));
+    expect(broken.has('kala_sarpa'), isFalse);
+
+    // Moon in Cancer with every other planet in Taurus
+    final alone = engine.evaluate(
+        _chart([40, 100, 40, 40, 40, 40, 40, 250, 70, 5]));
+    expect(alone.has('kemadruma'), isTrue);
+    expect(alone.has('sunapha'), isFalse);
+    expect(alone.has('anapha'), isFalse);
+  });
+
+  test('negation compiles to forbidden atoms', () {
+    final custom = YogaEngine.compile(const [
+      YogaRule(
+        'not_1_or_7',
+        'Mars away from the 1st and 7th',
+        YogaKind.yoga,
+        Not(AnyOf([
+          InHouses(ChartPoint.mars, [1]),
+          InHouses(ChartPoint.mars, [7]),
+        ])),
+      ),
+    ]);
+    double mars(int house) => (house - 1) * 30 + 15.0;
+    for (var house = 1; house <= 12; house++) {
+      final chart = _chart([0, 0, mars(house), 0, 0, 0, 0, 0, 180, 5]);
+      expect(custom.evaluate(chart)[0], house != 1 && house != 7,
+          reason: 'Mars in house $house');
+    }
+  });
+
+  test('batch matches single evaluation', () {
+    final charts = [
+      for (var i = 0; i < 2000; i++)
+        _chart([
+          for (var p = 0; p < NatalChart.points; p++)
+            (i * 37.1 + p * 53.7 * (i % 7 + 1)) % 360,
+        ]),
+    ];
+    final batch = engine.batch(charts);
+    for (var i = 0; i < charts.length; i += 37) {
+      expect(engine.batchResult(batch, i).bits,
+          engine.evaluate(charts[i]).bits);
+    }
+  });
+}
@@ -0,0 +1,172 @@
+/// Match History Store Tests
+///
+/// Index maintenance, query planning and paging over an in-memory store
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/matching/history/match_history_store.dart';
+import 'package:skvk_application/core/features/matching/history/match_record.dart';
+import 'package:skvk_application/core/features/matching/repositories/matching_repository.dart';
+import 'package:skvk_application/core/services/storage/kv_store.dart';
+
+const _nakshatras = ['Ashwini', 'Bharani', 'Krittika', 'Rohini'];
+const _rashis = ['Mesha', 'Vrishabha'];
+
+MatchPartner _partner(String name, int seed) => MatchPartner(
+      name: name,
+      dateOfBirth: DateTime(1990, 1, 1).add(Duration(minutes: seed * 7)),
+      placeOfBirth: 'Chennai',
+      latitude: 13.08,
+      longitude: 80.27,
+    );
+
+/// Deterministic result: score i % 37, nadi 0 on every third match
+MatchingResult _result(int i) {
+  final sameRashi = i % 2 == 0;
+  return MatchingResult(
+    compatibilityScore: (i % 37) / 36 * 100,
+    kootaDetails: {
+      'Nadi': i % 3 == 0 ? '0' : '8',
+      'person1Nakshatram': _nakshatras[i % 4],
+      'person2Nakshatram': _nakshatras[(i + 1) % 4],
+      'person1Raasi': _rashis[0],
+      'person2Raasi': sameRashi ? _rashis[0] : _rashis[1],
+      'totalPoints': '${i % 37}',
+    },
+    level: 'Good',
+    recommendation: '',
+    totalScore: i % 37,
+  );
+}
+
+Future<List<MatchRecord>> _drain(MatchHistoryStore store, MatchQuery query,
+    {int pageSize = 7}) async {
+  final all = <MatchRecord>[];
+  String? cursor;
+  do {
+    final page = await store.query(query, pageSize: pageSize, cursor: cursor);
+    all.addAll(page.records);
+    cursor = page.cursor;
+  } while (cursor != null);
+  return all;
+}
+
+void main() {
+  group('MatchHistoryStore', () {
+    late MatchHistoryStore store;
+    final start = DateTime(2025, 1, 1);
+    const count = 300;
+
+    setUp(() async {
+      store = MatchHistoryStore.withStore(
+          await KvStore.open(MemoryKvBackend()));
+      for (var i = 0; i < count; i++) {
+        await store.save(
+          person1: _partner(i.isEven ? 'Ravi' : 'Arjun', i),
+          person2: _partner('Sita', i + count),
+          ayanamsha: 'lahiri',
+          houseSystem: 'placidus',
+          result: _result(i),
+          createdAt: start.add(Duration(hours: i)),
+        );
+      }
+    });
+
+    test('pages through everything newest first', () async {
+      final all = await _drain(store, MatchQuery.all);
+      expect(all, hasLength(count));
+      for (var i = 1; i < all.length; i++) {
+        expect(all[i - 1].createdAt.isAfter(all[i].createdAt), isTrue);
+      }
+    });
+
+    test('score and nadi query returns highest score first', () async {
+      const query =
+          MatchQuery(minScore: 24, nadiDosha: NadiDosha.cancelled);
+      final results = await _drain(store, query);
+
+      final expected = [
+        for (var i = 0; i < count; i++)
+          if (i % 37 >= 24 && i % 3 == 0 && i.isEven) i,
+      ];
+      expect(results, hasLength(expected.length));
+      for (final record in results) {
+        expect(record.totalScore, greaterThanOrEqualTo(24));
+        expect(record.nadiDosha, NadiDosha.cancelled);
+      }
+      for (var i = 1; i < results.length; i++) {
+        expect(results[i - 1].totalScore,
+            greaterThanOrEqualTo(results[i].totalScore));
+      }
+    });
+
+    test('index range limits the entries scanned', () async {
+      final page = await store.query(
+          const MatchQuery(minScore: 36), pageSize: 100);
+      expect(page.records.every((r) => r.totalScore == 36), isTrue);
+      expect(page.scanned, page.records.length);
+    });
+
+    test('term indexes combine with residual conditions', () async {
+      final results = await _drain(
+          store, const MatchQuery(name: 'rav', nakshatra: 'rohini'));
+      final expected = [
+        for (var i = 0; i < count; i++)
+          if (i.isEven && (i % 4 == 3 || (i + 1) % 4 == 3)) i,
+      ];
+      expect(results, hasLength(expected.length));
+
+      final byDate = await _drain(store, MatchQuery(
+          from: start.add(const Duration(hours: 10)),
+          to: start.add(const Duration(hours: 20))));
+      expect(byDate, hasLength(10));
+    });
+
+    test('a match is returned once when both names share the prefix',
+        () async {
+      final both = MatchHistoryStore.withStore(
+          await KvStore.open(MemoryKvBackend()));
+      for (var i = 0; i < 5; i++) {
+        await both.save(
+          person1: _partner('Arjun', i),
+          person2: _partner('Anita', i),
+          ayanamsha: 'lahiri',
+          houseSystem: 'placidus',
+          result: _result(i),
+          createdAt: start.add(Duration(hours: i)),
+        );
+      }
+      for (final pageSize in [1, 2, 3, 10]) {
+        final results =
+            await _drain(both, const MatchQuery(name: 'a'), pageSize: pageSize);
+        expect(results.map((r) => r.id).toSet(), hasLength(5));
+        expect(results, hasLength(5));
+      }
+    });
+
+    test('same inputs replace the saved match and reopen it', () async {
+      final person1 = _partner('Ravi', 0);
+      final person2 = _partner('Sita', count);
+      final saved = await store.findByInputs(
+        person1: person1,
+        person2: person2,
+        ayanamsha: 'lahiri',
+        houseSystem: 'placidus',
+      );
+      expect(saved, isNotNull);
+      expect(saved!.totalScore, 0);
+
+      await store.save(
+        person1: person1,
+        person2: person2,
+        ayanamsha: 'lahiri',
+        houseSystem: 'placidus',
+        result: _result(30),
+      );
+      expect(await store.count(), count);
+      final scoreZero = await _drain(
+          store, const MatchQuery(minScore: 0, maxScore: 0));
+      expect(scoreZero.any((r) => r.id == saved.id), isFalse);
+    });
+  });
+}
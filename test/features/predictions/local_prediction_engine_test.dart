@@ -0,0 +1,94 @@
+/// Local Prediction Engine Tests
+///
+/// Lunar longitude against a published reference, dasha sequencing and a
+/// year of daily payloads
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/astrology/engine/lunar_ephemeris.dart';
+import 'package:skvk_application/core/features/astrology/engine/vimshottari.dart';
+import 'package:skvk_application/core/features/predictions/local/local_prediction_engine.dart';
+
+void main() {
+  group('Lunar ephemeris', () {
+    test('matches Meeus example 47.a', () {
+      // 1992 April 12, 0h TD
+      expect(moonGeometricLongitude(2448724.5), closeTo(133.162655, 1e-5));
+      expect(moonApparentLongitude(2448724.5), closeTo(133.167265, 1e-3));
+    });
+  });
+
+  group('Vimshottari', () {
+    final birth = DateTime.utc(1990, 1, 1);
+
+    test('moon at the start of Ashwini runs the full Ketu dasha', () {
+      final atBirth = Vimshottari.at(0, birth, birth);
+      expect(atBirth.mahadasha.lord, 'Ketu');
+      expect(atBirth.mahadasha.start, birth);
+      expect(atBirth.antardasha.lord, 'Ketu');
+
+      final later = Vimshottari.at(0, birth, DateTime.utc(1997, 6, 1));
+      expect(later.mahadasha.lord, 'Venus');
+      expect(later.antardasha.lord, 'Venus');
+    });
+
+    test('balance shortens the first dasha', () {
+      // Halfway through Bharani: 10 of Venus' 20 years remain
+      final state = Vimshottari.at(
+          nakshatraSpan * 1.5, birth, DateTime.utc(1999, 6, 1));
+      expect(state.mahadasha.lord, 'Venus');
+      expect(
+          Vimshottari.at(nakshatraSpan * 1.5, birth, DateTime.utc(2000, 6, 1))
+              .mahadasha
+              .lord,
+          'Sun');
+    });
+  });
+
+  group('LocalPredictionEngine', () {
+    final birthUtc = DateTime.utc(1990, 5, 17, 4, 30);
+    final natal = MoonPosition.at(birthUtc, 'lahiri');
+
+    test('birth day transit is Janma tara in the 1st house', () {
+      final payload = LocalPredictionEngine.daily(
+        natal: natal,
+        birthUtc: birthUtc,
+        targetUtc: birthUtc,
+        ayanamsha: 'lahiri',
+      );
+      expect(payload['taraBala']['number'], 1);
+      expect(payload['chandraBala']['house'], 1);
+      expect(payload['moon']['nakshatra']['number'], natal.nakshatra + 1);
+      expect(payload['generalOutlook'], contains('birth star'));
+      expect(payload['predictions']['career']['content'], isNotEmpty);
+      expect(payload['dasha']['influence'], isNotEmpty);
+    });
+
+    test('renders the payload in the requested language', () {
+      final payload = LocalPredictionEngine.daily(
+        natal: natal,
+        birthUtc: birthUtc,
+        targetUtc: birthUtc,
+        ayanamsha: 'lahiri',
+        language: 'hindi',
+      );
+      expect(payload['language'], 'hindi');
+      expect(payload['generalOutlook'], isNot(contains('birth star')));
+      expect(payload['dasha']['mahadasha'], isNotEmpty);
+    });
+
+    test('every day of a year has a complete payload', () {
+      final start = DateTime.utc(2025, 1, 1, 0, 30);
+      for (var day = 0; day < 365; day++) {
+        final payload = LocalPredictionEngine.daily(
+          natal: natal,
+          birthUtc: birthUtc,
+          targetUtc: start.add(Duration(days: day)),
+          ayanamsha: 'lahiri',
+        );
+        expect(payload['generalOutlook'], isNotEmpty, reason: 'day $day');
+        expect(payload['dasha']['mahadasha'], isNotEmpty, reason: 'day $day');
+      }
+    });
+  });
+}
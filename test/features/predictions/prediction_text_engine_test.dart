@@ -0,0 +1,104 @@
+/// Prediction Text Engine Tests
+///
+/// Template compilation, grammatical forms, language fallback and repeat
+/// rendering
+library;
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/features/predictions/text/prediction_text_engine.dart';
+import 'package:skvk_application/core/features/predictions/text/prediction_text_packs.dart';
+
+void main() {
+  PredictionFacts sample() => PredictionFacts()
+    ..[PredictionFact.tara] = 2
+    ..[PredictionFact.house] = 3
+    ..[PredictionFact.nakshatra] = 3
+    ..[PredictionFact.transitRashi] = 0
+    ..[PredictionFact.dayQuality] = TransitQuality.good.index
+    ..[PredictionFact.goodDays] = 5;
+
+  CompiledLanguage single(String language, String template) {
+    final pack = PredictionTextPacks.packs[language]!;
+    return CompiledLanguage.compile(PredictionLanguagePack(
+      words: pack.words,
+      forms: pack.forms,
+      numberForms: pack.numberForms,
+      sections: {
+        'test': [TemplateRule(template)],
+      },
+    ));
+  }
+
+  group('Template compilation', () {
+    test('renders slots, text values and escaped braces', () {
+      final english =
+          single('english', 'Moon in {nakshatra} {{{who}}} {house:ord}');
+      expect(english.render('test', sample(), {'who': 'you'}),
+          'Moon in Rohini {you} 3rd');
+    });
+
+    test('rejects malformed templates', () {
+      final forms = {'': 0};
+      expect(() => CompiledLanguage.compileTemplate('{nakshatra', forms),
+          throwsFormatException);
+      expect(() => CompiledLanguage.compileTemplate('a } b', forms),
+          throwsFormatException);
+      expect(() => CompiledLanguage.compileTemplate('{nakshatra:dat}', forms),
+          throwsFormatException);
+      expect(() => CompiledLanguage.compileTemplate('{dayQuality}', forms),
+          throwsFormatException);
+    });
+
+    test('rules are selected by fact values', () {
+      final facts = sample();
+      final engine = PredictionTextEngine.instance;
+      final good = engine.render('english', 'week_overview', facts);
+      facts[PredictionFact.goodDays] = 1;
+      expect(engine.render('english', 'week_overview', facts),
+          isNot(equals(good)));
+    });
+  });
+
+  group('Grammatical forms', () {
+    test('Tamil locative follows the word ending', () {
+      final tamil = single('tamil', '{transitRashi:loc}');
+      expect(tamil.render('test', sample()), 'மேஷத்தில்');
+    });
+
+    test('Hindi renders the postposition and oblique ordinal', () {
+      final hindi = single('hindi', '{nakshatra:loc}, {house:ord}');
+      expect(hindi.render('test', sample()), 'रोहिणी में, तीसरे');
+    });
+  });
+
+  group('PredictionTextEngine', () {
+    test('languages without a pack use English', () {
+      final engine = PredictionTextEngine.instance;
+      final sections = PredictionTextPacks.packs['english']!.sections.keys;
+      for (final section in sections) {
+        expect(engine.render('bengali', section, sample()),
+            engine.render('english', section, sample()));
+      }
+    });
+
+    test('every pack renders every section', () {
+      final engine = PredictionTextEngine.instance;
+      final sections = PredictionTextPacks.packs['english']!.sections.keys;
+      for (final language in PredictionTextPacks.packs.keys) {
+        for (final section in sections) {
+          expect(engine.render(language, section, sample()), isNotEmpty,
+              reason: '$language/$section');
+        }
+      }
+    });
+
+    test('compiled templates render the same text every time', () {
+      final engine = PredictionTextEngine.instance;
+      final facts = sample();
+      final first = engine.render('tamil', 'outlook', facts);
+      for (var i = 0; i < 3; i++) {
+        expect(engine.render('tamil', 'outlook', facts), first);
+      }
+    });
+  });
+}
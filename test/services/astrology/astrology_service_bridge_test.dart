@@ -0,0 +1,126 @@
+/// Astrology Service Bridge Tests
+///
+/// Schema-driven conversion of calendar times, and reuse of converted
+/// results exactly while the API cache holds their response
+library;
+
+import 'dart:convert';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+import 'package:skvk_application/core/services/astrology/astrology_api_service.dart';
+import 'package:skvk_application/core/services/astrology/astrology_service_bridge.dart';
+import 'package:skvk_application/core/services/astrology/local_time_converter.dart';
+import 'package:skvk_application/core/services/shared/cache_service.dart';
+import 'package:skvk_application/core/utils/astrology/timezone_util.dart';
+
+const _zone = 'Asia/Kolkata';
+
+/// A calendar year in the API's shape, with UTC times
+Map<String, dynamic> _year(int year) => {
+      'year': year,
+      'calculatedAt': '$year-01-01T00:00:00Z',
+      'months': {
+        for (var m = 1; m <= 12; m++)
+          '$m': {
+            'days': [
+              for (var d = 1; d <= DateTime.utc(year, m + 1, 0).day; d++)
+                {
+                  'date': DateTime.utc(year, m, d)
+                      .toIso8601String()
+                      .substring(0, 10),
+                  for (final (key, hour) in [
+                    ('sunrise', 1),
+                    ('sunset', 12),
+                    ('moonrise', 5),
+                    ('moonset', 17),
+                  ])
+                    key: {
+                      'time': DateTime.utc(year, m, d, hour, 5)
+                          .toIso8601String(),
+                    },
+                  'tithi': {
+                    'name': 'Tithi ${d % 30 + 1}',
+                    'endTime':
+                        DateTime.utc(year, m, d, 20, 40).toIso8601String(),
+                  },
+                  'panchangam': {
+                    'rahuKaal': {'start': '10:30', 'end': '12:00'},
+                  },
+                  'festivals': [
+                    {'name': 'Festival $d'},
+                  ],
+                },
+            ],
+          },
+      },
+    };
+
+void main() {
+  setUpAll(() => TimezoneUtil.initialize());
+
+  var requests = 0;
+  final year = jsonEncode(_year(2025));
+  final bridge = AstrologyServiceBridge.create(
+    apiService: AstrologyApiService.create(
+      baseUrl: 'http://localhost',
+      cache: CacheService.instance,
+      client: MockClient((request) async {
+        requests++;
+        return http.Response(year, 200,
+            headers: {'content-type': 'application/json'});
+      }),
+    ),
+  );
+
+  Future<Map<String, dynamic>> fetch() => bridge.getCalendarYear(
+        year: 2025,
+        region: 'Tamil Nadu',
+        latitude: 13.08,
+        longitude: 80.27,
+        timezoneId: _zone,
+      );
+
+  test('converts only the schema\'s time fields', () {
+    final converted = LocalTimeConverter(_zone).convert({
+      'calculatedAt': '2025-01-01T00:00:00Z',
+      'days': [
+        {
+          'date': '2025-01-15',
+          'sunrise': {'time': '2025-01-15T01:05:00.000Z'},
+          'note': '2025-01-15T01:05:00.000Z',
+        },
+      ],
+    }, TimeFieldSchema.calendarMonth);
+
+    final day = (converted['days'] as List).single as Map<String, dynamic>;
+    expect(converted['calculatedAt'], '2025-01-01T05:30:00.000');
+    expect((day['sunrise'] as Map)['time'], '2025-01-15T06:35:00.000');
+    // Calendar dates and fields outside the schema are left alone
+    expect(day['date'], '2025-01-15');
+    expect(day['note'], '2025-01-15T01:05:00.000Z');
+    expect(() => day['date'] = '', throwsUnsupportedError);
+  });
+
+  test('reuses the converted year while the API cache holds it', () async {
+    final first = await fetch();
+    final second = await fetch();
+    expect(requests, 1);
+    expect(identical(first, second), isTrue);
+
+    final january = (first['months'] as Map)['1'] as Map;
+    final day = (january['days'] as List).first as Map;
+    expect((day['tithi'] as Map)['endTime'], '2025-01-02T02:10:00.000');
+  });
+
+  test('converts again once the API cache refetches', () async {
+    final first = await fetch();
+    final before = requests;
+    CacheService.instance.clear();
+    final refetched = await fetch();
+    expect(requests, before + 1);
+    expect(identical(first, refetched), isFalse);
+    expect(refetched, first);
+    expect(identical(await fetch(), refetched), isTrue);
+  });
+}
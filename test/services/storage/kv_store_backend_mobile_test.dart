@@ -0,0 +1,85 @@
+/// File KV Backend Tests
+///
+/// The lock file behind [FileKvBackend.exclusive]: abandoned locks of dead
+/// processes, locks held by this process, and release by the owner only
+library;
+
+import 'dart:io';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/services/storage/kv_store_backend_mobile.dart';
+
+void main() {
+  late Directory dir;
+  late File lock;
+  late FileKvBackend backend;
+
+  setUp(() async {
+    dir = await Directory.systemTemp.createTemp('kv_backend_test');
+    lock = File('${dir.path}/store.lock');
+    backend = FileKvBackend(dir.path, 'store');
+  });
+
+  tearDown(() async {
+    await backend.close();
+    await dir.delete(recursive: true);
+  });
+
+  group('FileKvBackend', () {
+    test('a lock left by a dead process is broken without waiting', () async {
+      await lock.writeAsString('999999999 deadbeef');
+
+      // Far below staleLock: only the holder's pid decides
+      final result = await backend
+          .exclusive(() async => 'entered')
+          .timeout(const Duration(seconds: 5));
+
+      expect(result, 'entered');
+      expect(await lock.exists(), isFalse);
+      expect(dir.listSync().where((f) => f.path.endsWith('.break')), isEmpty);
+    });
+
+    test('a fresh lock of this process is waited for', () async {
+      await lock.writeAsString('$pid cafef00d');
+
+      var entered = false;
+      final done = backend.exclusive(() async => entered = true);
+      await Future<void>.delayed(const Duration(milliseconds: 100));
+      expect(entered, isFalse);
+
+      await lock.delete();
+      await done.timeout(const Duration(seconds: 5));
+      expect(entered, isTrue);
+    });
+
+    test('an opener deletes only its own lock', () async {
+      await backend.exclusive(() async {
+        // Taken over, as by a breaker that judged this opener dead
+        await lock.writeAsString('999999999 0badf00d');
+      });
+
+      expect(await lock.readAsString(), '999999999 0badf00d');
+    });
+
+    test('openers on the same files take turns', () async {
+      final other = FileKvBackend(dir.path, 'store');
+      var inside = 0;
+      var overlapped = false;
+      Future<void> section() async {
+        inside++;
+        if (inside > 1) overlapped = true;
+        await Future<void>.delayed(const Duration(milliseconds: 5));
+        inside--;
+      }
+
+      await Future.wait([
+        for (var i = 0; i < 5; i++) ...[
+          backend.exclusive(section),
+          other.exclusive(section),
+        ],
+      ]);
+
+      expect(overlapped, isFalse);
+      expect(await lock.exists(), isFalse);
+    });
+  });
+}
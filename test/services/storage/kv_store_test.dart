@@ -0,0 +1,309 @@
+/// KV Store Tests
+///
+/// Crash consistency (torn and corrupt log records, crashes during
+/// compaction), atomic batches and lazy decoding, using the in-memory backend
+library;
+
+import 'dart:typed_data';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:skvk_application/core/services/storage/kv_store.dart';
+
+/// Backend that can "crash" a write after a chosen number of bytes
+class _CrashingBackend extends MemoryKvBackend {
+  _CrashingBackend({super.snapshot, super.log});
+
+  /// Bytes of the next append that reach the log before the crash
+  int? crashAfter;
+
+  @override
+  Future<void> appendLog(Uint8List record) async {
+    final limit = crashAfter;
+    if (limit != null) {
+      await super.appendLog(Uint8List.sublistView(record, 0, limit));
+      throw StateError('simulated crash');
+    }
+    await super.appendLog(record);
+  }
+}
+
+/// Backend whose log reset is lost, as if the app died right after the new
+/// snapshot was renamed into place
+class _LostTruncateBackend extends MemoryKvBackend {
+  @override
+  Future<void> truncateLog(int length) async {
+    if (length == 0) throw StateError('simulated crash');
+    await super.truncateLog(length);
+  }
+}
+
+/// Backend that counts full log reads
+class _CountingBackend extends MemoryKvBackend {
+  int logReads = 0;
+
+  @override
+  Future<Uint8List?> readLog() {
+    logReads++;
+    return super.readLog();
+  }
+}
+
+Map<String, String> _contents(KvTable<String> table) =>
+    {for (final entry in table.scan()) entry.key: entry.value};
+
+void main() {
+  group('KvStore', () {
+    test('typed tables round-trip through the log', () async {
+      final backend = MemoryKvBackend();
+      final store = await KvStore.open(backend);
+      await store.table('names', KvCodec.string).put('a', 'alpha');
+      await store.table('counts', KvCodec.int64).put('a', 42);
+      await store.table('profile', KvCodec.json).put('p', {'x': 1.5});
+
+      final reopened =
+          await KvStore.open(MemoryKvBackend(log: backend.logBytes));
+      expect(reopened.table('names', KvCodec.string).get('a'), 'alpha');
+      expect(reopened.table('counts', KvCodec.int64).get('a'), 42);
+      expect(reopened.table('profile', KvCodec.json).get('p'), {'x': 1.5});
+    });
+
+    test('values are decoded lazily and once', () async {
+      final backend = MemoryKvBackend();
+      final store = await KvStore.open(backend);
+      await store.table('names', KvCodec.string).put('a', 'alpha');
+
+      var decodes = 0;
+      final codec = KvCodec<String>(
+        encode: KvCodec.string.encode,
+        decode: (bytes) {
+          decodes++;
+          return KvCodec.string.decode(bytes);
+        },
+      );
+      final reopened =
+          await KvStore.open(MemoryKvBackend(log: backend.logBytes));
+      final table = reopened.table('names', codec);
+      expect(decodes, 0);
+      expect(table.get('a'), 'alpha');
+      expect(table.get('a'), 'alpha');
+      expect(decodes, 1);
+    });
+
+    test('scan respects bounds, order and limit', () async {
+      final store = await KvStore.open(MemoryKvBackend());
+      final table = store.table('t', KvCodec.string);
+      await store.write((batch) {
+        for (final key in ['a', 'b', 'c', 'd', 'e']) {
+          batch.put(table, key, key.toUpperCase());
+        }
+      });
+
+      expect(table.scan(start: 'b', end: 'e').map((e) => e.key),
+          ['b', 'c', 'd']);
+      expect(table.scan(descending: true, limit: 2).map((e) => e.key),
+          ['e', 'd']);
+      expect(table.scan(start: 'bb', end: 'd', descending: true)
+          .map((e) => e.key), ['c']);
+    });
+
+    test('a batch torn at any byte is recovered entirely or not at all',
+        () async {
+      final base = MemoryKvBackend();
+      final store = await KvStore.open(base);
+      final table = store.table('t', KvCodec.string);
+      await store.write((batch) => batch
+        ..put(table, 'a', '1')
+        ..put(table, 'b', '1'));
+      final before = base.logBytes;
+
+      final probe = MemoryKvBackend(log: before);
+      final probeStore = await KvStore.open(probe);
+      final probeTable = probeStore.table('t', KvCodec.string);
+      await probeStore.write((batch) => batch
+        ..put(probeTable, 'a', '2')
+        ..delete(probeTable, 'b')
+        ..put(probeTable, 'c', '2'));
+      final recordLength = probe.logBytes.length - before.length;
+
+      for (var cut = 0; cut <= recordLength; cut++) {
+        final backend = _CrashingBackend(log: before)
+          ..crashAfter = cut < recordLength ? cut : null;
+        final writer = await KvStore.open(backend);
+        final writerTable = writer.table('t', KvCodec.string);
+        try {
+          await writer.write((batch) => batch
+            ..put(writerTable, 'a', '2')
+            ..delete(writerTable, 'b')
+            ..put(writerTable, 'c', '2'));
+        } on StateError {
+          // Crashed mid-append
+        }
+
+        final recovered = await KvStore.open(
+            MemoryKvBackend(log: backend.logBytes));
+        final contents = _contents(recovered.table('t', KvCodec.string));
+        if (cut < recordLength) {
+          expect(contents, {'a': '1', 'b': '1'}, reason: 'cut at $cut');
+        } else {
+          expect(contents, {'a': '2', 'c': '2'});
+        }
+      }
+    });
+
+    test('recovery stops at a corrupt record and drops the tail', () async {
+      final backend = MemoryKvBackend();
+      final store = await KvStore.open(backend);
+      final table = store.table('t', KvCodec.string);
+      await table.put('a', '1');
+      final firstLength = backend.logBytes.length;
+      await table.put('b', '1');
+      await table.put('c', '1');
+
+      final log = backend.logBytes;
+      log[firstLength + 12] ^= 0xFF; // Flip a byte inside the second record
+
+      final damaged = MemoryKvBackend(log: log);
+      final recovered = await KvStore.open(damaged);
+      expect(_contents(recovered.table('t', KvCodec.string)), {'a': '1'});
+      expect(damaged.logBytes.length, firstLength);
+
+      // New writes land after the intact prefix
+      await recovered.table('t', KvCodec.string).put('d', '1');
+      final again = await KvStore.open(MemoryKvBackend(log: damaged.logBytes));
+      expect(_contents(again.table('t', KvCodec.string)),
+          {'a': '1', 'd': '1'});
+    });
+
+    test('compaction keeps the contents and shrinks the log', () async {
+      final backend = MemoryKvBackend();
+      final store = await KvStore.open(backend);
+      final table = store.table('t', KvCodec.string);
+      for (var i = 0; i < 20; i++) {
+        await table.put('k${i % 4}', 'v$i');
+      }
+      await store.compact();
+      expect(backend.logBytes, isEmpty);
+
+      await table.put('k0', 'after');
+      final reopened = await KvStore.open(MemoryKvBackend(
+          snapshot: backend.snapshot, log: backend.logBytes));
+      expect(_contents(reopened.table('t', KvCodec.string)),
+          {'k0': 'after', 'k1': 'v17', 'k2': 'v18', 'k3': 'v19'});
+    });
+
+    test('a crash between snapshot and log reset is harmless', () async {
+      final backend = _LostTruncateBackend();
+      final store = await KvStore.open(backend);
+      final table = store.table('t', KvCodec.string);
+      await table.put('a', '1');
+      await table.put('b', '1');
+      await table.delete('a');
+      await expectLater(store.compact(), throwsStateError);
+
+      // The old log is still there next to the new snapshot
+      expect(backend.logBytes, isNotEmpty);
+      final recovered = MemoryKvBackend(
+          snapshot: backend.snapshot, log: backend.logBytes);
+      final reopened = await KvStore.open(recovered);
+      final reopenedTable = reopened.table('t', KvCodec.string);
+      expect(_contents(reopenedTable), {'b': '1'});
+
+      // Writes after recovery are not skipped as stale
+      await reopenedTable.put('a', '2');
+      final last = await KvStore.open(MemoryKvBackend(
+          snapshot: recovered.snapshot, log: recovered.logBytes));
+      expect(_contents(last.table('t', KvCodec.string)),
+          {'a': '2', 'b': '1'});
+    });
+
+    test('writes issued during compaction survive a reopen', () async {
+      final backend = MemoryKvBackend();
+      final store = await KvStore.open(backend);
+      final table = store.table('t', KvCodec.string);
+      await table.put('a', '1');
+
+      final compaction = store.compact();
+      final write = table.put('b', '1');
+      await Future.wait([compaction, write]);
+
+      final reopened = await KvStore.open(MemoryKvBackend(
+          snapshot: backend.snapshot, log: backend.logBytes));
+      expect(_contents(reopened.table('t', KvCodec.string)),
+          {'a': '1', 'b': '1'});
+    });
+
+    test('a secondary opener sees writes and survives compaction', () async {
+      final backend = MemoryKvBackend();
+      final primary = await KvStore.open(backend);
+      final secondary = await KvStore.open(backend, isPrimary: false);
+      final primaryTable = primary.table('t', KvCodec.string);
+      final secondaryTable = secondary.table('t', KvCodec.string);
+
+      await primaryTable.put('a', '1');
+      await secondary.refresh();
+      expect(secondaryTable.get('a'), '1');
+
+      await primary.compact();
+      await secondaryTable.put('b', '1');
+
+      // Both the primary's compaction and the secondary's append survive
+      await primary.compact();
+      final reopened = await KvStore.open(MemoryKvBackend(
+          snapshot: backend.snapshot, log: backend.logBytes));
+      expect(_contents(reopened.table('t', KvCodec.string)),
+          {'a': '1', 'b': '1'});
+    });
+
+    test('refreshIfChanged reloads only after another opener writes',
+        () async {
+      final backend = _CountingBackend();
+      final primary = await KvStore.open(backend);
+      final secondary = await KvStore.open(backend, isPrimary: false);
+      final primaryTable = primary.table('t', KvCodec.string);
+
+      await primaryTable.put('a', '1');
+      final reads = backend.logReads;
+      await primary.refreshIfChanged();
+      expect(backend.logReads, reads);
+
+      await secondary.table('t', KvCodec.string).put('b', '1');
+      await primary.refreshIfChanged();
+      expect(backend.logReads, reads + 1);
+      expect(primaryTable.get('b'), '1');
+    });
+
+    test('a secondary append racing a compaction is kept', () async {
+      final backend = MemoryKvBackend();
+      final primary = await KvStore.open(backend);
+      final secondary = await KvStore.open(backend, isPrimary: false);
+      await primary.table('t', KvCodec.string).put('a', '1');
+
+      await Future.wait([
+        primary.compact(),
+        secondary.table('t', KvCodec.string).put('b', '1'),
+        primary.compact(),
+      ]);
+
+      final reopened = await KvStore.open(MemoryKvBackend(
+          snapshot: backend.snapshot, log: backend.logBytes));
+      expect(_contents(reopened.table('t', KvCodec.string)),
+          {'a': '1', 'b': '1'});
+    });
+
+    test('a secondary cuts a torn tail before appending', () async {
+      final source = MemoryKvBackend();
+      final writer = await KvStore.open(source);
+      await writer.table('t', KvCodec.string).put('a', '1');
+      final backend = MemoryKvBackend(
+          log: Uint8List.fromList([...source.logBytes, 9, 0, 0, 0, 1]));
+
+      final secondary = await KvStore.open(backend, isPrimary: false);
+      expect(backend.logBytes.length, source.logBytes.length);
+      await secondary.table('t', KvCodec.string).put('b', '1');
+
+      final reopened =
+          await KvStore.open(MemoryKvBackend(log: backend.logBytes));
+      expect(_contents(reopened.table('t', KvCodec.string)),
+          {'a': '1', 'b': '1'});
+    });
+  });
+}
@@ -0,0 +1,170 @@
+/// Bridge Cache Benchmark
+///
+/// Times a calendar year served from the API cache two ways: converting
+/// every time-like field of a deep copy on each call, as the bridge did
+/// before it kept converted results, against the bridge's cached path. The
+/// first, schema-driven conversion is reported too. The bridge needs the
+/// Flutter bindings, so run from the project root with
+/// `flutter test tool/bench_bridge_cache.dart`; it reports and never fails
+/// on timing. Caching correctness is covered by
+/// `test/services/astrology/astrology_service_bridge_test.dart`.
+library;
+
+import 'dart:convert';
+import 'package:flutter_test/flutter_test.dart';
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+import 'package:skvk_application/core/services/astrology/astrology_api_service.dart';
+import 'package:skvk_application/core/services/astrology/astrology_service_bridge.dart';
+import 'package:skvk_application/core/services/shared/cache_service.dart';
+import 'package:skvk_application/core/utils/astrology/timezone_util.dart';
+
+const _zone = 'Asia/Kolkata';
+const _warmup = 5;
+const _calls = 50;
+
+/// A calendar year in the API's shape, with UTC times
+Map<String, dynamic> _year(int year) => {
+      'year': year,
+      'calculatedAt': '$year-01-01T00:00:00Z',
+      'months': {
+        for (var m = 1; m <= 12; m++)
+          '$m': {
+            'days': [
+              for (var d = 1; d <= DateTime.utc(year, m + 1, 0).day; d++)
+                {
+                  'date': DateTime.utc(year, m, d)
+                      .toIso8601String()
+                      .substring(0, 10),
+                  for (final (key, hour) in [
+                    ('sunrise', 1),
+                    ('sunset', 12),
+                    ('moonrise', 5),
+                    ('moonset', 17),
+                  ])
+                    key: {
+                      'time': DateTime.utc(year, m, d, hour, 5)
+                          .toIso8601String(),
+                    },
+                  'tithi': {
+                    'name': 'Tithi ${d % 30 + 1}',
+                    'endTime':
+                        DateTime.utc(year, m, d, 20, 40).toIso8601String(),
+                  },
+                  'panchangam': {
+                    'rahuKaal': {'start': '10:30', 'end': '12:00'},
+                  },
+                  'festivals': [
+                    {'name': 'Festival $d'},
+                  ],
+                },
+            ],
+          },
+      },
+    };
+
+/// Every-call deep conversion, as the bridge did before its cache
+Map<String, dynamic> _convertEveryField(
+    Map<String, dynamic> response, String timezoneId) {
+  const fields = [
+    'birthDateTime',
+    'calculatedAt',
+    'date',
+    'sunrise',
+    'sunset',
+    'moonrise',
+    'moonset',
+    'sunriseTime',
+    'sunsetTime',
+    'moonriseTime',
+    'moonsetTime',
+    'startTime',
+    'endTime',
+    'time',
+  ];
+  final converted = Map<String, dynamic>.from(response);
+  for (final field in fields) {
+    final value = converted[field];
+    if (value is! String) continue;
+    try {
+      converted[field] = TimezoneUtil.convertUTCToLocal(
+              DateTime.parse(value), timezoneId)
+          .toIso8601String();
+    } catch (_) {}
+  }
+  converted.forEach((key, value) {
+    if (value is Map<String, dynamic>) {
+      converted[key] = _convertEveryField(value, timezoneId);
+    } else if (value is List) {
+      converted[key] = [
+        for (final item in value)
+          item is Map<String, dynamic>
+              ? _convertEveryField(item, timezoneId)
+              : item,
+      ];
+    }
+  });
+  return converted;
+}
+
+/// Mean microseconds per call of [body] after [_warmup] untimed calls
+Future<double> _time(Future<void> Function() body) async {
+  for (var i = 0; i < _warmup; i++) {
+    await body();
+  }
+  final watch = Stopwatch()..start();
+  for (var i = 0; i < _calls; i++) {
+    await body();
+  }
+  watch.stop();
+  return watch.elapsedMicroseconds / _calls;
+}
+
+void main() {
+  test('bridge calendar year cache', () async {
+    TimezoneUtil.initialize();
+    CacheService.instance.clear();
+
+    final body = jsonEncode(_year(2025));
+    final api = AstrologyApiService.create(
+      baseUrl: 'http://localhost',
+      cache: CacheService.instance,
+      client: MockClient((request) async => http.Response(body, 200,
+          headers: {'content-type': 'application/json'})),
+    );
+    final bridge = AstrologyServiceBridge.create(apiService: api);
+
+    Future<Map<String, dynamic>> raw() => api.getCalendarYear(
+          year: 2025,
+          region: 'Tamil Nadu',
+          latitude: 13.08,
+          longitude: 80.27,
+          timezoneId: _zone,
+        );
+    Future<Map<String, dynamic>> converted() => bridge.getCalendarYear(
+          year: 2025,
+          region: 'Tamil Nadu',
+          latitude: 13.08,
+          longitude: 80.27,
+          timezoneId: _zone,
+        );
+
+    // Fill the API cache so both paths time only a cache hit
+    await raw();
+    final first = Stopwatch()..start();
+    await converted();
+    first.stop();
+
+    final before =
+        await _time(() async => _convertEveryField(await raw(), _zone));
+    final after = await _time(converted);
+
+    print('Calendar year, API cache hit ($_calls calls after $_warmup '
+        'warm-up):');
+    print('  first conversion   ${first.elapsedMicroseconds} µs');
+    print('  deep copy per call ${before.toStringAsFixed(1)} µs');
+    print('  cached per call    ${after.toStringAsFixed(1)} µs');
+    print('  speed-up           '
+        '${(before / after).toStringAsFixed(0)}x');
+  });
+}
@@ -0,0 +1,234 @@
+/// Astro Tables Generator
+///
+/// Writes `lib/core/features/astrology/engine/astro_tables.g.dart`: yearly
+/// delta-T knots with their natural cubic spline curvatures, and the IAU
+/// 1980 nutation series (Meeus, "Astronomical Algorithms" table 22.A)
+/// scaled to integers and ordered by amplitude. Run from the project root
+/// with `dart run tool/generate_astro_tables.dart` after changing a source
+/// value here, then bump `engineVersion`.
+library;
+
+import 'dart:io';
+
+const String _output =
+    'lib/core/features/astrology/engine/astro_tables.g.dart';
+
+const int _firstYear = 1700;
+const int _lastYear = 2150;
+
+/// Observed delta-T (TT − UT1) in seconds at the start of each year (IERS)
+const Map<int, double> _observed = {
+  2005: 64.69, 2006: 64.85, 2007: 65.15, 2008: 65.46, 2009: 65.78, //
+  2010: 66.07, 2011: 66.32, 2012: 66.60, 2013: 66.91, 2014: 67.28,
+  2015: 67.64, 2016: 68.10, 2017: 68.59, 2018: 68.97, 2019: 69.22,
+  2020: 69.36, 2021: 69.36, 2022: 69.29, 2023: 69.20, 2024: 69.18,
+  2025: 69.14,
+};
+
+/// Espenak & Meeus polynomials (NASA Five Millennium Canon) before 2005:
+/// first year, origin of t and coefficients of t⁰, t¹, …
+const List<(int, int, List<double>)> _segments = [
+  (1700, 1700, [8.83, 0.1603, -0.0059285, 0.00013336, -1 / 1174000]),
+  (1800, 1800, [
+    13.72, -0.332447, 0.0068612, 0.0041116, -0.00037436, 0.0000121272, //
+    -0.0000001699, 0.000000000875,
+  ]),
+  (1860, 1860, [
+    7.62, 0.5737, -0.251754, 0.01680668, -0.0004473624, 1 / 233174, //
+  ]),
+  (1900, 1900, [-2.79, 1.494119, -0.0598939, 0.0061966, -0.000197]),
+  (1920, 1920, [21.20, 0.84493, -0.076100, 0.0020936]),
+  (1941, 1950, [29.07, 0.407, -1 / 233, 1 / 2547]),
+  (1961, 1975, [45.45, 1.067, -1 / 260, -1 / 718]),
+  (1986, 2000, [
+    63.86, 0.3345, -0.060374, 0.0017275, 0.000651814, 0.00002373599, //
+  ]),
+];
+
+double _polynomial(double y) {
+  final (_, origin, coefficients) =
+      _segments.lastWhere((segment) => y >= segment.$1);
+  final t = y - origin;
+  var value = 0.0;
+  for (var i = coefficients.length - 1; i >= 0; i--) {
+    value = value * t + coefficients[i];
+  }
+  return value;
+}
+
+/// Espenak & Meeus prediction from 2050
+double _predicted(double y) {
+  final u = (y - 1820) / 100;
+  return -20 + 32 * u * u - 0.5628 * (2150 - y);
+}
+
+/// Delta-T is held at the last observation until this year: it has been
+/// flat or falling since 2021, so the long-term prediction's climb would
+/// overshoot the next years by a second or more
+const int _flatUntil = 2030;
+
+/// Delta-T of [year]: polynomials, observations, the last observation
+/// held to [_flatUntil], then a straight line to the 2050 prediction
+double _deltaT(int year) {
+  final y = year.toDouble();
+  if (year < 2005) return _polynomial(y);
+  if (year <= 2025) return _observed[year]!;
+  final last = _observed[2025]!;
+  if (year <= _flatUntil) return last;
+  if (year < 2050) {
+    return last +
+        (_predicted(2050) - last) * (year - _flatUntil) / (2050 - _flatUntil);
+  }
+  return _predicted(y);
+}
+
+/// Meeus table 22.A: multiples of D, M, M', F and Ω, then Δψ, its rate per
+/// Julian century, Δε and its rate, in 0.0001″
+const List<num> _nutation = [
+  0, 0, 0, 0, 1, -171996, -174.2, 92025, 8.9, //
+  -2, 0, 0, 2, 2, -13187, -1.6, 5736, -3.1,
+  0, 0, 0, 2, 2, -2274, -0.2, 977, -0.5,
+  0, 0, 0, 0, 2, 2062, 0.2, -895, 0.5,
+  0, 1, 0, 0, 0, 1426, -3.4, 54, -0.1,
+  0, 0, 1, 0, 0, 712, 0.1, -7, 0,
+  -2, 1, 0, 2, 2, -517, 1.2, 224, -0.6,
+  0, 0, 0, 2, 1, -386, -0.4, 200, 0,
+  0, 0, 1, 2, 2, -301, 0, 129, -0.1,
+  -2, -1, 0, 2, 2, 217, -0.5, -95, 0.3,
+  -2, 0, 1, 0, 0, -158, 0, 0, 0,
+  -2, 0, 0, 2, 1, 129, 0.1, -70, 0,
+  0, 0, -1, 2, 2, 123, 0, -53, 0,
+  2, 0, 0, 0, 0, 63, 0, 0, 0,
+  0, 0, 1, 0, 1, 63, 0.1, -33, 0,
+  2, 0, -1, 2, 2, -59, 0, 26, 0,
+  0, 0, -1, 0, 1, -58, -0.1, 32, 0,
+  0, 0, 1, 2, 1, -51, 0, 27, 0,
+  -2, 0, 2, 0, 0, 48, 0, 0, 0,
+  0, 0, -2, 2, 1, 46, 0, -24, 0,
+  2, 0, 0, 2, 2, -38, 0, 16, 0,
+  0, 0, 2, 2, 2, -31, 0, 13, 0,
+  0, 0, 2, 0, 0, 29, 0, 0, 0,
+  -2, 0, 1, 2, 2, 29, 0, -12, 0,
+  0, 0, 0, 2, 0, 26, 0, 0, 0,
+  -2, 0, 0, 2, 0, -22, 0, 0, 0,
+  0, 0, -1, 2, 1, 21, 0, -10, 0,
+  0, 2, 0, 0, 0, 17, -0.1, 0, 0,
+  2, 0, -1, 0, 1, 16, 0, -8, 0,
+  -2, 2, 0, 2, 2, -16, 0.1, 7, 0,
+  0, 1, 0, 0, 1, -15, 0, 9, 0,
+  -2, 0, 1, 0, 1, -13, 0, 7, 0,
+  0, -1, 0, 0, 1, -12, 0, 6, 0,
+  0, 0, 2, -2, 0, 11, 0, 0, 0,
+  2, 0, -1, 2, 1, -10, 0, 5, 0,
+  2, 0, 1, 2, 2, -8, 0, 3, 0,
+  0, 1, 0, 2, 2, 7, 0, -3, 0,
+  -2, 1, 1, 0, 0, -7, 0, 0, 0,
+  0, -1, 0, 2, 2, -7, 0, 3, 0,
+  2, 0, 0, 2, 1, -7, 0, 3, 0,
+  2, 0, 1, 0, 0, 6, 0, 0, 0,
+  -2, 0, 2, 2, 2, 6, 0, -3, 0,
+  -2, 0, 1, 2, 1, 6, 0, -3, 0,
+  2, 0, -2, 0, 1, -6, 0, 3, 0,
+  2, 0, 0, 0, 1, -6, 0, 3, 0,
+  0, -1, 1, 0, 0, 5, 0, 0, 0,
+  -2, -1, 0, 2, 1, -5, 0, 3, 0,
+  -2, 0, 0, 0, 1, -5, 0, 3, 0,
+  0, 0, 2, 2, 1, -5, 0, 3, 0,
+  -2, 0, 2, 0, 1, 4, 0, 0, 0,
+  -2, 1, 0, 2, 1, 4, 0, 0, 0,
+  0, 0, 1, -2, 0, 4, 0, 0, 0,
+  -1, 0, 1, 0, 0, -4, 0, 0, 0,
+  -2, 1, 0, 0, 0, -4, 0, 0, 0,
+  1, 0, 0, 0, 0, -4, 0, 0, 0,
+  0, 0, 1, 2, 0, 3, 0, 0, 0,
+  0, 0, -2, 2, 2, -3, 0, 0, 0,
+  -1, -1, 1, 0, 0, -3, 0, 0, 0,
+  0, 1, 1, 0, 0, -3, 0, 0, 0,
+  0, -1, 1, 2, 2, -3, 0, 0, 0,
+  2, -1, -1, 2, 2, -3, 0, 0, 0,
+  0, 0, 3, 2, 2, -3, 0, 0, 0,
+  2, -1, 0, 2, 2, -3, 0, 0, 0,
+];
+const int _nutationWidth = 9;
+
+/// Elements joined into lines of at most 80 columns
+String _packed(Iterable<String> items) {
+  final lines = <String>[];
+  var line = StringBuffer('  ');
+  for (final item in items) {
+    if (line.length > 2 && line.length + item.length + 2 > 80) {
+      lines.add(line.toString().trimRight());
+      line = StringBuffer('  ');
+    }
+    line.write('$item, ');
+  }
+  if (line.length > 2) lines.add(line.toString().trimRight());
+  return lines.join('\n');
+}
+
+void main() {
+  // Knots rounded first, so the curvatures fit the published values
+  final knots = [
+    for (var year = _firstYear; year <= _lastYear; year++)
+      double.parse(_deltaT(year).toStringAsFixed(4)),
+  ];
+
+  // Natural cubic spline with unit spacing (Thomas algorithm)
+  final n = knots.length;
+  final cp = List<double>.filled(n, 0);
+  final dp = List<double>.filled(n, 0);
+  for (var i = 1; i < n - 1; i++) {
+    final rhs = 6 * (knots[i + 1] - 2 * knots[i] + knots[i - 1]);
+    final denominator = 4 - cp[i - 1];
+    cp[i] = 1 / denominator;
+    dp[i] = (rhs - dp[i - 1]) / denominator;
+  }
+  final curvature = List<double>.filled(n, 0);
+  for (var i = n - 2; i > 0; i--) {
+    curvature[i] = dp[i] - cp[i] * curvature[i + 1];
+  }
+
+  // Nutation terms scaled to 0.00001″, largest Δψ first
+  final terms = [
+    for (var i = 0; i < _nutation.length; i += _nutationWidth)
+      [
+        for (var j = 0; j < 5; j++) _nutation[i + j].toInt(),
+        for (var j = 5; j < _nutationWidth; j++)
+          (_nutation[i + j] * 10).round(),
+      ],
+  ];
+  final order = List<int>.generate(terms.length, (i) => i)
+    ..sort((a, b) {
+      final byAmplitude = terms[b][5].abs().compareTo(terms[a][5].abs());
+      return byAmplitude != 0 ? byAmplitude : a.compareTo(b);
+    });
+
+  final out = StringBuffer()
+    ..writeln('/// Astro Tables')
+    ..writeln('///')
+    ..writeln('/// Generated by `tool/generate_astro_tables.dart`; do not '
+        'edit by hand.')
+    ..writeln('library;')
+    ..writeln()
+    ..writeln('/// Year of the first of [deltaTKnots]')
+    ..writeln('const int deltaTFirstYear = $_firstYear;')
+    ..writeln()
+    ..writeln('/// Delta-T in seconds at the start of each year')
+    ..writeln('const List<double> deltaTKnots = [')
+    ..writeln(_packed(knots.map((v) => v.toStringAsFixed(4))))
+    ..writeln('];')
+    ..writeln()
+    ..writeln('/// Second derivatives of the natural cubic spline through '
+        '[deltaTKnots]')
+    ..writeln('const List<double> deltaTCurvature = [')
+    ..writeln(_packed(curvature.map((v) => v.toStringAsFixed(8))))
+    ..writeln('];')
+    ..writeln()
+    ..writeln('/// IAU 1980 nutation: D, M, M\', F, Ω multiples, then Δψ, '
+        'Δψ per century,')
+    ..writeln('/// Δε and Δε per century in 0.00001″; largest Δψ first')
+    ..writeln('const List<int> nutationTerms = [')
+    ..writeln([for (final i in order) '  ${terms[i].join(', ')},'].join('\n'))
+    ..writeln('];');
+  File(_output).writeAsStringSync(out.toString());
+}